@@ -0,0 +1,359 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "colrcv.h"
+#include "cache.h"
+#include "convert.h"
+#include "models/rgb.h"
+#include "models/hsv.h"
+#include "models/hsl.h"
+#include "models/lab.h"
+#include "models/xyz.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * the number of shards a cache is split into, each with its own lock. this is
+ * a power of two, so that a shard can be picked with the bits of a hash
+ */
+#define SHARD_COUNT 16
+
+/*
+ * the number of colours in each set of a shard. a colour can only be in one
+ * set, but can be in any of its ways, the most recently used first
+ */
+#define SET_WAYS 4
+
+// any one of the colour structs, all of which are three doubles
+typedef union colour_t {
+    colrcv_rgb_t rgb;
+    colrcv_hsv_t hsv;
+    colrcv_hsl_t hsl;
+    colrcv_lab_t lab;
+    colrcv_xyz_t xyz;
+} colour_t;
+
+typedef struct cache_entry_t {
+    // the bits of each channel of the colour converted
+    uint64_t key[3];
+    // identifies the conversion, 0 if the entry is empty
+    unsigned int conversion;
+    // the converted colour
+    colour_t value;
+} cache_entry_t;
+
+/*
+ * one of the shards the cache is split into, so that threads looking up
+ * different colours rarely contend. the shards are locked rather than lock-free
+ * for the same reason as the pool's deques: it is simpler, and portable to
+ * compilers without atomic builtins, which C99 does not provide
+ */
+typedef struct cache_shard_t {
+    // guards everything else in the shard
+    pthread_mutex_t lock;
+    // `SET_WAYS` entries for each set
+    cache_entry_t* entries;
+    uint64_t hits;
+    uint64_t misses;
+} cache_shard_t;
+
+struct colrcv_cache_t {
+    // the number of sets in each shard, a power of two
+    size_t set_count;
+    cache_shard_t shards[SHARD_COUNT];
+};
+
+// converts a single colour with the single-colour conversion functions
+static colour_t convert_colour(
+    colrcv_model_t from, colrcv_model_t to, colour_t input
+) {
+    colour_t output = input;
+    switch(from) {
+        case COLRCV_MODEL_RGB:
+            switch(to) {
+                case COLRCV_MODEL_HSV:
+                    output.hsv = colrcv_rgb_to_hsv(input.rgb);
+                    break;
+                case COLRCV_MODEL_HSL:
+                    output.hsl = colrcv_rgb_to_hsl(input.rgb);
+                    break;
+                case COLRCV_MODEL_LAB:
+                    output.lab = colrcv_rgb_to_lab(input.rgb);
+                    break;
+                case COLRCV_MODEL_XYZ:
+                    output.xyz = colrcv_rgb_to_xyz(input.rgb);
+                    break;
+                case COLRCV_MODEL_RGB:
+                    break;
+            }
+            break;
+        case COLRCV_MODEL_HSV:
+            switch(to) {
+                case COLRCV_MODEL_RGB:
+                    output.rgb = colrcv_hsv_to_rgb(input.hsv);
+                    break;
+                case COLRCV_MODEL_HSL:
+                    output.hsl = colrcv_hsv_to_hsl(input.hsv);
+                    break;
+                case COLRCV_MODEL_LAB:
+                    output.lab = colrcv_hsv_to_lab(input.hsv);
+                    break;
+                case COLRCV_MODEL_XYZ:
+                    output.xyz = colrcv_hsv_to_xyz(input.hsv);
+                    break;
+                case COLRCV_MODEL_HSV:
+                    break;
+            }
+            break;
+        case COLRCV_MODEL_HSL:
+            switch(to) {
+                case COLRCV_MODEL_RGB:
+                    output.rgb = colrcv_hsl_to_rgb(input.hsl);
+                    break;
+                case COLRCV_MODEL_HSV:
+                    output.hsv = colrcv_hsl_to_hsv(input.hsl);
+                    break;
+                case COLRCV_MODEL_LAB:
+                    output.lab = colrcv_hsl_to_lab(input.hsl);
+                    break;
+                case COLRCV_MODEL_XYZ:
+                    output.xyz = colrcv_hsl_to_xyz(input.hsl);
+                    break;
+                case COLRCV_MODEL_HSL:
+                    break;
+            }
+            break;
+        case COLRCV_MODEL_LAB:
+            switch(to) {
+                case COLRCV_MODEL_RGB:
+                    output.rgb = colrcv_lab_to_rgb(input.lab);
+                    break;
+                case COLRCV_MODEL_HSV:
+                    output.hsv = colrcv_lab_to_hsv(input.lab);
+                    break;
+                case COLRCV_MODEL_HSL:
+                    output.hsl = colrcv_lab_to_hsl(input.lab);
+                    break;
+                case COLRCV_MODEL_XYZ:
+                    output.xyz = colrcv_lab_to_xyz(input.lab);
+                    break;
+                case COLRCV_MODEL_LAB:
+                    break;
+            }
+            break;
+        case COLRCV_MODEL_XYZ:
+            switch(to) {
+                case COLRCV_MODEL_RGB:
+                    output.rgb = colrcv_xyz_to_rgb(input.xyz);
+                    break;
+                case COLRCV_MODEL_HSV:
+                    output.hsv = colrcv_xyz_to_hsv(input.xyz);
+                    break;
+                case COLRCV_MODEL_HSL:
+                    output.hsl = colrcv_xyz_to_hsl(input.xyz);
+                    break;
+                case COLRCV_MODEL_LAB:
+                    output.lab = colrcv_xyz_to_lab(input.xyz);
+                    break;
+                case COLRCV_MODEL_XYZ:
+                    break;
+            }
+            break;
+    }
+    return output;
+}
+
+// mixes the bits of a key and conversion together
+static uint64_t hash_key(const uint64_t key[3], unsigned int conversion) {
+    uint64_t hash = conversion;
+    for(size_t i = 0; i < 3; i++) {
+        hash = (hash ^ key[i]) * UINT64_C(0x9E3779B97F4A7C15);
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+colrcv_cache_t* colrcv_cache_create(size_t capacity) {
+    colrcv_cache_t* cache = malloc(sizeof(colrcv_cache_t));
+    if(cache == NULL) {
+        return NULL;
+    }
+    cache->set_count = 1;
+    while(cache->set_count * SET_WAYS * SHARD_COUNT < capacity) {
+        cache->set_count *= 2;
+    }
+    const size_t entry_count = cache->set_count * SET_WAYS;
+    size_t created = 0;
+    for(; created < SHARD_COUNT; created++) {
+        cache_shard_t* shard = &cache->shards[created];
+        shard->entries = calloc(entry_count, sizeof(cache_entry_t));
+        if(shard->entries == NULL) {
+            break;
+        }
+        if(pthread_mutex_init(&shard->lock, NULL) != 0) {
+            free(shard->entries);
+            break;
+        }
+        shard->hits = 0;
+        shard->misses = 0;
+    }
+    if(created < SHARD_COUNT) {
+        // undo the shards that were made
+        for(size_t i = 0; i < created; i++) {
+            pthread_mutex_destroy(&cache->shards[i].lock);
+            free(cache->shards[i].entries);
+        }
+        free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+void colrcv_cache_free(colrcv_cache_t* cache) {
+    if(cache == NULL) {
+        return;
+    }
+    for(size_t i = 0; i < SHARD_COUNT; i++) {
+        pthread_mutex_destroy(&cache->shards[i].lock);
+        free(cache->shards[i].entries);
+    }
+    free(cache);
+}
+
+size_t colrcv_cache_get_capacity(const colrcv_cache_t* cache) {
+    return cache->set_count * SET_WAYS * SHARD_COUNT;
+}
+
+/*
+ * looks a colour up in its set, moving it to the front if found.
+ * must be called with the shard locked
+ */
+static bool find_entry(
+    cache_entry_t* set, const uint64_t key[3], unsigned int conversion,
+    colour_t* value
+) {
+    for(size_t way = 0; way < SET_WAYS; way++) {
+        if(
+            set[way].conversion == conversion &&
+            memcmp(set[way].key, key, sizeof(set[way].key)) == 0
+        ) {
+            const cache_entry_t found = set[way];
+            memmove(set + 1, set, way * sizeof(cache_entry_t));
+            set[0] = found;
+            *value = found.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * adds a colour to the front of its set, dropping the least recently used.
+ * must be called with the shard locked
+ */
+static void add_entry(
+    cache_entry_t* set, const uint64_t key[3], unsigned int conversion,
+    colour_t value
+) {
+    memmove(set + 1, set, (SET_WAYS - 1) * sizeof(cache_entry_t));
+    memcpy(set[0].key, key, sizeof(set[0].key));
+    set[0].conversion = conversion;
+    set[0].value = value;
+}
+
+bool colrcv_cache_convert(
+    colrcv_cache_t* cache, colrcv_model_t from, colrcv_model_t to,
+    const void* input, void* output
+) {
+    if(
+        !colrcv_model_is_valid(from) || !colrcv_model_is_valid(to) ||
+        from == to
+    ) {
+        return false;
+    }
+    colour_t colour;
+    memcpy(&colour, input, sizeof(colrcv_rgb_t));
+    if(cache == NULL) {
+        colour = convert_colour(from, to, colour);
+        memcpy(output, &colour, sizeof(colrcv_rgb_t));
+        return true;
+    }
+    uint64_t key[3];
+    memcpy(key, &colour, sizeof(key));
+    // 0 is kept for empty entries
+    const unsigned int conversion = from * COLRCV_MODEL_COUNT + to + 1;
+    const uint64_t hash = hash_key(key, conversion);
+    cache_shard_t* shard = &cache->shards[hash % SHARD_COUNT];
+    cache_entry_t* set = shard->entries + (
+        (hash / SHARD_COUNT) & (cache->set_count - 1)
+    ) * SET_WAYS;
+    pthread_mutex_lock(&shard->lock);
+    const bool found = find_entry(set, key, conversion, &colour);
+    if(found) {
+        shard->hits++;
+    } else {
+        shard->misses++;
+    }
+    pthread_mutex_unlock(&shard->lock);
+    if(!found) {
+        // the shard isn't held while converting, which is the slow part
+        colour = convert_colour(from, to, colour);
+        pthread_mutex_lock(&shard->lock);
+        // another thread may have added the same colour in the meantime
+        colour_t added;
+        if(!find_entry(set, key, conversion, &added)) {
+            add_entry(set, key, conversion, colour);
+        }
+        pthread_mutex_unlock(&shard->lock);
+    }
+    memcpy(output, &colour, sizeof(colrcv_rgb_t));
+    return true;
+}
+
+colrcv_cache_stats_t colrcv_cache_get_stats(colrcv_cache_t* cache) {
+    colrcv_cache_stats_t stats = { .hits = 0, .misses = 0, };
+    for(size_t i = 0; i < SHARD_COUNT; i++) {
+        cache_shard_t* shard = &cache->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        stats.hits += shard->hits;
+        stats.misses += shard->misses;
+        pthread_mutex_unlock(&shard->lock);
+    }
+    return stats;
+}
+
+void colrcv_cache_clear(colrcv_cache_t* cache) {
+    const size_t entry_count = cache->set_count * SET_WAYS;
+    for(size_t i = 0; i < SHARD_COUNT; i++) {
+        cache_shard_t* shard = &cache->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        memset(shard->entries, 0, entry_count * sizeof(cache_entry_t));
+        shard->hits = 0;
+        shard->misses = 0;
+        pthread_mutex_unlock(&shard->lock);
+    }
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,131 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares a cache for converting single colours
+ * which are converted over and over again.
+ * @details Code which converts one colour at a time, such as a web service
+ * converting the same brand colours for every request, can convert through a
+ * cache so that a colour it has converted before costs a hash lookup instead
+ * of the whole conversion. Colours are looked up by the exact bits of their
+ * channels and the conversion being done.
+ *
+ * A cache holds a bounded number of colours, forgetting those used least
+ * recently to make room for new ones. It is split into shards, each with its
+ * own lock, so that it can be shared between threads without them waiting on
+ * each other much.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_CACHE_H
+#define SAXBOPHONE_COLRCV_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "convert.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief An opaque conversion cache, made by `colrcv_cache_create()` and
+ * freed by `colrcv_cache_free()`
+ * @since `v0.6.0`
+ */
+typedef struct colrcv_cache_t colrcv_cache_t;
+
+/**
+ * @brief Counts of the lookups made in a conversion cache
+ * @since `v0.6.0`
+ */
+typedef struct colrcv_cache_stats_t {
+    /** @brief The number of colours that were found in the cache */
+    uint64_t hits;
+    /** @brief The number of colours that had to be converted */
+    uint64_t misses;
+} colrcv_cache_stats_t;
+
+/**
+ * @brief Creates a conversion cache
+ * @param capacity The number of colours to hold, which is rounded up so that
+ * the cache can be split evenly into shards
+ * @returns A new cache, which should be freed with `colrcv_cache_free()`
+ * @returns `NULL` if memory could not be allocated
+ * @since `v0.6.0`
+ */
+colrcv_cache_t* colrcv_cache_create(size_t capacity);
+
+/**
+ * @brief Frees a conversion cache
+ * @details This must not be called while another thread is using the cache.
+ * @param cache The cache to free. Does nothing if this is `NULL`
+ * @since `v0.6.0`
+ */
+void colrcv_cache_free(colrcv_cache_t* cache);
+
+/**
+ * @brief Gets the number of colours that a conversion cache can hold
+ * @since `v0.6.0`
+ */
+size_t colrcv_cache_get_capacity(const colrcv_cache_t* cache);
+
+/**
+ * @brief Converts a single colour, looking it up in a cache first
+ * @details Colours not found are converted with the single-colour conversion
+ * functions, such as `colrcv_rgb_to_lab()`, and added to the cache, so the
+ * results are always exactly the same as those functions give. This may be
+ * called from several threads at once with the same cache.
+ * @param cache The cache to use. If this is `NULL`, the colour is converted
+ * without a cache
+ * @param from The colour model to convert from
+ * @param to The colour model to convert to
+ * @param input Pointer to the colour struct to be converted, such as a
+ * `colrcv_rgb_t`
+ * @param[out] output Pointer to write the converted colour struct to, such as
+ * a `colrcv_lab_t`
+ * @returns `true` if the colour was converted
+ * @returns `false` if the models are the same or either is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_cache_convert(
+    colrcv_cache_t* cache, colrcv_model_t from, colrcv_model_t to,
+    const void* input, void* output
+);
+
+/**
+ * @brief Gets the number of hits and misses of a conversion cache since it
+ * was created or last cleared
+ * @since `v0.6.0`
+ */
+colrcv_cache_stats_t colrcv_cache_get_stats(colrcv_cache_t* cache);
+
+/**
+ * @brief Empties a conversion cache and resets its hit and miss counts
+ * @since `v0.6.0`
+ */
+void colrcv_cache_clear(colrcv_cache_t* cache);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
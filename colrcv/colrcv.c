@@ -11,6 +11,7 @@
 #include <stdbool.h>
 
 #include "colrcv.h"
+#include "internal/scalar.h"
 
 
 #ifdef __cplusplus
@@ -25,21 +26,15 @@ const colrcv_version_t COLRCV_VERSION = {
     .string = COLRCV_VERSION_STRING,
 };
 
-bool colrcv_range_valid(double min, double val, double max) {
-    return ((min <= val) && (val <= max));
-}
-
-double colrcv_min(double a, double b) {
-    return (a < b) ? a : b;
-}
+// the accuracy mode used by the batch conversion functions
+static colrcv_accuracy_t accuracy_mode = COLRCV_ACCURACY_EXACT;
 
-double colrcv_max(double a, double b) {
-    return (a > b) ? a : b;
+colrcv_accuracy_t colrcv_get_accuracy(void) {
+    return accuracy_mode;
 }
 
-double colrcv_clamp(double value, double min, double max) {
-    // returning the minimum of the maximum is an easy way to clamp
-    return colrcv_min(max, colrcv_max(min, value));
+void colrcv_set_accuracy(colrcv_accuracy_t accuracy) {
+    accuracy_mode = accuracy;
 }
 
 #ifdef __cplusplus
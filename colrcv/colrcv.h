@@ -24,6 +24,7 @@
 #define SAXBOPHONE_COLRCV_COLRCV_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 
@@ -53,6 +54,36 @@ typedef struct colrcv_version_t {
  */
 extern const colrcv_version_t COLRCV_VERSION;
 
+/**
+ * @brief Marks the scalar functions which can be inlined into the caller
+ * @details These are the helpers below and, for each colour model, the
+ * channel and colour validation functions, the clamping functions and the
+ * single-colour conversions between the double and single-precision colour
+ * types, such as `colrcv_rgb_to_lab()` and `colrcv_rgbf_to_labf()`.
+ *
+ * By default they are compiled into the library and called like any other
+ * function. If `COLRCV_INLINE` is defined before any colrcv header is
+ * included, they are instead defined `static inline` in the headers, so the
+ * compiler can inline them into tight loops and vectorise those loops, which
+ * calls into the library prevent. The library must still be linked, for the
+ * range constants, the 8-bit and 16-bit conversions and the batch functions.
+ * The results are the same either way, but calls to inlined functions are
+ * never counted by the statistics in stats.h.
+ * @note `COLRCV_INLINE` must be defined (or not) in the same way for every
+ * file of a program which includes colrcv, and the installed headers in the
+ * `internal` folder are needed to use it. As the inlined definitions are C99,
+ * it can't be used from C++.
+ * @since `v0.6.0`
+ */
+#if defined(COLRCV_INLINE) && defined(__cplusplus)
+#error "COLRCV_INLINE can only be used from C"
+#endif
+#ifdef COLRCV_INLINE
+#define COLRCV_SCALAR static inline
+#else
+#define COLRCV_SCALAR
+#endif
+
 /**
  * @brief A utility function for checking that a given value is in a given range
  * @details Checks that the condition `min <= val <= max` is true
@@ -60,21 +91,21 @@ extern const colrcv_version_t COLRCV_VERSION;
  * @returns `false` if the condition is not satisfied
  * @since `v0.1.0`
  */
-bool colrcv_range_valid(double min, double val, double max);
+COLRCV_SCALAR bool colrcv_range_valid(double min, double val, double max);
 
 /**
  * @brief Get the smallest of two given values
  * @returns The smallest value
  * @since `v0.1.0`
  */
-double colrcv_min(double a, double b);
+COLRCV_SCALAR double colrcv_min(double a, double b);
 
 /**
  * @brief Get the largest of two given values
  * @returns The largest value
  * @since `v0.1.0`
  */
-double colrcv_max(double a, double b);
+COLRCV_SCALAR double colrcv_max(double a, double b);
 
 /**
  * @brief Clamp a given value to be within a given range
@@ -85,11 +116,68 @@ double colrcv_max(double a, double b);
  * `min -> max`
  * @since `v0.4.0`
  */
-double colrcv_clamp(double value, double min, double max);
+COLRCV_SCALAR double colrcv_clamp(double value, double min, double max);
+
+/**
+ * @brief The type of all of the Structure-of-Arrays batch conversion functions
+ * @details Such as `colrcv_rgb_to_lab_soa()`. The first three arguments are
+ * the input channel arrays, the next three are the output channel arrays and
+ * the last is the number of colours in each array.
+ * @since `v0.6.0`
+ */
+typedef void (* colrcv_soa_conversion_t)(
+    const double*, const double*, const double*,
+    double*, double*, double*,
+    size_t
+);
+
+/**
+ * @brief The accuracy modes that the batch conversion functions can use
+ * @details The single-colour conversion functions always use
+ * `COLRCV_ACCURACY_EXACT` and can be used as a reference.
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_accuracy_t {
+    /**
+     * @brief Use the C library's `pow()` for the sRGB and LAB transfer
+     * functions
+     */
+    COLRCV_ACCURACY_EXACT = 0,
+    /**
+     * @brief Use vectorised approximations of the sRGB and LAB transfer
+     * functions
+     * @details Each sRGB transfer function result has a relative error below
+     * `1e-8`, which keeps XYZ results within `1e-6` and RGB results within
+     * `1e-5` of those given by `COLRCV_ACCURACY_EXACT`. The LAB cube root has a
+     * relative error below `2e-12`.
+     */
+    COLRCV_ACCURACY_FAST,
+} colrcv_accuracy_t;
+
+/**
+ * @brief Get the accuracy mode used by the batch conversion functions
+ * @returns The mode last set with `colrcv_set_accuracy()`, or
+ * `COLRCV_ACCURACY_EXACT` if it has not been set
+ * @since `v0.6.0`
+ */
+colrcv_accuracy_t colrcv_get_accuracy(void);
+
+/**
+ * @brief Set the accuracy mode used by the batch conversion functions
+ * @details This must not be called while a batch conversion is running.
+ * @param accuracy The accuracy mode to use
+ * @since `v0.6.0`
+ */
+void colrcv_set_accuracy(colrcv_accuracy_t accuracy);
 
 #ifdef __cplusplus
 } // extern "C"
 #endif
 
+// the definitions of the helpers, when they are to be inlined
+#ifdef COLRCV_INLINE
+#include "internal/scalar.h"
+#endif
+
 // end of header file
 #endif
@@ -0,0 +1,115 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "models/rgb.h"
+#include "models/hsv.h"
+#include "models/hsl.h"
+#include "models/lab.h"
+#include "models/xyz.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// conversion functions, indexed by the model converted from and then to
+static const colrcv_soa_conversion_t CONVERSIONS[
+    COLRCV_MODEL_COUNT
+][COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = {
+        [COLRCV_MODEL_HSV] = colrcv_rgb_to_hsv_soa,
+        [COLRCV_MODEL_HSL] = colrcv_rgb_to_hsl_soa,
+        [COLRCV_MODEL_LAB] = colrcv_rgb_to_lab_soa,
+        [COLRCV_MODEL_XYZ] = colrcv_rgb_to_xyz_soa,
+    },
+    [COLRCV_MODEL_HSV] = {
+        [COLRCV_MODEL_RGB] = colrcv_hsv_to_rgb_soa,
+        [COLRCV_MODEL_HSL] = colrcv_hsv_to_hsl_soa,
+        [COLRCV_MODEL_LAB] = colrcv_hsv_to_lab_soa,
+        [COLRCV_MODEL_XYZ] = colrcv_hsv_to_xyz_soa,
+    },
+    [COLRCV_MODEL_HSL] = {
+        [COLRCV_MODEL_RGB] = colrcv_hsl_to_rgb_soa,
+        [COLRCV_MODEL_HSV] = colrcv_hsl_to_hsv_soa,
+        [COLRCV_MODEL_LAB] = colrcv_hsl_to_lab_soa,
+        [COLRCV_MODEL_XYZ] = colrcv_hsl_to_xyz_soa,
+    },
+    [COLRCV_MODEL_LAB] = {
+        [COLRCV_MODEL_RGB] = colrcv_lab_to_rgb_soa,
+        [COLRCV_MODEL_HSV] = colrcv_lab_to_hsv_soa,
+        [COLRCV_MODEL_HSL] = colrcv_lab_to_hsl_soa,
+        [COLRCV_MODEL_XYZ] = colrcv_lab_to_xyz_soa,
+    },
+    [COLRCV_MODEL_XYZ] = {
+        [COLRCV_MODEL_RGB] = colrcv_xyz_to_rgb_soa,
+        [COLRCV_MODEL_HSV] = colrcv_xyz_to_hsv_soa,
+        [COLRCV_MODEL_HSL] = colrcv_xyz_to_hsl_soa,
+        [COLRCV_MODEL_LAB] = colrcv_xyz_to_lab_soa,
+    },
+};
+
+bool colrcv_model_is_valid(colrcv_model_t model) {
+    return ((int)model >= 0) && ((int)model < COLRCV_MODEL_COUNT);
+}
+
+colrcv_soa_conversion_t colrcv_get_soa_conversion(
+    colrcv_model_t from, colrcv_model_t to
+) {
+    if(!colrcv_model_is_valid(from) || !colrcv_model_is_valid(to)) {
+        return NULL;
+    }
+    // conversions between the same model are left as NULL
+    return CONVERSIONS[from][to];
+}
+
+bool colrcv_get_model_range(
+    colrcv_model_t model, double min[3], double max[3]
+) {
+    switch(model) {
+        case COLRCV_MODEL_RGB:
+            min[0] = min[1] = min[2] = COLRCV_RGB_MIN_VALUE;
+            max[0] = max[1] = max[2] = COLRCV_RGB_MAX_VALUE;
+            return true;
+        case COLRCV_MODEL_HSV:
+            min[0] = min[1] = min[2] = COLRCV_HSV_MIN_VALUE;
+            max[0] = COLRCV_HSV_H_MAX_VALUE;
+            max[1] = COLRCV_HSV_S_MAX_VALUE;
+            max[2] = COLRCV_HSV_V_MAX_VALUE;
+            return true;
+        case COLRCV_MODEL_HSL:
+            min[0] = min[1] = min[2] = COLRCV_HSL_MIN_VALUE;
+            max[0] = COLRCV_HSL_H_MAX_VALUE;
+            max[1] = COLRCV_HSL_S_MAX_VALUE;
+            max[2] = COLRCV_HSL_L_MAX_VALUE;
+            return true;
+        case COLRCV_MODEL_LAB:
+            min[0] = COLRCV_LAB_L_MIN_VALUE;
+            min[1] = COLRCV_LAB_A_MIN_VALUE;
+            min[2] = COLRCV_LAB_B_MIN_VALUE;
+            max[0] = max[1] = max[2] = COLRCV_LAB_MAX_VALUE;
+            return true;
+        case COLRCV_MODEL_XYZ:
+            min[0] = min[1] = min[2] = COLRCV_XYZ_MIN_VALUE;
+            max[0] = COLRCV_XYZ_X_MAX_VALUE;
+            max[1] = COLRCV_XYZ_Y_MAX_VALUE;
+            max[2] = COLRCV_XYZ_Z_MAX_VALUE;
+            return true;
+    }
+    return false;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,104 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares functions for choosing a conversion at
+ * runtime, by the colour models to convert between.
+ * @details This is useful for code which works with any of the colour models,
+ * such as `colrcv_lut_build()`.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_CONVERT_H
+#define SAXBOPHONE_COLRCV_CONVERT_H
+
+#include <stdbool.h>
+
+#include "colrcv.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief The colour models supported by colrcv
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_model_t {
+    /** @brief RGB, see `colrcv_rgb_t` */
+    COLRCV_MODEL_RGB = 0,
+    /** @brief HSV, see `colrcv_hsv_t` */
+    COLRCV_MODEL_HSV,
+    /** @brief HSL, see `colrcv_hsl_t` */
+    COLRCV_MODEL_HSL,
+    /** @brief LAB, see `colrcv_lab_t` */
+    COLRCV_MODEL_LAB,
+    /** @brief XYZ, see `colrcv_xyz_t` */
+    COLRCV_MODEL_XYZ,
+} colrcv_model_t;
+
+/**
+ * @brief The number of colour models in `colrcv_model_t`
+ * @since `v0.6.0`
+ */
+#define COLRCV_MODEL_COUNT 5
+
+/**
+ * @brief Checks that a given `colrcv_model_t` is one of the colour models
+ * @returns `true` if it is valid
+ * @returns `false` if it is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_model_is_valid(colrcv_model_t model);
+
+/**
+ * @brief Gets the Structure-of-Arrays batch conversion function between two
+ * colour models
+ * @details For example, `colrcv_get_soa_conversion(COLRCV_MODEL_RGB,
+ * COLRCV_MODEL_LAB)` returns `colrcv_rgb_to_lab_soa`.
+ * @param from The colour model to convert from
+ * @param to The colour model to convert to
+ * @returns The conversion function
+ * @returns `NULL` if the models are the same or either is not valid
+ * @since `v0.6.0`
+ */
+colrcv_soa_conversion_t colrcv_get_soa_conversion(
+    colrcv_model_t from, colrcv_model_t to
+);
+
+/**
+ * @brief Gets the 'standard' range of each channel of a colour model
+ * @details These are the same ranges checked by each model's `_is_valid()`
+ * functions, such as `COLRCV_RGB_MIN_VALUE` to `COLRCV_RGB_MAX_VALUE`.
+ * @param model The colour model to get the ranges of
+ * @param[out] min Array to write the minimum value of each channel to
+ * @param[out] max Array to write the maximum value of each channel to
+ * @returns `true` if the ranges were written
+ * @returns `false` if the model is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_get_model_range(
+    colrcv_model_t model, double min[3], double max[3]
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
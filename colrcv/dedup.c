@@ -0,0 +1,342 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "dedup.h"
+#include "pixel.h"
+#include "internal/batch.h"
+#include "internal/simd.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * the number of pixels hashed at a time. after each block, the table is
+ * given up on if nearly all of the block's pixels were new
+ */
+#define BLOCK_SIZE 4096
+
+// marks a slot of the table which has no pixel in it
+#define EMPTY_SLOT UINT32_MAX
+
+// where the converted colours are written to
+typedef struct colour_output_t {
+    // channel arrays, used if `structs` is NULL
+    double* channels[3];
+    // colour structs `stride` bytes apart
+    char* structs;
+    size_t stride;
+    // may be NULL
+    double* alpha;
+} colour_output_t;
+
+// an open-addressing hash table of the distinct pixels found so far
+typedef struct dedup_table_t {
+    // the number of bytes in each pixel
+    size_t pixel_size;
+    // the table has 2 to the power of this many slots
+    unsigned int bits;
+    // the pixel in each slot, compared as a word
+    uint32_t* keys;
+    // the index of the distinct pixel in each slot, or EMPTY_SLOT
+    uint32_t* slots;
+    // the number of distinct pixels found, and the most there can be
+    size_t unique;
+    size_t max_unique;
+    // the distinct pixels, packed one after the other
+    uint8_t* pixels;
+    // the converted colour and alpha of each distinct pixel
+    double* channels[4];
+    // the key, hash and index of the distinct pixel for each pixel of a block
+    uint32_t* block_keys;
+    uint32_t* block_hashes;
+    uint32_t* block_ids;
+} dedup_table_t;
+
+static void free_table(dedup_table_t* table) {
+    free(table->keys);
+    free(table->slots);
+    free(table->pixels);
+    free(table->channels[0]);
+    free(table->block_keys);
+}
+
+// returns false if memory could not be allocated
+static bool create_table(
+    dedup_table_t* table, size_t pixel_size, size_t max_unique
+) {
+    table->pixel_size = pixel_size;
+    // keep the table at most half full, so probe sequences stay short
+    table->bits = 1;
+    while(((size_t)1 << table->bits) < max_unique * 2) {
+        table->bits++;
+    }
+    const size_t slot_count = (size_t)1 << table->bits;
+    table->keys = malloc(slot_count * sizeof(uint32_t));
+    table->slots = malloc(slot_count * sizeof(uint32_t));
+    table->unique = 0;
+    table->max_unique = max_unique;
+    table->pixels = malloc(max_unique * pixel_size);
+    table->channels[0] = malloc(max_unique * 4 * sizeof(double));
+    table->block_keys = malloc(BLOCK_SIZE * 3 * sizeof(uint32_t));
+    if(
+        table->keys == NULL || table->slots == NULL ||
+        table->pixels == NULL || table->channels[0] == NULL ||
+        table->block_keys == NULL
+    ) {
+        free_table(table);
+        return false;
+    }
+    for(size_t i = 1; i < 4; i++) {
+        table->channels[i] = table->channels[0] + max_unique * i;
+    }
+    table->block_hashes = table->block_keys + BLOCK_SIZE;
+    table->block_ids = table->block_keys + BLOCK_SIZE * 2;
+    memset(table->slots, 0xFF, slot_count * sizeof(uint32_t));
+    return true;
+}
+
+// reads the pixels of a block as words, to be compared and hashed
+static void load_keys(
+    dedup_table_t* table, const uint8_t* pixels, size_t count
+) {
+    if(table->pixel_size == sizeof(uint32_t)) {
+        memcpy(table->block_keys, pixels, count * sizeof(uint32_t));
+    } else {
+        // copied, as the bytes may not be aligned or be readable as uint16_t
+        for(size_t i = 0; i < count; i++) {
+            uint16_t word;
+            memcpy(&word, pixels + i * sizeof(word), sizeof(word));
+            table->block_keys[i] = word;
+        }
+    }
+}
+
+/*
+ * finds the distinct pixel of each pixel of a block, adding those not found.
+ * returns false if the table filled up before the block was done
+ */
+static bool find_block(
+    dedup_table_t* table, const uint8_t* pixels, size_t count
+) {
+    const uint32_t* keys = table->block_keys;
+    const uint32_t* hashes = table->block_hashes;
+    uint32_t* ids = table->block_ids;
+    const size_t mask = ((size_t)1 << table->bits) - 1;
+    for(size_t i = 0; i < count; i++) {
+        // runs of the same pixel are common, and needn't be looked up again
+        if(i > 0 && keys[i] == keys[i - 1]) {
+            ids[i] = ids[i - 1];
+            continue;
+        }
+        size_t slot = hashes[i];
+        while(
+            table->slots[slot] != EMPTY_SLOT && table->keys[slot] != keys[i]
+        ) {
+            slot = (slot + 1) & mask;
+        }
+        if(table->slots[slot] == EMPTY_SLOT) {
+            if(table->unique == table->max_unique) {
+                return false;
+            }
+            table->keys[slot] = keys[i];
+            table->slots[slot] = (uint32_t)table->unique;
+            memcpy(
+                table->pixels + table->unique * table->pixel_size,
+                pixels + i * table->pixel_size, table->pixel_size
+            );
+            table->unique++;
+        }
+        ids[i] = table->slots[slot];
+    }
+    return true;
+}
+
+// copies the converted colour of each pixel of a block to the output
+static void scatter_block(
+    const dedup_table_t* table, colour_output_t output,
+    size_t start, size_t count
+) {
+    const uint32_t* ids = table->block_ids;
+    if(output.structs == NULL) {
+        for(size_t ch = 0; ch < 3; ch++) {
+            const double* unique = table->channels[ch];
+            double* channel = output.channels[ch] + start;
+            for(size_t i = 0; i < count; i++) {
+                channel[i] = unique[ids[i]];
+            }
+        }
+    } else {
+        for(size_t i = 0; i < count; i++) {
+            double* colour = (double*)(
+                output.structs + (start + i) * output.stride
+            );
+            colour[0] = table->channels[0][ids[i]];
+            colour[1] = table->channels[1][ids[i]];
+            colour[2] = table->channels[2][ids[i]];
+        }
+    }
+    if(output.alpha != NULL) {
+        for(size_t i = 0; i < count; i++) {
+            output.alpha[start + i] = table->channels[3][ids[i]];
+        }
+    }
+}
+
+// converts pixels directly, from `start` onwards
+static void convert_rest(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const uint8_t* pixels, colrcv_model_t to,
+    colour_output_t output, size_t start, size_t count
+) {
+    const size_t pixel_size = colrcv_pixel_format_size(format);
+    double* alpha = (output.alpha == NULL) ? NULL : output.alpha + start;
+    if(output.structs == NULL) {
+        colrcv_pixels_to_soa(
+            format, alpha_mode, pixels + start * pixel_size, to,
+            output.channels[0] + start, output.channels[1] + start,
+            output.channels[2] + start, alpha, count - start
+        );
+    } else {
+        colrcv_pixels_to_strided(
+            format, alpha_mode, pixels + start * pixel_size, to,
+            output.structs + start * output.stride, output.stride, alpha,
+            count - start
+        );
+    }
+}
+
+/*
+ * converts the pixels a block at a time, converting only the pixels not seen
+ * before, until there are too many distinct pixels for that to be worth it.
+ * returns the number of colours converted, or 0 if memory couldn't be got
+ */
+static size_t convert_pixels(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const uint8_t* pixels, colrcv_model_t to,
+    colour_output_t output, size_t count
+) {
+    // a table isn't worth making for less than a tile of pixels
+    if(count <= COLRCV_BATCH_TILE_SIZE) {
+        convert_rest(format, alpha_mode, pixels, to, output, 0, count);
+        return count;
+    }
+    dedup_table_t table;
+    if(
+        !create_table(
+            &table, colrcv_pixel_format_size(format),
+            (count < COLRCV_DEDUP_MAX_UNIQUE) ? count : COLRCV_DEDUP_MAX_UNIQUE
+        )
+    ) {
+        return 0;
+    }
+    size_t start = 0;
+    while(start < count) {
+        const size_t block = (count - start < BLOCK_SIZE)
+            ? count - start
+            : BLOCK_SIZE;
+        const uint8_t* block_pixels = pixels + start * table.pixel_size;
+        const size_t first_new = table.unique;
+        load_keys(&table, block_pixels, block);
+        colrcv_simd_hash_keys(
+            table.block_keys, table.block_hashes, table.bits, block
+        );
+        if(!find_block(&table, block_pixels, block)) {
+            // those added from this block won't be converted
+            table.unique = first_new;
+            break;
+        }
+        colrcv_pixels_to_soa(
+            format, alpha_mode, table.pixels + first_new * table.pixel_size,
+            to, table.channels[0] + first_new, table.channels[1] + first_new,
+            table.channels[2] + first_new,
+            (output.alpha == NULL) ? NULL : table.channels[3] + first_new,
+            table.unique - first_new
+        );
+        scatter_block(&table, output, start, block);
+        start += block;
+        // when nearly every pixel is new, looking them up only costs time
+        if((table.unique - first_new) * 16 > block * 15) {
+            break;
+        }
+    }
+    convert_rest(format, alpha_mode, pixels, to, output, start, count);
+    const size_t converted = table.unique + (count - start);
+    free_table(&table);
+    return converted;
+}
+
+bool colrcv_dedup_pixels_to_soa(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    double* a, double* b, double* c, double* alpha,
+    size_t count, size_t* converted
+) {
+    // this checks the arguments, without converting anything
+    if(
+        !colrcv_pixels_to_soa(
+            format, alpha_mode, pixels, to, a, b, c, alpha, 0
+        )
+    ) {
+        return false;
+    }
+    const colour_output_t output = {
+        .channels = { a, b, c, }, .structs = NULL, .stride = 0,
+        .alpha = alpha,
+    };
+    const size_t done = convert_pixels(
+        format, alpha_mode, pixels, to, output, count
+    );
+    if(converted != NULL) {
+        *converted = done;
+    }
+    return done > 0 || count == 0;
+}
+
+bool colrcv_dedup_pixels_to_strided(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    void* output, size_t output_stride, double* alpha,
+    size_t count, size_t* converted
+) {
+    // this checks the arguments, without converting anything
+    if(
+        !colrcv_pixels_to_strided(
+            format, alpha_mode, pixels, to, output, output_stride, alpha, 0
+        )
+    ) {
+        return false;
+    }
+    const colour_output_t arrays = {
+        .channels = { NULL, NULL, NULL, },
+        .structs = (char*)output, .stride = output_stride,
+        .alpha = alpha,
+    };
+    const size_t done = convert_pixels(
+        format, alpha_mode, pixels, to, arrays, count
+    );
+    if(converted != NULL) {
+        *converted = done;
+    }
+    return done > 0 || count == 0;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,124 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares functions for converting packed pixels
+ * which only converts each distinct pixel once.
+ * @details Icons, screenshots and indexed art often have only a few thousand
+ * distinct colours across millions of pixels. These functions first find the
+ * distinct pixels with an open-addressing hash table, convert only those and
+ * then copy each result to every pixel that shares it.
+ *
+ * When the pixels turn out to be mostly distinct, such as those of photographs,
+ * the rest of them are converted directly, so these functions are never much
+ * slower than `colrcv_pixels_to_soa()` and `colrcv_pixels_to_strided()`.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_DEDUP_H
+#define SAXBOPHONE_COLRCV_DEDUP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "convert.h"
+#include "pixel.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief The largest number of distinct pixels that are converted once each
+ * @details Once more distinct pixels than this have been found, the rest of
+ * the pixels are converted directly.
+ * @since `v0.6.0`
+ */
+#define COLRCV_DEDUP_MAX_UNIQUE 16384
+
+/**
+ * @brief Converts an array of packed pixels to an array of colours,
+ * converting each distinct pixel only once
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Pixels are compared whole, including alpha, and each distinct
+ * pixel is converted with `colrcv_pixels_to_soa()`. The results are the same
+ * as converting all of the pixels with that function, except that they may
+ * differ in the last bit where a vector kernel is used for one and not the
+ * other.
+ * @param format The pixel format of the pixels
+ * @param alpha_mode The way that colour is stored with alpha in the pixels
+ * @param pixels Pointer to the first pixel to be converted, which must be
+ * suitably aligned for the 16-bit or 32-bit word formats
+ * @param to The colour model to convert to
+ * @param[out] a Array to write the first channels of the colours to
+ * @param[out] b Array to write the second channels of the colours to
+ * @param[out] c Array to write the third channels of the colours to
+ * @param[out] alpha Array to write the alpha of each pixel to, in range
+ * `0.0` to `1.0`. May be `NULL` if alpha is not wanted
+ * @param count The number of pixels to convert
+ * @param[out] converted Set to the number of colours that were actually
+ * converted, which is the number of distinct pixels if there were few enough
+ * of them. May be `NULL` if this is not wanted
+ * @returns `true` if the pixels were converted
+ * @returns `false` if the format, alpha mode or model is not valid, or memory
+ * could not be allocated
+ * @since `v0.6.0`
+ */
+bool colrcv_dedup_pixels_to_soa(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    double* a, double* b, double* c, double* alpha,
+    size_t count, size_t* converted
+);
+
+/**
+ * @brief Converts an array of packed pixels to an array of colour structs,
+ * converting each distinct pixel only once
+ * @details The colours may be stored in arrays of colour structs of the model
+ * converted to, such as `colrcv_lab_t`, or be fields of larger structs, by
+ * giving the distance in bytes between each colour. Otherwise, this is the
+ * same as `colrcv_dedup_pixels_to_soa()`.
+ * @param format The pixel format of the pixels
+ * @param alpha_mode The way that colour is stored with alpha in the pixels
+ * @param pixels Pointer to the first pixel to be converted
+ * @param to The colour model to convert to
+ * @param[out] output Pointer to write the first colour struct to
+ * @param output_stride Distance in bytes between each output colour
+ * @param[out] alpha Array to write the alpha of each pixel to, in range
+ * `0.0` to `1.0`. May be `NULL` if alpha is not wanted
+ * @param count The number of pixels to convert
+ * @param[out] converted Set to the number of colours that were actually
+ * converted. May be `NULL` if this is not wanted
+ * @returns `true` if the pixels were converted
+ * @returns `false` if the format, alpha mode or model is not valid, or memory
+ * could not be allocated
+ * @since `v0.6.0`
+ */
+bool colrcv_dedup_pixels_to_strided(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    void* output, size_t output_stride, double* alpha,
+    size_t count, size_t* converted
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
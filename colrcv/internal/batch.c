@@ -0,0 +1,360 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../colrcv.h"
+#include "../convert.h"
+#include "../models/rgb.h"
+#include "batch.h"
+#include "kernels.h"
+#include "simd.h"
+#include "stats.h"
+#include "tables.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// gathers the channels of each colour of a tile into channel arrays
+static void gather_tile(
+    const void* input, size_t input_stride, size_t start, size_t tile,
+    double* a, double* b, double* c
+) {
+    for(size_t i = 0; i < tile; i++) {
+        const double* colour = (const double*)(
+            (const char*)input + (start + i) * input_stride
+        );
+        a[i] = colour[0];
+        b[i] = colour[1];
+        c[i] = colour[2];
+    }
+}
+
+// gets the number of colours in the tile starting at `start`
+static size_t get_tile_size(size_t start, size_t count) {
+    const size_t remaining = count - start;
+    return (remaining < COLRCV_BATCH_TILE_SIZE)
+        ? remaining
+        : COLRCV_BATCH_TILE_SIZE;
+}
+
+void colrcv_batch_convert_strided(
+    colrcv_soa_conversion_t conversion,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(conversion, count);
+    // one array per channel, colours are converted in-place within these
+    double a[COLRCV_BATCH_TILE_SIZE];
+    double b[COLRCV_BATCH_TILE_SIZE];
+    double c[COLRCV_BATCH_TILE_SIZE];
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t tile = get_tile_size(start, count);
+        gather_tile(input, input_stride, start, tile, a, b, c);
+        conversion(a, b, c, a, b, c, tile);
+        // scatter the converted channels back out
+        for(size_t i = 0; i < tile; i++) {
+            double* colour = (double*)(
+                (char*)output + (start + i) * output_stride
+            );
+            colour[0] = a[i];
+            colour[1] = b[i];
+            colour[2] = c[i];
+        }
+    }
+    colrcv_stats_batch_end(begun);
+}
+
+void colrcv_batch_encode_rgb(
+    colrcv_soa_conversion_t to_linear,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    bool sixteen_bit, size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(to_linear, count);
+    colrcv_tables_build_linear_to_srgb();
+    // one array per channel, colours are converted in-place within these
+    double r[COLRCV_BATCH_TILE_SIZE];
+    double g[COLRCV_BATCH_TILE_SIZE];
+    double b[COLRCV_BATCH_TILE_SIZE];
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t tile = get_tile_size(start, count);
+        gather_tile(input, input_stride, start, tile, r, g, b);
+        to_linear(r, g, b, r, g, b, tile);
+        colrcv_stats_gamut(r, g, b, tile, 1.0);
+        // encode the linear channels straight into the output
+        for(size_t i = 0; i < tile; i++) {
+            char* colour = (char*)output + (start + i) * output_stride;
+            if(sixteen_bit) {
+                colrcv_rgb16_t* rgb = (colrcv_rgb16_t*)colour;
+                rgb->r = kernel_encode_rgb_code(r[i], 65535.0);
+                rgb->g = kernel_encode_rgb_code(g[i], 65535.0);
+                rgb->b = kernel_encode_rgb_code(b[i], 65535.0);
+            } else {
+                colrcv_rgb8_t* rgb = (colrcv_rgb8_t*)colour;
+                rgb->r = (uint8_t)kernel_encode_rgb_code(r[i], 255.0);
+                rgb->g = (uint8_t)kernel_encode_rgb_code(g[i], 255.0);
+                rgb->b = (uint8_t)kernel_encode_rgb_code(b[i], 255.0);
+            }
+        }
+    }
+    colrcv_stats_batch_end(begun);
+}
+
+void colrcv_batch_convert_chain(
+    const colrcv_soa_conversion_t* stages, size_t stage_count,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t tile = get_tile_size(start, count);
+        double* tx = x + start;
+        double* ty = y + start;
+        double* tz = z + start;
+        stages[0](a + start, b + start, c + start, tx, ty, tz, tile);
+        for(size_t s = 1; s < stage_count; s++) {
+            stages[s](tx, ty, tz, tx, ty, tz, tile);
+        }
+    }
+}
+
+void colrcv_batch_convert_float_soa(
+    colrcv_soa_conversion_t conversion,
+    const float* a, const float* b, const float* c,
+    float* x, float* y, float* z,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(conversion, count);
+    // one array per channel, colours are converted in-place within these
+    double ta[COLRCV_BATCH_TILE_SIZE];
+    double tb[COLRCV_BATCH_TILE_SIZE];
+    double tc[COLRCV_BATCH_TILE_SIZE];
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t tile = get_tile_size(start, count);
+        for(size_t i = 0; i < tile; i++) {
+            ta[i] = a[start + i];
+            tb[i] = b[start + i];
+            tc[i] = c[start + i];
+        }
+        conversion(ta, tb, tc, ta, tb, tc, tile);
+        for(size_t i = 0; i < tile; i++) {
+            x[start + i] = (float)ta[i];
+            y[start + i] = (float)tb[i];
+            z[start + i] = (float)tc[i];
+        }
+    }
+    colrcv_stats_batch_end(begun);
+}
+
+void colrcv_batch_convert_float_strided(
+    colrcv_soa_conversion_t conversion,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(conversion, count);
+    // one array per channel, colours are converted in-place within these
+    double a[COLRCV_BATCH_TILE_SIZE];
+    double b[COLRCV_BATCH_TILE_SIZE];
+    double c[COLRCV_BATCH_TILE_SIZE];
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t tile = get_tile_size(start, count);
+        for(size_t i = 0; i < tile; i++) {
+            const float* colour = (const float*)(
+                (const char*)input + (start + i) * input_stride
+            );
+            a[i] = colour[0];
+            b[i] = colour[1];
+            c[i] = colour[2];
+        }
+        conversion(a, b, c, a, b, c, tile);
+        for(size_t i = 0; i < tile; i++) {
+            float* colour = (float*)(
+                (char*)output + (start + i) * output_stride
+            );
+            colour[0] = (float)a[i];
+            colour[1] = (float)b[i];
+            colour[2] = (float)c[i];
+        }
+    }
+    colrcv_stats_batch_end(begun);
+}
+
+size_t colrcv_batch_validate(
+    colrcv_model_t model,
+    const double* a, const double* b, const double* c,
+    uint8_t* invalid, size_t count
+) {
+    double min[3], max[3];
+    colrcv_get_model_range(model, min, max);
+    const size_t found = colrcv_simd_find_out_of_range(
+        a, b, c, min, max, invalid, count
+    );
+    colrcv_stats_invalid(model, found);
+    return found;
+}
+
+void colrcv_batch_clamp(
+    colrcv_model_t model, double* a, double* b, double* c, size_t count
+) {
+    double min[3], max[3];
+    colrcv_get_model_range(model, min, max);
+    double* channels[3] = { a, b, c, };
+    for(size_t ch = 0; ch < 3; ch++) {
+        colrcv_stats_clamp_batch(
+            model, ch, channels[ch], count, min[ch], max[ch]
+        );
+        colrcv_simd_clamp(channels[ch], min[ch], max[ch], count);
+    }
+}
+
+void colrcv_batch_hsv_to_unit_rgb(
+    const double* h, const double* s, const double* v,
+    double* r, double* g, double* b,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_rgb_t rgb = kernel_hsv_to_unit_rgb(
+            (colrcv_hsv_t){ .h = h[i], .s = s[i], .v = v[i], }
+        );
+        r[i] = rgb.r;
+        g[i] = rgb.g;
+        b[i] = rgb.b;
+    }
+}
+
+void colrcv_batch_hsl_to_unit_rgb(
+    const double* h, const double* s, const double* l,
+    double* r, double* g, double* b,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_rgb_t rgb = kernel_hsl_to_unit_rgb(
+            (colrcv_hsl_t){ .h = h[i], .s = s[i], .l = l[i], }
+        );
+        r[i] = rgb.r;
+        g[i] = rgb.g;
+        b[i] = rgb.b;
+    }
+}
+
+void colrcv_batch_unit_rgb_to_hsv(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* v,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsv_t hsv = kernel_unit_rgb_to_hsv(r[i], g[i], b[i]);
+        h[i] = hsv.h;
+        s[i] = hsv.s;
+        v[i] = hsv.v;
+    }
+}
+
+void colrcv_batch_unit_rgb_to_hsl(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* l,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsl_t hsl = kernel_unit_rgb_to_hsl(r[i], g[i], b[i]);
+        h[i] = hsl.h;
+        s[i] = hsl.s;
+        l[i] = hsl.l;
+    }
+}
+
+// kernel_convert_rgb_for_xyz(), approximated in fast accuracy mode
+static void convert_channel_for_xyz(
+    const double* in, double* out, size_t count
+) {
+    if(colrcv_get_accuracy() == COLRCV_ACCURACY_FAST) {
+        if(out != in) {
+            for(size_t i = 0; i < count; i++) {
+                out[i] = in[i];
+            }
+        }
+        colrcv_simd_srgb_to_linear(out, count);
+    } else {
+        for(size_t i = 0; i < count; i++) {
+            out[i] = kernel_convert_rgb_for_xyz(in[i]);
+        }
+    }
+}
+
+void colrcv_batch_unit_rgb_to_xyz(
+    const double* r, const double* g, const double* b,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    convert_channel_for_xyz(r, x, count);
+    convert_channel_for_xyz(g, y, count);
+    convert_channel_for_xyz(b, z, count);
+    /*
+     * scale up to 0 -> 100 by multiplying, as the single-colour kernel does
+     * (dividing by 1/100 instead differs from it in the last bit for some
+     * values), then apply matrix transforms
+     */
+    for(size_t i = 0; i < count; i++) {
+        x[i] *= 100;
+        y[i] *= 100;
+        z[i] *= 100;
+    }
+    colrcv_simd_multiply_matrix(
+        KERNEL_RGB_TO_XYZ_MATRIX, 1.0, x, y, z, x, y, z, count
+    );
+}
+
+// in-place kernel_convert_xyz_for_rgb(), approximated in fast accuracy mode
+static void convert_channel_for_rgb(double* channel, size_t count) {
+    if(colrcv_get_accuracy() == COLRCV_ACCURACY_FAST) {
+        colrcv_simd_linear_to_srgb(channel, count);
+    } else {
+        for(size_t i = 0; i < count; i++) {
+            channel[i] = kernel_convert_xyz_for_rgb(channel[i]);
+        }
+    }
+}
+
+// clamps a channel to 0 -> 1
+static double clamp_unit(double c) {
+    c = (c > 1) ? 1 : c;
+    return (c < 0) ? 0 : c;
+}
+
+void colrcv_batch_xyz_to_unit_rgb(
+    const double* x, const double* y, const double* z,
+    double* r, double* g, double* b,
+    size_t count
+) {
+    // shrink larger numbers down and multiplex the values
+    colrcv_simd_multiply_matrix(
+        KERNEL_XYZ_TO_RGB_MATRIX, 100.0, x, y, z, r, g, b, count
+    );
+    convert_channel_for_rgb(r, count);
+    convert_channel_for_rgb(g, count);
+    convert_channel_for_rgb(b, count);
+    colrcv_stats_gamut(r, g, b, count, 1.0);
+    for(size_t i = 0; i < count; i++) {
+        r[i] = clamp_unit(r[i]);
+        g[i] = clamp_unit(g[i]);
+        b[i] = clamp_unit(b[i]);
+    }
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,167 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file declares the support functions shared by the batch
+ * conversion functions of each colour model.
+ *
+ * It is not part of the public API and is not installed.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_BATCH_H
+#define SAXBOPHONE_COLRCV_INTERNAL_BATCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../colrcv.h"
+#include "../convert.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * the number of colours converted at a time by the batch support functions,
+ * chosen so that a tile of three channels fits comfortably in L1 cache
+ */
+#define COLRCV_BATCH_TILE_SIZE 256
+
+/*
+ * converts `count` colours stored as structs of three doubles `input_stride`
+ * bytes apart, writing them as structs of three doubles `output_stride` bytes
+ * apart, using the given Structure-of-Arrays conversion function.
+ * colours are gathered into tiles of channel arrays, converted and scattered
+ * back, so `output` may be the same as `input` if the strides are equal.
+ */
+void colrcv_batch_convert_strided(
+    colrcv_soa_conversion_t conversion,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+);
+
+/*
+ * converts `count` colours stored as structs of three doubles `input_stride`
+ * bytes apart to linear rgb (0 -> 1) with the given Structure-of-Arrays
+ * conversion function, then encodes them as sRGB into `colrcv_rgb16_t` or
+ * `colrcv_rgb8_t` structs `output_stride` bytes apart, using the tables.
+ */
+void colrcv_batch_encode_rgb(
+    colrcv_soa_conversion_t to_linear,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    bool sixteen_bit, size_t count
+);
+
+/*
+ * converts `count` colours of channel arrays a, b, c to channel arrays x, y, z
+ * by running each of `stage_count` Structure-of-Arrays conversion functions in
+ * turn, the first from the input arrays and the rest in-place on the output
+ * arrays. this is done a tile at a time so that the tile stays in cache.
+ * output arrays may be the same as input arrays but must not otherwise overlap.
+ */
+void colrcv_batch_convert_chain(
+    const colrcv_soa_conversion_t* stages, size_t stage_count,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/*
+ * converts `count` single-precision colours of channel arrays a, b, c to
+ * channel arrays x, y, z using the given double-precision Structure-of-Arrays
+ * conversion function, a tile at a time, rounding each result to float.
+ * output arrays may be the same as input arrays but must not otherwise overlap.
+ */
+void colrcv_batch_convert_float_soa(
+    colrcv_soa_conversion_t conversion,
+    const float* a, const float* b, const float* c,
+    float* x, float* y, float* z,
+    size_t count
+);
+
+/*
+ * as colrcv_batch_convert_strided(), but for colours stored as structs of
+ * three floats, converted in double precision and rounded to float
+ */
+void colrcv_batch_convert_float_strided(
+    colrcv_soa_conversion_t conversion,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+);
+
+/*
+ * finds the colours of a model's channel arrays a, b, c which its _is_valid()
+ * function would find invalid, giving the number of them and setting their
+ * bits in `invalid` if it isn't NULL, as colrcv_simd_find_out_of_range()
+ */
+size_t colrcv_batch_validate(
+    colrcv_model_t model,
+    const double* a, const double* b, const double* c,
+    uint8_t* invalid, size_t count
+);
+
+// clamps a model's channel arrays a, b, c in-place as its _clamp() function
+void colrcv_batch_clamp(
+    colrcv_model_t model, double* a, double* b, double* c, size_t count
+);
+
+/*
+ * Structure-of-Arrays conversions between the HSV, HSL and XYZ models and rgb
+ * channels scaled down to 0 -> 1, used as stages by the conversions which
+ * would otherwise go through RGB, so as to skip scaling by 255 and back.
+ * they follow the current accuracy mode, and output arrays may be the same as
+ * input arrays but must not otherwise overlap.
+ */
+void colrcv_batch_hsv_to_unit_rgb(
+    const double* h, const double* s, const double* v,
+    double* r, double* g, double* b,
+    size_t count
+);
+
+void colrcv_batch_hsl_to_unit_rgb(
+    const double* h, const double* s, const double* l,
+    double* r, double* g, double* b,
+    size_t count
+);
+
+void colrcv_batch_unit_rgb_to_hsv(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* v,
+    size_t count
+);
+
+void colrcv_batch_unit_rgb_to_hsl(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* l,
+    size_t count
+);
+
+void colrcv_batch_unit_rgb_to_xyz(
+    const double* r, const double* g, const double* b,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+// also clamps the rgb channels to 0 -> 1
+void colrcv_batch_xyz_to_unit_rgb(
+    const double* x, const double* y, const double* z,
+    double* r, double* g, double* b,
+    size_t count
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,180 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file holds branch-free approximations of the maths used
+ * by the colour model transfer functions, used by the batch conversion
+ * functions in COLRCV_ACCURACY_FAST mode.
+ *
+ * The vector kernels in simd.c use exactly the same constants and order of
+ * operations as these scalar versions, so both give the same results (apart
+ * from FMA rounding).
+ *
+ * It is not part of the public API and is not installed.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_FASTMATH_H
+#define SAXBOPHONE_COLRCV_INTERNAL_FASTMATH_H
+
+#include <stdint.h>
+#include <string.h>
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// 2^52, adding this to a small whole number puts it in the low mantissa bits
+#define FASTMATH_TWO_POW_52 4503599627370496.0
+/*
+ * 1.5 * 2^52, adding this to a small number rounds it to the nearest whole
+ * number and puts that in the low mantissa bits, for negative numbers too
+ */
+#define FASTMATH_ROUNDING 6755399441055744.0
+// 1 / ln(2)
+#define FASTMATH_LOG2_E 1.4426950408889634
+// ln(2)
+#define FASTMATH_LN_2 0.6931471805599453
+// sqrt(2)
+#define FASTMATH_SQRT_2 1.4142135623730951
+/*
+ * added to a third of the bit pattern of x to give a first guess at cbrt(x),
+ * a third of the bits of 1.0 adjusted to give the smallest worst-case error
+ */
+#define FASTMATH_CBRT_MAGIC 0x2A9F7893782DA1CEULL
+
+static inline uint64_t fastmath_bits(double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+static inline double fastmath_from_bits(uint64_t bits) {
+    double x;
+    memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+/*
+ * log2(x) for finite x > 0, absolute error below 3e-9.
+ * x is split into 2^e * m with m in [sqrt(2)/2, sqrt(2)), and ln(m) is found
+ * from the series 2 * atanh(t) with t = (m - 1) / (m + 1), |t| < 0.172
+ */
+static inline double fastmath_log2(double x) {
+    const uint64_t bits = fastmath_bits(x);
+    // biased exponent converted to double without an int->double conversion
+    double e = fastmath_from_bits(
+        (bits >> 52) | fastmath_bits(FASTMATH_TWO_POW_52)
+    ) - FASTMATH_TWO_POW_52 - 1023;
+    // mantissa with a zero exponent, in the range [1, 2)
+    double m = fastmath_from_bits(
+        (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL
+    );
+    // halve the mantissa if needed to keep it close to 1
+    const double halve = (m > FASTMATH_SQRT_2) ? 1.0 : 0.0;
+    m = m * (1.0 - 0.5 * halve);
+    e = e + halve;
+    const double t = (m - 1.0) / (m + 1.0);
+    const double t2 = t * t;
+    const double series = 1.0 + t2 * (
+        1.0 / 3 + t2 * (1.0 / 5 + t2 * (1.0 / 7 + t2 * (1.0 / 9)))
+    );
+    return e + 2.0 * t * series * FASTMATH_LOG2_E;
+}
+
+/*
+ * 2^y, relative error below 8e-9, y clamped to the normal range of doubles.
+ * y is split into n + f with whole n and f in [-0.5, 0.5], 2^f is found from
+ * its Taylor series and 2^n is made directly from its bit pattern
+ */
+static inline double fastmath_exp2(double y) {
+    y = (y < -1022.0) ? -1022.0 : y;
+    y = (y > 1023.0) ? 1023.0 : y;
+    // round to nearest whole number
+    const double n = (y + FASTMATH_ROUNDING) - FASTMATH_ROUNDING;
+    const double f = (y - n) * FASTMATH_LN_2;
+    const double p = 1.0 + f * (1.0 + f * (1.0 / 2 + f * (1.0 / 6 + f * (
+        1.0 / 24 + f * (1.0 / 120 + f * (1.0 / 720 + f * (1.0 / 5040)))
+    ))));
+    // n + 1023 ends up in the low bits, which are shifted into the exponent
+    const uint64_t scale = fastmath_bits(n + 1023.0 + FASTMATH_ROUNDING) << 52;
+    return p * fastmath_from_bits(scale);
+}
+
+// x^p for finite x > 0
+static inline double fastmath_pow(double x, double p) {
+    return fastmath_exp2(p * fastmath_log2(x));
+}
+
+/*
+ * bits / 3 using only shifts and adds, as vector units have no 64-bit divide.
+ * this is bits * (1/4) * (1 + 1/4) * (1 + 1/16) * ... which is slightly low,
+ * but it is only used for a first guess so that doesn't matter
+ */
+static inline uint64_t fastmath_third_of_bits(uint64_t bits) {
+    uint64_t third = bits >> 2;
+    third += third >> 2;
+    third += third >> 4;
+    third += third >> 8;
+    third += third >> 16;
+    third += third >> 32;
+    return third;
+}
+
+/*
+ * cbrt(x) for finite x > 0, relative error below 2e-12.
+ * the first guess from the bit pattern is within about 3% and is refined with
+ * three steps of Newton's method, each of which squares the relative error
+ */
+static inline double fastmath_cbrt(double x) {
+    double y = fastmath_from_bits(
+        fastmath_third_of_bits(fastmath_bits(x)) + FASTMATH_CBRT_MAGIC
+    );
+    y = y * (2.0 / 3) + x / (3.0 * y * y);
+    y = y * (2.0 / 3) + x / (3.0 * y * y);
+    y = y * (2.0 / 3) + x / (3.0 * y * y);
+    return y;
+}
+
+/*
+ * approximation of kernel_convert_rgb_for_xyz(), relative error below 1e-8
+ * over 0 -> 1. both sides are evaluated and one is selected, so that it is
+ * branch-free
+ */
+static inline double fastmath_srgb_to_linear(double c) {
+    const double curve = fastmath_pow((c + 0.055) / 1.055, 2.4);
+    const double line = c / 12.92;
+    return (c > 0.04045) ? curve : line;
+}
+
+/*
+ * approximation of kernel_convert_xyz_for_rgb(), relative error below 1e-8
+ * over 0 -> 1, branch-free
+ */
+static inline double fastmath_linear_to_srgb(double c) {
+    const double curve = 1.055 * fastmath_pow(c, 1.0 / 2.4) - 0.055;
+    const double line = 12.92 * c;
+    return (c > 0.0031308) ? curve : line;
+}
+
+/*
+ * approximation of kernel_convert_xyz_for_lab(), relative error below 2e-12,
+ * branch-free
+ */
+static inline double fastmath_xyz_for_lab(double c) {
+    const double curve = fastmath_cbrt(c);
+    const double line = (7.787 * c) + (16.0 / 116);
+    return (c > 0.008856) ? curve : line;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
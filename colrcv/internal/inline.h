@@ -0,0 +1,35 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file is included by each model header when
+ * COLRCV_INLINE is defined (see colrcv.h). It includes every model header
+ * first, so that all of the types and declarations are known whichever of
+ * them was included first, and then the definitions of the scalar functions.
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_INLINE_H
+#define SAXBOPHONE_COLRCV_INTERNAL_INLINE_H
+
+#include "../colrcv.h"
+#include "../models/rgb.h"
+#include "../models/hsv.h"
+#include "../models/hsl.h"
+#include "../models/lab.h"
+#include "../models/xyz.h"
+#include "kernels.h"
+#include "scalar_rgb.h"
+#include "scalar_hsv.h"
+#include "scalar_hsl.h"
+#include "scalar_lab.h"
+#include "scalar_xyz.h"
+
+// end of header file
+#endif
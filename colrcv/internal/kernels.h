@@ -0,0 +1,838 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file holds the per-colour conversion kernels shared by
+ * the single-colour and batch conversion functions of each colour model.
+ *
+ * They are static inline so that the batch loops can inline them, which is
+ * not possible across translation units for the public functions.
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_KERNELS_H
+#define SAXBOPHONE_COLRCV_INTERNAL_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "../colrcv.h"
+#include "../models/rgb.h"
+#include "../models/hsv.h"
+#include "../models/hsl.h"
+#include "../models/lab.h"
+#include "../models/xyz.h"
+#include "stats.h"
+#include "tables.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * row-major matrices converting between linear RGB (sRGB primaries) and XYZ,
+ * shared with the batch conversion functions
+ */
+static const double KERNEL_RGB_TO_XYZ_MATRIX[9] = {
+    0.4124, 0.3576, 0.1805,
+    0.2126, 0.7152, 0.0722,
+    0.0193, 0.1192, 0.9505,
+};
+static const double KERNEL_XYZ_TO_RGB_MATRIX[9] = {
+     3.2406, -1.5372, -0.4986,
+    -0.9689,  1.8758,  0.0415,
+     0.0557, -0.2040,  1.0570,
+};
+
+/* BEGIN RGB kernels */
+
+// Scales down RGB amounts from 0->255 to 0->1
+static inline void kernel_scale_down_rgb(
+    colrcv_rgb_t rgb, double* restrict r, double* restrict g, double* restrict b
+) {
+    *r = rgb.r / 255;
+    *g = rgb.g / 255;
+    *b = rgb.b / 255;
+}
+
+// sets the minimum, maximum and delta for a given set of rgb amounts
+static inline void kernel_get_min_max_delta(
+    double r, double g, double b,
+    double* restrict min, double* restrict max, double* restrict delta
+) {
+    *min = colrcv_min(r, colrcv_min(g, b));
+    *max = colrcv_max(r, colrcv_max(g, b));
+    *delta = *max - *min;
+}
+
+// returns the hue amount of HSV/HSL for given r, g, b, max and delta
+static inline double kernel_get_hue_amount(
+    double r, double g, double b, double max, double delta
+) {
+    // set the hue based on delta and which channel had the highest value
+    // (http://wiki.secondlife.com/wiki/Color_conversion_scripts)
+    double hue;
+    if(r == max) {
+        hue = (g - b) / delta;
+    } else if(g == max) {
+        hue = 2 + (b - r) / delta;
+    } else { // b == max
+        hue = 4 + (r - g) / delta;
+    }
+    // adjust hue to be in the 0-360 range
+    hue *= 60;
+    // wrap-around the output value of hue if needed
+    if(hue < 0) {
+        hue += 360;
+    } else if(hue > 360) {
+        hue -= 360;
+    }
+    return hue;
+}
+
+/*
+ * Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=20#text20
+ * takes rgb channels already scaled down to 0 -> 1
+ */
+static inline colrcv_hsv_t kernel_unit_rgb_to_hsv(
+    double r, double g, double b
+) {
+    double min_channel, max_channel, delta_channel;
+    // get min and max of these channels and the delta of min and max
+    kernel_get_min_max_delta(
+        r, g, b, &min_channel, &max_channel, &delta_channel
+    );
+    // output variable
+    colrcv_hsv_t hsv;
+    // the value component is set to max_channel (upscaled to 0-100 range)
+    hsv.v = max_channel * 100;
+    // if delta is 0, this is an achromatic grey
+    if(delta_channel == 0) {
+        hsv.h = 0;
+        hsv.s = 0;
+    } else {
+        // set saturation and upscale to the 0-100 range
+        hsv.s = (delta_channel / max_channel) * 100;
+        // finally, set the hue
+        hsv.h = kernel_get_hue_amount(r, g, b, max_channel, delta_channel);
+    }
+    return hsv;
+}
+
+static inline colrcv_hsv_t kernel_rgb_to_hsv(colrcv_rgb_t rgb) {
+    double r, g, b;
+    // scale down each RGB channel
+    kernel_scale_down_rgb(rgb, &r, &g, &b);
+    return kernel_unit_rgb_to_hsv(r, g, b);
+}
+
+/*
+ * Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=18#text18
+ * takes rgb channels already scaled down to 0 -> 1
+ */
+static inline colrcv_hsl_t kernel_unit_rgb_to_hsl(
+    double r, double g, double b
+) {
+    double min_channel, max_channel, delta_channel;
+    // get min and max of these channels and the delta of min and max
+    kernel_get_min_max_delta(
+        r, g, b, &min_channel, &max_channel, &delta_channel
+    );
+    // output variable
+    colrcv_hsl_t hsl;
+    // the lightness component is set to the average of max and min of channels
+    hsl.l = (max_channel + min_channel) / 2 * 100;
+    // if delta is 0, this is an achromatic grey
+    if(delta_channel == 0) {
+        hsl.h = 0;
+        hsl.s = 0;
+    } else {
+        /*
+         * saturation is set differently depending on if lightness amount is
+         * less than or greater than half
+         */
+        if(hsl.l < 50) {
+            hsl.s = delta_channel / (max_channel + min_channel) * 100;
+        } else {
+            hsl.s = delta_channel / (2 - max_channel - min_channel) * 100;
+        }
+        // finally, set the hue
+        hsl.h = kernel_get_hue_amount(r, g, b, max_channel, delta_channel);
+    }
+    return hsl;
+}
+
+static inline colrcv_hsl_t kernel_rgb_to_hsl(colrcv_rgb_t rgb) {
+    double r, g, b;
+    // scale down each RGB channel
+    kernel_scale_down_rgb(rgb, &r, &g, &b);
+    return kernel_unit_rgb_to_hsl(r, g, b);
+}
+
+/*
+ * translates an rgb component into the range needed for converting to XYZ
+ */
+static inline double kernel_convert_rgb_for_xyz(double c) {
+    return (c > 0.04045) ? pow((c + 0.055) / 1.055, 2.4) : (c / 12.92);
+}
+
+/*
+ * scales an rgb channel down and translates it for converting to XYZ. whole
+ * numbers from 0 to 255 (all that 8-bit input can give) are looked up instead
+ */
+static inline double kernel_linearise_rgb(double c) {
+    if(c >= 0.0 && c <= 255.0 && c == (double)(uint8_t)c) {
+        return COLRCV_SRGB_TO_LINEAR_TABLE[(uint8_t)c];
+    }
+    return kernel_convert_rgb_for_xyz(c / 255);
+}
+
+// applies the matrix transforms to linear rgb channels scaled up to 0 -> 100
+static inline colrcv_xyz_t kernel_linear_rgb_to_xyz(
+    double r, double g, double b
+) {
+    const double* m = KERNEL_RGB_TO_XYZ_MATRIX;
+    return (colrcv_xyz_t){
+        .x = r * m[0] + g * m[1] + b * m[2],
+        .y = r * m[3] + g * m[4] + b * m[5],
+        .z = r * m[6] + g * m[7] + b * m[8],
+    };
+}
+
+// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=02#text2
+static inline colrcv_xyz_t kernel_rgb_to_xyz(colrcv_rgb_t rgb) {
+    // scale down and translate each channel
+    const double r = kernel_linearise_rgb(rgb.r) * 100;
+    const double g = kernel_linearise_rgb(rgb.g) * 100;
+    const double b = kernel_linearise_rgb(rgb.b) * 100;
+    return kernel_linear_rgb_to_xyz(r, g, b);
+}
+
+/*
+ * as kernel_rgb_to_xyz(), but for rgb channels already scaled down to 0 -> 1,
+ * as given by the HSV and HSL kernels
+ */
+static inline colrcv_xyz_t kernel_unit_rgb_to_xyz(colrcv_rgb_t rgb) {
+    return kernel_linear_rgb_to_xyz(
+        kernel_convert_rgb_for_xyz(rgb.r) * 100,
+        kernel_convert_rgb_for_xyz(rgb.g) * 100,
+        kernel_convert_rgb_for_xyz(rgb.b) * 100
+    );
+}
+
+// as kernel_rgb_to_xyz(), but every channel can be looked up
+static inline colrcv_xyz_t kernel_rgb8_to_xyz(colrcv_rgb8_t rgb) {
+    return kernel_linear_rgb_to_xyz(
+        COLRCV_SRGB_TO_LINEAR_TABLE[rgb.r] * 100,
+        COLRCV_SRGB_TO_LINEAR_TABLE[rgb.g] * 100,
+        COLRCV_SRGB_TO_LINEAR_TABLE[rgb.b] * 100
+    );
+}
+
+/* END RGB kernels */
+
+/* BEGIN HSV kernels */
+
+/*
+ * Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=21#text21
+ * gives rgb channels in the range 0 -> 1
+ */
+static inline colrcv_rgb_t kernel_hsv_to_unit_rgb(colrcv_hsv_t hsv) {
+    colrcv_rgb_t rgb = { .r = 0, .g = 0, .b = 0, };
+    // down-scale s and v input values first
+    const double s = hsv.s / 100;
+    const double v = hsv.v / 100;
+    // if saturation is 0 then all channels are a product of the value
+    if(s == 0) {
+        rgb.r = v;
+        rgb.g = v;
+        rgb.b = v;
+    } else {
+        // scale down H to be in range 0 -> 6
+        double scaled_h = hsv.h / 60;
+        // h value must be snapped to range 0.0 -> 6.0
+        if(scaled_h >= 6.0) {
+            scaled_h -= 6.0;
+        }
+        // floor convert to int
+        const uint16_t integer_h = (uint16_t)scaled_h;
+        // this further lot of temporaries are used in the channel multiplex
+        const double temp_a = v * (1.0 - s);
+        const double temp_b = v * (1.0 - s * (scaled_h - integer_h));
+        const double temp_c = v * (1.0 - s * (1.0 - (scaled_h - integer_h)));
+        // choose one of many different multiplexes based on value of integer_h
+        switch(integer_h % 6) {
+            case 0:
+                rgb.r = v;
+                rgb.g = temp_c;
+                rgb.b = temp_a;
+                break;
+            case 1:
+                rgb.r = temp_b;
+                rgb.g = v;
+                rgb.b = temp_a;
+                break;
+            case 2:
+                rgb.r = temp_a;
+                rgb.g = v;
+                rgb.b = temp_c;
+                break;
+            case 3:
+                rgb.r = temp_a;
+                rgb.g = temp_b;
+                rgb.b = v;
+                break;
+            case 4:
+                rgb.r = temp_c;
+                rgb.g = temp_a;
+                rgb.b = v;
+                break;
+            case 5:
+                rgb.r = v;
+                rgb.g = temp_a;
+                rgb.b = temp_b;
+                break;
+        }
+    }
+    return rgb;
+}
+
+static inline colrcv_rgb_t kernel_hsv_to_rgb(colrcv_hsv_t hsv) {
+    colrcv_rgb_t rgb = kernel_hsv_to_unit_rgb(hsv);
+    // up-scale output values to be in 0-255 range
+    rgb.r *= 255;
+    rgb.g *= 255;
+    rgb.b *= 255;
+    return rgb;
+}
+
+/*
+ * converts HSV to HSL directly, giving the same result as going through RGB.
+ * HSV's value is the largest rgb channel and the smallest is value * (1 - s),
+ * which is all that RGB->HSL needs besides the hue, which is unchanged
+ */
+static inline colrcv_hsl_t kernel_hsv_to_hsl(colrcv_hsv_t hsv) {
+    const double s = hsv.s / 100;
+    const double max_channel = hsv.v / 100;
+    const double min_channel = max_channel * (1.0 - s);
+    const double delta_channel = max_channel - min_channel;
+    colrcv_hsl_t hsl;
+    hsl.l = (max_channel + min_channel) / 2 * 100;
+    // if delta is 0, this is an achromatic grey
+    if(delta_channel == 0) {
+        hsl.h = 0;
+        hsl.s = 0;
+    } else {
+        if(hsl.l < 50) {
+            hsl.s = delta_channel / (max_channel + min_channel) * 100;
+        } else {
+            hsl.s = delta_channel / (2 - max_channel - min_channel) * 100;
+        }
+        // a hue of 360 is the same as 0, as RGB would give
+        hsl.h = (hsv.h >= 360) ? hsv.h - 360 : hsv.h;
+    }
+    return hsl;
+}
+
+/* END HSV kernels */
+
+/* BEGIN HSL kernels */
+
+// helper function for kernel_hsl_to_rgb
+static inline double kernel_hue_to_rgb(double a, double b, double h) {
+    if(h < 0) {
+        h += 1;
+    } else if(h > 1) {
+        h -= 1;
+    }
+    if((6 * h) < 1) {
+        return (a + (b - a) * 6 * h);
+    } else if((2 * h) < 1) {
+        return b;
+    } else if((3 * h) < 2) {
+        return (a + (b - a) * ((2.0 / 3) - h) * 6);
+    } else {
+        return a;
+    }
+}
+
+// gets the largest and smallest rgb channels (0 -> 1) of an HSL colour
+static inline void kernel_get_hsl_max_min(
+    double s, double l, double* restrict max, double* restrict min
+) {
+    *max = (l < 0.5) ? (l * (1 + s)) : ((l + s) - (s * l));
+    *min = 2 * l - *max;
+}
+
+/*
+ * Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=19#text19
+ * gives rgb channels in the range 0 -> 1
+ */
+static inline colrcv_rgb_t kernel_hsl_to_unit_rgb(colrcv_hsl_t hsl) {
+    colrcv_rgb_t rgb;
+    // if saturation is 0, it's an achromatic grey so return early
+    if(hsl.s == 0) {
+        rgb.r = hsl.l / 100;
+        rgb.g = hsl.l / 100;
+        rgb.b = hsl.l / 100;
+    } else {
+        // down-scale all channels
+        const double h = hsl.h / 360;
+        const double s = hsl.s / 100;
+        const double l = hsl.l / 100;
+        // get temporaries 'b' and 'a'
+        double temp_b, temp_a;
+        kernel_get_hsl_max_min(s, l, &temp_b, &temp_a);
+        // get component amounts with respect to hue and temporaries
+        rgb.r = kernel_hue_to_rgb(temp_a, temp_b, h + (1.0 / 3));
+        rgb.g = kernel_hue_to_rgb(temp_a, temp_b, h);
+        rgb.b = kernel_hue_to_rgb(temp_a, temp_b, h - (1.0 / 3));
+    }
+    return rgb;
+}
+
+static inline colrcv_rgb_t kernel_hsl_to_rgb(colrcv_hsl_t hsl) {
+    colrcv_rgb_t rgb = kernel_hsl_to_unit_rgb(hsl);
+    // up-scale output values to be in 0-255 range
+    rgb.r *= 255;
+    rgb.g *= 255;
+    rgb.b *= 255;
+    return rgb;
+}
+
+/*
+ * converts HSL to HSV directly, giving the same result as going through RGB.
+ * the largest and smallest rgb channels are the temporaries of HSL->RGB,
+ * which is all that RGB->HSV needs besides the hue, which is unchanged
+ */
+static inline colrcv_hsv_t kernel_hsl_to_hsv(colrcv_hsl_t hsl) {
+    double max_channel, min_channel;
+    kernel_get_hsl_max_min(
+        hsl.s / 100, hsl.l / 100, &max_channel, &min_channel
+    );
+    const double delta_channel = max_channel - min_channel;
+    colrcv_hsv_t hsv;
+    hsv.v = max_channel * 100;
+    /*
+     * if delta is 0, this is an achromatic grey. near white, rounding can
+     * leave it slightly negative instead
+     */
+    if(delta_channel <= 0) {
+        hsv.h = 0;
+        hsv.s = 0;
+    } else {
+        hsv.s = (delta_channel / max_channel) * 100;
+        // a hue of 360 is the same as 0, as RGB would give
+        hsv.h = (hsl.h >= 360) ? hsl.h - 360 : hsl.h;
+    }
+    return hsv;
+}
+
+/* END HSL kernels */
+
+/* BEGIN LAB kernels */
+
+// helper function for kernel_lab_to_xyz
+static inline double kernel_convert_lab_for_xyz(double c) {
+    // get c cubed, multiplying is much quicker than pow()
+    const double c_cubed = c * c * c;
+    // converted component depends on size of cubed component
+    return (c_cubed > 0.008856) ? c_cubed : ((c - 16.0 / 116.0) / 7.787);
+}
+
+// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=08#text8
+static inline colrcv_xyz_t kernel_lab_to_xyz(colrcv_lab_t lab) {
+    // skew input values
+    const double y = (lab.l + 16.0) / 116.0;
+    const double x = lab.a / 500.0 + y;
+    const double z = y - lab.b / 200.0;
+    // normalise components and adjust for observer calibration
+    return (colrcv_xyz_t){
+        .x = COLRCV_XYZ_X_REF_VALUE * kernel_convert_lab_for_xyz(x),
+        .y = COLRCV_XYZ_Y_REF_VALUE * kernel_convert_lab_for_xyz(y),
+        .z = COLRCV_XYZ_Z_REF_VALUE * kernel_convert_lab_for_xyz(z),
+    };
+}
+
+/* END LAB kernels */
+
+/* BEGIN XYZ kernels */
+
+// helper function for kernel_xyz_to_rgb
+static inline double kernel_convert_xyz_for_rgb(double c) {
+    return (c > 0.0031308) ? (1.055 * pow(c, 1.0 / 2.4) - 0.055) : (12.92 * c);
+}
+
+// TODO: This will be added as a public library function later
+// XXX: This bit (clamping) wasn't in EasyRGB's algorithm. A bit questionable.
+static inline void kernel_clamp_rgb(colrcv_rgb_t* rgb) {
+    rgb->r = (rgb->r > 255) ? 255 : rgb->r;
+    rgb->r = (rgb->r < 0) ? 0 : rgb->r;
+    rgb->g = (rgb->g > 255) ? 255 : rgb->g;
+    rgb->g = (rgb->g < 0) ? 0 : rgb->g;
+    rgb->b = (rgb->b > 255) ? 255 : rgb->b;
+    rgb->b = (rgb->b < 0) ? 0 : rgb->b;
+}
+
+// applies the matrix transforms, giving linear rgb channels in range 0 -> 1
+static inline colrcv_rgb_t kernel_xyz_to_linear_rgb(colrcv_xyz_t xyz) {
+    // shrink larger numbers downs
+    const double x = xyz.x / 100.0;
+    const double y = xyz.y / 100.0;
+    const double z = xyz.z / 100.0;
+    // multiplex the values
+    const double* m = KERNEL_XYZ_TO_RGB_MATRIX;
+    return (colrcv_rgb_t){
+        .r = x * m[0] + y * m[1] + z * m[2],
+        .g = x * m[3] + y * m[4] + z * m[5],
+        .b = x * m[6] + y * m[7] + z * m[8],
+    };
+}
+
+/*
+ * as kernel_xyz_to_rgb(), but gives rgb channels clamped to 0 -> 1, as taken
+ * by the HSV and HSL kernels
+ */
+static inline colrcv_rgb_t kernel_xyz_to_unit_rgb(colrcv_xyz_t xyz) {
+    const colrcv_rgb_t linear = kernel_xyz_to_linear_rgb(xyz);
+    colrcv_rgb_t rgb = {
+        .r = kernel_convert_xyz_for_rgb(linear.r),
+        .g = kernel_convert_xyz_for_rgb(linear.g),
+        .b = kernel_convert_xyz_for_rgb(linear.b),
+    };
+    colrcv_stats_gamut(&rgb.r, &rgb.g, &rgb.b, 1, 1.0);
+    rgb.r = (rgb.r > 1) ? 1 : rgb.r;
+    rgb.r = (rgb.r < 0) ? 0 : rgb.r;
+    rgb.g = (rgb.g > 1) ? 1 : rgb.g;
+    rgb.g = (rgb.g < 0) ? 0 : rgb.g;
+    rgb.b = (rgb.b > 1) ? 1 : rgb.b;
+    rgb.b = (rgb.b < 0) ? 0 : rgb.b;
+    return rgb;
+}
+
+// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=01#text1
+static inline colrcv_rgb_t kernel_xyz_to_rgb(colrcv_xyz_t xyz) {
+    const colrcv_rgb_t linear = kernel_xyz_to_linear_rgb(xyz);
+    // declare output variable
+    colrcv_rgb_t rgb;
+    // convert components and upscale
+    rgb.r = kernel_convert_xyz_for_rgb(linear.r) * 255.0;
+    rgb.g = kernel_convert_xyz_for_rgb(linear.g) * 255.0;
+    rgb.b = kernel_convert_xyz_for_rgb(linear.b) * 255.0;
+    // clamp components
+    colrcv_stats_gamut(&rgb.r, &rgb.g, &rgb.b, 1, 255.0);
+    kernel_clamp_rgb(&rgb);
+    return rgb;
+}
+
+/*
+ * kernel_convert_xyz_for_rgb() of a linear rgb channel (clamped to 0 -> 1),
+ * with the curved part interpolated from the tables, then scaled and rounded
+ * to an integer code from 0 to max_code.
+ * colrcv_tables_build_linear_to_srgb() must be called first
+ */
+static inline uint16_t kernel_encode_rgb_code(double c, double max_code) {
+    // NaN is also clamped to 0
+    c = (c > 1.0) ? 1.0 : c;
+    c = (c >= 0.0) ? c : 0.0;
+    const double* table = COLRCV_LINEAR_TO_SRGB_TABLE;
+    double position = c * COLRCV_LINEAR_TO_SRGB_TABLE_SIZE;
+    if(c < 1.0 / COLRCV_LINEAR_TO_SRGB_FINE_RANGE) {
+        table = COLRCV_LINEAR_TO_SRGB_FINE_TABLE;
+        position *= COLRCV_LINEAR_TO_SRGB_FINE_RANGE;
+    }
+    // c of exactly 1 uses the end of the last interval
+    size_t i = (size_t)position;
+    i = (i < COLRCV_LINEAR_TO_SRGB_TABLE_SIZE)
+        ? i
+        : COLRCV_LINEAR_TO_SRGB_TABLE_SIZE - 1;
+    const double fraction = position - (double)i;
+    const double curve = table[i] + fraction * (table[i + 1] - table[i]);
+    const double encoded = (c > 0.0031308) ? curve : (12.92 * c);
+    return (uint16_t)(encoded * max_code + 0.5);
+}
+
+// as kernel_xyz_to_rgb(), but output as 8-bit codes using the tables
+static inline colrcv_rgb8_t kernel_xyz_to_rgb8(colrcv_xyz_t xyz) {
+    const colrcv_rgb_t linear = kernel_xyz_to_linear_rgb(xyz);
+    colrcv_stats_gamut(&linear.r, &linear.g, &linear.b, 1, 1.0);
+    return (colrcv_rgb8_t){
+        .r = (uint8_t)kernel_encode_rgb_code(linear.r, 255.0),
+        .g = (uint8_t)kernel_encode_rgb_code(linear.g, 255.0),
+        .b = (uint8_t)kernel_encode_rgb_code(linear.b, 255.0),
+    };
+}
+
+// as kernel_xyz_to_rgb(), but output as 16-bit codes using the tables
+static inline colrcv_rgb16_t kernel_xyz_to_rgb16(colrcv_xyz_t xyz) {
+    const colrcv_rgb_t linear = kernel_xyz_to_linear_rgb(xyz);
+    colrcv_stats_gamut(&linear.r, &linear.g, &linear.b, 1, 1.0);
+    return (colrcv_rgb16_t){
+        .r = kernel_encode_rgb_code(linear.r, 65535.0),
+        .g = kernel_encode_rgb_code(linear.g, 65535.0),
+        .b = kernel_encode_rgb_code(linear.b, 65535.0),
+    };
+}
+
+// helper function for kernel_xyz_to_lab
+static inline double kernel_convert_xyz_for_lab(double c) {
+    // converted component needs the cube root of input if over a given size
+    return (c > 0.008856) ? pow(c, (1.0 / 3)) : (7.787 * c) + (16.0 / 116);
+}
+
+// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=07#text7
+static inline colrcv_lab_t kernel_xyz_to_lab(colrcv_xyz_t xyz) {
+    // skew and convert input values
+    const double x = kernel_convert_xyz_for_lab(xyz.x / COLRCV_XYZ_X_REF_VALUE);
+    const double y = kernel_convert_xyz_for_lab(xyz.y / COLRCV_XYZ_Y_REF_VALUE);
+    const double z = kernel_convert_xyz_for_lab(xyz.z / COLRCV_XYZ_Z_REF_VALUE);
+    // convert to LAB ranges
+    return (colrcv_lab_t){
+        .l = (116 * y) - 16,
+        .a = 500 * (x - y),
+        .b = 200 * (y - z),
+    };
+}
+
+/* END XYZ kernels */
+
+/* BEGIN 8-bit HSV and HSL kernels */
+
+/*
+ * these use only integer arithmetic, table lookups and selects, with no
+ * division or switches, so that compilers can vectorise loops over them.
+ * hue is in 1/65536ths of a turn
+ */
+
+// a whole turn of hue in 8.24 fixed point
+#define KERNEL_HUE_TURN ((int32_t)1 << 24)
+
+// the larger and smaller of two 8-bit channels
+static inline int32_t kernel_max8(int32_t a, int32_t b) {
+    return (a > b) ? a : b;
+}
+
+static inline int32_t kernel_min8(int32_t a, int32_t b) {
+    return (a < b) ? a : b;
+}
+
+// rounds x / 255 to the nearest whole number, for x from 0 to 255 * 255
+static inline uint32_t kernel_div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+/*
+ * gets the hue of 8-bit rgb channels, given the largest channel and the
+ * difference between the largest and smallest, which must not be 0
+ */
+static inline uint16_t kernel_get_hue16(
+    int32_t r, int32_t g, int32_t b, int32_t max, int32_t delta
+) {
+    /*
+     * start of the sixth of the turn picked by the largest channel, a whole
+     * turn for red so that the sum can't be negative
+     */
+    const int32_t base = (r == max)
+        ? KERNEL_HUE_TURN
+        : (g == max) ? KERNEL_HUE_TURN / 3 : (KERNEL_HUE_TURN * 2 + 1) / 3;
+    const int32_t difference = (r == max)
+        ? g - b
+        : (g == max) ? b - r : r - g;
+    const uint32_t hue = (uint32_t)(
+        base + difference * (int32_t)COLRCV_HUE_RECIPROCAL_TABLE[delta]
+    );
+    // rounded down to 16 bits, a whole turn wraps around to 0
+    return (uint16_t)((hue + 128) >> 8);
+}
+
+// scales a difference of 8-bit channels by a divisor from 1 to 510, to 0->255
+static inline uint8_t kernel_get_saturation8(
+    uint32_t difference, uint32_t divisor
+) {
+    return (uint8_t)(
+        (difference * COLRCV_SATURATION_RECIPROCAL_TABLE[divisor] + 32768) >> 16
+    );
+}
+
+static inline colrcv_hsv8_t kernel_rgb8_to_hsv8(colrcv_rgb8_t rgb) {
+    const int32_t max = kernel_max8(rgb.r, kernel_max8(rgb.g, rgb.b));
+    const int32_t min = kernel_min8(rgb.r, kernel_min8(rgb.g, rgb.b));
+    const int32_t delta = max - min;
+    // an achromatic grey has no hue or saturation
+    return (colrcv_hsv8_t){
+        .h = delta ? kernel_get_hue16(rgb.r, rgb.g, rgb.b, max, delta) : 0,
+        .s = delta ? kernel_get_saturation8(delta, max) : 0,
+        .v = (uint8_t)max,
+    };
+}
+
+static inline colrcv_hsl8_t kernel_rgb8_to_hsl8(colrcv_rgb8_t rgb) {
+    const int32_t max = kernel_max8(rgb.r, kernel_max8(rgb.g, rgb.b));
+    const int32_t min = kernel_min8(rgb.r, kernel_min8(rgb.g, rgb.b));
+    const int32_t delta = max - min;
+    const int32_t sum = max + min;
+    // saturation is relative to the sum for the darker half, as with doubles
+    const int32_t divisor = (sum < 255) ? sum : 510 - sum;
+    // an achromatic grey has no hue or saturation
+    return (colrcv_hsl8_t){
+        .h = delta ? kernel_get_hue16(rgb.r, rgb.g, rgb.b, max, delta) : 0,
+        .s = delta ? kernel_get_saturation8(delta, divisor) : 0,
+        .l = (uint8_t)((sum + 1) >> 1),
+    };
+}
+
+/*
+ * for each sixth of the hue circle, which of v, p, q and t (indexed in that
+ * order) each of the red, green and blue channels takes, as the switch in
+ * kernel_hsv_to_unit_rgb() does
+ */
+static const uint8_t KERNEL_HSV_SECTOR_CHANNELS[6][3] = {
+    { 0, 3, 1, }, { 2, 0, 1, }, { 1, 0, 3, },
+    { 1, 2, 0, }, { 3, 1, 0, }, { 0, 1, 2, },
+};
+
+static inline colrcv_rgb8_t kernel_hsv8_to_rgb8(colrcv_hsv8_t hsv) {
+    const uint32_t v = hsv.v;
+    const uint32_t s = hsv.s;
+    // sixth of the turn and 16-bit fraction of the way through it
+    const uint32_t scaled_h = (uint32_t)hsv.h * 6;
+    const uint32_t sector = scaled_h >> 16;
+    const uint32_t fraction = scaled_h & 0xFFFF;
+    const uint8_t channels[4] = {
+        (uint8_t)v,
+        (uint8_t)kernel_div255(v * (255 - s)),
+        (uint8_t)kernel_div255(v * (255 - ((s * fraction + 32768) >> 16))),
+        (uint8_t)kernel_div255(
+            v * (255 - ((s * (65536 - fraction) + 32768) >> 16))
+        ),
+    };
+    const uint8_t* select = KERNEL_HSV_SECTOR_CHANNELS[sector];
+    return (colrcv_rgb8_t){
+        .r = channels[select[0]],
+        .g = channels[select[1]],
+        .b = channels[select[2]],
+    };
+}
+
+// as kernel_hue_to_rgb(), with 8-bit channels and a 16-bit hue
+static inline uint8_t kernel_hue16_to_rgb8(
+    uint32_t a, uint32_t b, uint16_t h
+) {
+    const uint32_t scaled_h = (uint32_t)h * 6;
+    // up the first sixth, flat for the next two, down the fourth, then flat
+    const uint32_t rise = (scaled_h < 65536)
+        ? scaled_h
+        : (scaled_h < 3 * 65536)
+            ? 65536
+            : (scaled_h < 4 * 65536) ? 4 * 65536 - scaled_h : 0;
+    return (uint8_t)(a + (((b - a) * rise + 32768) >> 16));
+}
+
+static inline colrcv_rgb8_t kernel_hsl8_to_rgb8(colrcv_hsl8_t hsl) {
+    const uint32_t s = hsl.s;
+    const uint32_t l = hsl.l;
+    // largest and smallest channels, as kernel_get_hsl_max_min() gives
+    const uint32_t max = (l < 128)
+        ? kernel_div255(l * (255 + s))
+        : l + s - kernel_div255(l * s);
+    // rounding can leave max a little over twice l
+    const uint32_t min = (2 * l > max) ? 2 * l - max : 0;
+    // a third of a turn is 21845.33 in 16-bit hue
+    return (colrcv_rgb8_t){
+        .r = kernel_hue16_to_rgb8(min, max, (uint16_t)(hsl.h + 21845)),
+        .g = kernel_hue16_to_rgb8(min, max, hsl.h),
+        .b = kernel_hue16_to_rgb8(min, max, (uint16_t)(hsl.h - 21845)),
+    };
+}
+
+/* END 8-bit HSV and HSL kernels */
+
+/* BEGIN single-precision kernels */
+
+// widens a single-precision RGB colour to double precision
+static inline colrcv_rgb_t kernel_widen_rgb(colrcv_rgbf_t rgb) {
+    return (colrcv_rgb_t){ .r = rgb.r, .g = rgb.g, .b = rgb.b, };
+}
+
+// rounds a RGB colour to single precision
+static inline colrcv_rgbf_t kernel_narrow_rgb(colrcv_rgb_t rgb) {
+    return (colrcv_rgbf_t){
+        .r = (float)rgb.r,
+        .g = (float)rgb.g,
+        .b = (float)rgb.b,
+    };
+}
+
+// widens a single-precision HSV colour to double precision
+static inline colrcv_hsv_t kernel_widen_hsv(colrcv_hsvf_t hsv) {
+    return (colrcv_hsv_t){ .h = hsv.h, .s = hsv.s, .v = hsv.v, };
+}
+
+// rounds a HSV colour to single precision
+static inline colrcv_hsvf_t kernel_narrow_hsv(colrcv_hsv_t hsv) {
+    return (colrcv_hsvf_t){
+        .h = (float)hsv.h,
+        .s = (float)hsv.s,
+        .v = (float)hsv.v,
+    };
+}
+
+// widens a single-precision HSL colour to double precision
+static inline colrcv_hsl_t kernel_widen_hsl(colrcv_hslf_t hsl) {
+    return (colrcv_hsl_t){ .h = hsl.h, .s = hsl.s, .l = hsl.l, };
+}
+
+// rounds a HSL colour to single precision
+static inline colrcv_hslf_t kernel_narrow_hsl(colrcv_hsl_t hsl) {
+    return (colrcv_hslf_t){
+        .h = (float)hsl.h,
+        .s = (float)hsl.s,
+        .l = (float)hsl.l,
+    };
+}
+
+// widens a single-precision LAB colour to double precision
+static inline colrcv_lab_t kernel_widen_lab(colrcv_labf_t lab) {
+    return (colrcv_lab_t){ .l = lab.l, .a = lab.a, .b = lab.b, };
+}
+
+// rounds a LAB colour to single precision
+static inline colrcv_labf_t kernel_narrow_lab(colrcv_lab_t lab) {
+    return (colrcv_labf_t){
+        .l = (float)lab.l,
+        .a = (float)lab.a,
+        .b = (float)lab.b,
+    };
+}
+
+// widens a single-precision XYZ colour to double precision
+static inline colrcv_xyz_t kernel_widen_xyz(colrcv_xyzf_t xyz) {
+    return (colrcv_xyz_t){ .x = xyz.x, .y = xyz.y, .z = xyz.z, };
+}
+
+// rounds a XYZ colour to single precision
+static inline colrcv_xyzf_t kernel_narrow_xyz(colrcv_xyz_t xyz) {
+    return (colrcv_xyzf_t){
+        .x = (float)xyz.x,
+        .y = (float)xyz.y,
+        .z = (float)xyz.z,
+    };
+}
+
+/* END single-precision kernels */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,51 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file defines the helpers declared in colrcv.h, so that
+ * they can be compiled into the library by colrcv.c or inlined into the
+ * caller's code with COLRCV_INLINE (see colrcv.h).
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_SCALAR_H
+#define SAXBOPHONE_COLRCV_INTERNAL_SCALAR_H
+
+#include <stdbool.h>
+
+#include "../colrcv.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+COLRCV_SCALAR bool colrcv_range_valid(double min, double val, double max) {
+    return ((min <= val) && (val <= max));
+}
+
+COLRCV_SCALAR double colrcv_min(double a, double b) {
+    return (a < b) ? a : b;
+}
+
+COLRCV_SCALAR double colrcv_max(double a, double b) {
+    return (a > b) ? a : b;
+}
+
+COLRCV_SCALAR double colrcv_clamp(double value, double min, double max) {
+    // returning the minimum of the maximum is an easy way to clamp
+    return colrcv_min(max, colrcv_max(min, value));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
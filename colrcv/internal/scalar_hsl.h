@@ -0,0 +1,142 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file defines the scalar functions of the HSL model
+ * (validation, clamping and single-colour conversions), so that they can be
+ * compiled into the library by hsl.c or inlined into the caller's code with
+ * COLRCV_INLINE (see colrcv.h).
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_SCALAR_HSL_H
+#define SAXBOPHONE_COLRCV_INTERNAL_SCALAR_HSL_H
+
+#include <stdbool.h>
+
+#include "../colrcv.h"
+#include "../models/hsl.h"
+#include "../models/rgb.h"
+#include "../models/hsv.h"
+#include "../models/lab.h"
+#include "../models/xyz.h"
+#include "kernels.h"
+#include "stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+COLRCV_SCALAR bool colrcv_hsl_h_is_valid(colrcv_hsl_t hsl) {
+    return colrcv_range_valid(
+        COLRCV_HSL_MIN_VALUE, hsl.h, COLRCV_HSL_H_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_hsl_s_is_valid(colrcv_hsl_t hsl) {
+    return colrcv_range_valid(
+        COLRCV_HSL_MIN_VALUE, hsl.s, COLRCV_HSL_S_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_hsl_l_is_valid(colrcv_hsl_t hsl) {
+    return colrcv_range_valid(
+        COLRCV_HSL_MIN_VALUE, hsl.l, COLRCV_HSL_L_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_hsl_is_valid(colrcv_hsl_t hsl) {
+    // check that the value of each component is in range
+    const bool valid = (
+        colrcv_hsl_h_is_valid(hsl) &&
+        colrcv_hsl_s_is_valid(hsl) &&
+        colrcv_hsl_l_is_valid(hsl)
+    );
+    return colrcv_stats_valid(COLRCV_MODEL_HSL, valid);
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp(colrcv_hsl_t hsl) {
+    // run all clamping functions on the value
+    return colrcv_hsl_clamp_l(colrcv_hsl_clamp_s(colrcv_hsl_clamp_h(hsl)));
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp_h(colrcv_hsl_t hsl) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_HSL, 0, hsl.h, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_H_MAX_VALUE
+    );
+    // clamp hue
+    hsl.h = colrcv_clamp(hsl.h, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_H_MAX_VALUE);
+    return hsl;
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp_s(colrcv_hsl_t hsl) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_HSL, 1, hsl.s, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_S_MAX_VALUE
+    );
+    // clamp saturation
+    hsl.s = colrcv_clamp(hsl.s, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_S_MAX_VALUE);
+    return hsl;
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp_l(colrcv_hsl_t hsl) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_HSL, 2, hsl.l, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_L_MAX_VALUE
+    );
+    // clamp lightness
+    hsl.l = colrcv_clamp(hsl.l, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_L_MAX_VALUE);
+    return hsl;
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_hsl_to_rgb(colrcv_hsl_t hsl) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSL, COLRCV_MODEL_RGB);
+    return kernel_hsl_to_rgb(hsl);
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsl_to_hsv(colrcv_hsl_t hsl) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSL, COLRCV_MODEL_HSV);
+    return kernel_hsl_to_hsv(hsl);
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_hsl_to_lab(colrcv_hsl_t hsl) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSL, COLRCV_MODEL_LAB);
+    // Three-step conversion using HSL->RGB->XYZ->LAB, without scaling RGB
+    return kernel_xyz_to_lab(
+        kernel_unit_rgb_to_xyz(kernel_hsl_to_unit_rgb(hsl))
+    );
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_hsl_to_xyz(colrcv_hsl_t hsl) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSL, COLRCV_MODEL_XYZ);
+    // Two-step conversion using HSL->RGB and RGB->XYZ, without scaling RGB
+    return kernel_unit_rgb_to_xyz(kernel_hsl_to_unit_rgb(hsl));
+}
+
+COLRCV_SCALAR colrcv_rgbf_t colrcv_hslf_to_rgbf(colrcv_hslf_t hsl) {
+    return kernel_narrow_rgb(colrcv_hsl_to_rgb(kernel_widen_hsl(hsl)));
+}
+
+COLRCV_SCALAR colrcv_hsvf_t colrcv_hslf_to_hsvf(colrcv_hslf_t hsl) {
+    return kernel_narrow_hsv(colrcv_hsl_to_hsv(kernel_widen_hsl(hsl)));
+}
+
+COLRCV_SCALAR colrcv_labf_t colrcv_hslf_to_labf(colrcv_hslf_t hsl) {
+    return kernel_narrow_lab(colrcv_hsl_to_lab(kernel_widen_hsl(hsl)));
+}
+
+COLRCV_SCALAR colrcv_xyzf_t colrcv_hslf_to_xyzf(colrcv_hslf_t hsl) {
+    return kernel_narrow_xyz(colrcv_hsl_to_xyz(kernel_widen_hsl(hsl)));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,142 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file defines the scalar functions of the HSV model
+ * (validation, clamping and single-colour conversions), so that they can be
+ * compiled into the library by hsv.c or inlined into the caller's code with
+ * COLRCV_INLINE (see colrcv.h).
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_SCALAR_HSV_H
+#define SAXBOPHONE_COLRCV_INTERNAL_SCALAR_HSV_H
+
+#include <stdbool.h>
+
+#include "../colrcv.h"
+#include "../models/hsv.h"
+#include "../models/rgb.h"
+#include "../models/hsl.h"
+#include "../models/lab.h"
+#include "../models/xyz.h"
+#include "kernels.h"
+#include "stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+COLRCV_SCALAR bool colrcv_hsv_h_is_valid(colrcv_hsv_t hsv) {
+    return colrcv_range_valid(
+        COLRCV_HSV_MIN_VALUE, hsv.h, COLRCV_HSV_H_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_hsv_s_is_valid(colrcv_hsv_t hsv) {
+    return colrcv_range_valid(
+        COLRCV_HSV_MIN_VALUE, hsv.s, COLRCV_HSV_S_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_hsv_v_is_valid(colrcv_hsv_t hsv) {
+    return colrcv_range_valid(
+        COLRCV_HSV_MIN_VALUE, hsv.v, COLRCV_HSV_V_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_hsv_is_valid(colrcv_hsv_t hsv) {
+    // check that the value of each component is in range
+    const bool valid = (
+        colrcv_hsv_h_is_valid(hsv) &&
+        colrcv_hsv_s_is_valid(hsv) &&
+        colrcv_hsv_v_is_valid(hsv)
+    );
+    return colrcv_stats_valid(COLRCV_MODEL_HSV, valid);
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp(colrcv_hsv_t hsv) {
+    // run all clamping functions on the value
+    return colrcv_hsv_clamp_v(colrcv_hsv_clamp_s(colrcv_hsv_clamp_h(hsv)));
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp_h(colrcv_hsv_t hsv) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_HSV, 0, hsv.h, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_H_MAX_VALUE
+    );
+    // clamp hue
+    hsv.h = colrcv_clamp(hsv.h, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_H_MAX_VALUE);
+    return hsv;
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp_s(colrcv_hsv_t hsv) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_HSV, 1, hsv.s, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_S_MAX_VALUE
+    );
+    // clamp saturation
+    hsv.s = colrcv_clamp(hsv.s, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_S_MAX_VALUE);
+    return hsv;
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp_v(colrcv_hsv_t hsv) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_HSV, 2, hsv.v, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_V_MAX_VALUE
+    );
+    // clamp value
+    hsv.v = colrcv_clamp(hsv.v, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_V_MAX_VALUE);
+    return hsv;
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_hsv_to_rgb(colrcv_hsv_t hsv) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSV, COLRCV_MODEL_RGB);
+    return kernel_hsv_to_rgb(hsv);
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsv_to_hsl(colrcv_hsv_t hsv) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSV, COLRCV_MODEL_HSL);
+    return kernel_hsv_to_hsl(hsv);
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_hsv_to_lab(colrcv_hsv_t hsv) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSV, COLRCV_MODEL_LAB);
+    // Three-step conversion using HSV->RGB->XYZ->LAB, without scaling RGB
+    return kernel_xyz_to_lab(
+        kernel_unit_rgb_to_xyz(kernel_hsv_to_unit_rgb(hsv))
+    );
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_hsv_to_xyz(colrcv_hsv_t hsv) {
+    colrcv_stats_conversion(COLRCV_MODEL_HSV, COLRCV_MODEL_XYZ);
+    // Two-step conversion using HSV->RGB and RGB->XYZ, without scaling RGB
+    return kernel_unit_rgb_to_xyz(kernel_hsv_to_unit_rgb(hsv));
+}
+
+COLRCV_SCALAR colrcv_rgbf_t colrcv_hsvf_to_rgbf(colrcv_hsvf_t hsv) {
+    return kernel_narrow_rgb(colrcv_hsv_to_rgb(kernel_widen_hsv(hsv)));
+}
+
+COLRCV_SCALAR colrcv_hslf_t colrcv_hsvf_to_hslf(colrcv_hsvf_t hsv) {
+    return kernel_narrow_hsl(colrcv_hsv_to_hsl(kernel_widen_hsv(hsv)));
+}
+
+COLRCV_SCALAR colrcv_labf_t colrcv_hsvf_to_labf(colrcv_hsvf_t hsv) {
+    return kernel_narrow_lab(colrcv_hsv_to_lab(kernel_widen_hsv(hsv)));
+}
+
+COLRCV_SCALAR colrcv_xyzf_t colrcv_hsvf_to_xyzf(colrcv_hsvf_t hsv) {
+    return kernel_narrow_xyz(colrcv_hsv_to_xyz(kernel_widen_hsv(hsv)));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
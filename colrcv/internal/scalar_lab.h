@@ -0,0 +1,143 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file defines the scalar functions of the LAB model
+ * (validation, clamping and single-colour conversions), so that they can be
+ * compiled into the library by lab.c or inlined into the caller's code with
+ * COLRCV_INLINE (see colrcv.h).
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_SCALAR_LAB_H
+#define SAXBOPHONE_COLRCV_INTERNAL_SCALAR_LAB_H
+
+#include <stdbool.h>
+
+#include "../colrcv.h"
+#include "../models/lab.h"
+#include "../models/rgb.h"
+#include "../models/hsv.h"
+#include "../models/hsl.h"
+#include "../models/xyz.h"
+#include "kernels.h"
+#include "stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+COLRCV_SCALAR bool colrcv_lab_l_is_valid(colrcv_lab_t lab) {
+    return colrcv_range_valid(
+        COLRCV_LAB_L_MIN_VALUE, lab.l, COLRCV_LAB_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_lab_a_is_valid(colrcv_lab_t lab) {
+    return colrcv_range_valid(
+        COLRCV_LAB_A_MIN_VALUE, lab.a, COLRCV_LAB_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_lab_b_is_valid(colrcv_lab_t lab) {
+    return colrcv_range_valid(
+        COLRCV_LAB_B_MIN_VALUE, lab.b, COLRCV_LAB_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_lab_is_valid(colrcv_lab_t lab) {
+    // check that the value of each component is in range
+    const bool valid = (
+        colrcv_lab_l_is_valid(lab) &&
+        colrcv_lab_a_is_valid(lab) &&
+        colrcv_lab_b_is_valid(lab)
+    );
+    return colrcv_stats_valid(COLRCV_MODEL_LAB, valid);
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp(colrcv_lab_t lab) {
+    // run all clamping functions on the value
+    return colrcv_lab_clamp_b(colrcv_lab_clamp_a(colrcv_lab_clamp_l(lab)));
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp_l(colrcv_lab_t lab) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_LAB, 0, lab.l, COLRCV_LAB_L_MIN_VALUE, COLRCV_LAB_MAX_VALUE
+    );
+    // clamp lightness channel
+    lab.l = colrcv_clamp(lab.l, COLRCV_LAB_L_MIN_VALUE, COLRCV_LAB_MAX_VALUE);
+    return lab;
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp_a(colrcv_lab_t lab) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_LAB, 1, lab.a, COLRCV_LAB_A_MIN_VALUE, COLRCV_LAB_MAX_VALUE
+    );
+    // clamp a component channel
+    lab.a = colrcv_clamp(lab.a, COLRCV_LAB_A_MIN_VALUE, COLRCV_LAB_MAX_VALUE);
+    return lab;
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp_b(colrcv_lab_t lab) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_LAB, 2, lab.b, COLRCV_LAB_B_MIN_VALUE, COLRCV_LAB_MAX_VALUE
+    );
+    // clamp b component channel
+    lab.b = colrcv_clamp(lab.b, COLRCV_LAB_B_MIN_VALUE, COLRCV_LAB_MAX_VALUE);
+    return lab;
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_lab_to_rgb(colrcv_lab_t lab) {
+    colrcv_stats_conversion(COLRCV_MODEL_LAB, COLRCV_MODEL_RGB);
+    // Two-step conversion using LAB->XYZ and XYZ->RGB
+    return kernel_xyz_to_rgb(kernel_lab_to_xyz(lab));
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_lab_to_hsv(colrcv_lab_t lab) {
+    colrcv_stats_conversion(COLRCV_MODEL_LAB, COLRCV_MODEL_HSV);
+    // Three-step conversion using LAB->XYZ->RGB->HSV, without scaling RGB
+    const colrcv_rgb_t rgb = kernel_xyz_to_unit_rgb(kernel_lab_to_xyz(lab));
+    return kernel_unit_rgb_to_hsv(rgb.r, rgb.g, rgb.b);
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_lab_to_hsl(colrcv_lab_t lab) {
+    colrcv_stats_conversion(COLRCV_MODEL_LAB, COLRCV_MODEL_HSL);
+    // Three-step conversion using LAB->XYZ->RGB->HSL, without scaling RGB
+    const colrcv_rgb_t rgb = kernel_xyz_to_unit_rgb(kernel_lab_to_xyz(lab));
+    return kernel_unit_rgb_to_hsl(rgb.r, rgb.g, rgb.b);
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_lab_to_xyz(colrcv_lab_t lab) {
+    colrcv_stats_conversion(COLRCV_MODEL_LAB, COLRCV_MODEL_XYZ);
+    return kernel_lab_to_xyz(lab);
+}
+
+COLRCV_SCALAR colrcv_rgbf_t colrcv_labf_to_rgbf(colrcv_labf_t lab) {
+    return kernel_narrow_rgb(colrcv_lab_to_rgb(kernel_widen_lab(lab)));
+}
+
+COLRCV_SCALAR colrcv_hsvf_t colrcv_labf_to_hsvf(colrcv_labf_t lab) {
+    return kernel_narrow_hsv(colrcv_lab_to_hsv(kernel_widen_lab(lab)));
+}
+
+COLRCV_SCALAR colrcv_hslf_t colrcv_labf_to_hslf(colrcv_labf_t lab) {
+    return kernel_narrow_hsl(colrcv_lab_to_hsl(kernel_widen_lab(lab)));
+}
+
+COLRCV_SCALAR colrcv_xyzf_t colrcv_labf_to_xyzf(colrcv_labf_t lab) {
+    return kernel_narrow_xyz(colrcv_lab_to_xyz(kernel_widen_lab(lab)));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,139 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file defines the scalar functions of the RGB model
+ * (validation, clamping and single-colour conversions), so that they can be
+ * compiled into the library by rgb.c or inlined into the caller's code with
+ * COLRCV_INLINE (see colrcv.h).
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_SCALAR_RGB_H
+#define SAXBOPHONE_COLRCV_INTERNAL_SCALAR_RGB_H
+
+#include <stdbool.h>
+
+#include "../colrcv.h"
+#include "../models/rgb.h"
+#include "../models/hsv.h"
+#include "../models/hsl.h"
+#include "../models/lab.h"
+#include "../models/xyz.h"
+#include "kernels.h"
+#include "stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+COLRCV_SCALAR bool colrcv_rgb_r_is_valid(colrcv_rgb_t rgb) {
+    return colrcv_range_valid(
+        COLRCV_RGB_MIN_VALUE, rgb.r, COLRCV_RGB_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_rgb_g_is_valid(colrcv_rgb_t rgb) {
+    return colrcv_range_valid(
+        COLRCV_RGB_MIN_VALUE, rgb.g, COLRCV_RGB_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_rgb_b_is_valid(colrcv_rgb_t rgb) {
+    return colrcv_range_valid(
+        COLRCV_RGB_MIN_VALUE, rgb.b, COLRCV_RGB_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_rgb_is_valid(colrcv_rgb_t rgb) {
+    // check that the value of each component is in range
+    const bool valid = (
+        colrcv_rgb_r_is_valid(rgb) &&
+        colrcv_rgb_g_is_valid(rgb) &&
+        colrcv_rgb_b_is_valid(rgb)
+    );
+    return colrcv_stats_valid(COLRCV_MODEL_RGB, valid);
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp(colrcv_rgb_t rgb) {
+    // run all clamping functions on the value
+    return colrcv_rgb_clamp_b(colrcv_rgb_clamp_g(colrcv_rgb_clamp_r(rgb)));
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp_r(colrcv_rgb_t rgb) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_RGB, 0, rgb.r, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE
+    );
+    // clamp red channel
+    rgb.r = colrcv_clamp(rgb.r, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE);
+    return rgb;
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp_g(colrcv_rgb_t rgb) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_RGB, 1, rgb.g, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE
+    );
+    // clamp green channel
+    rgb.g = colrcv_clamp(rgb.g, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE);
+    return rgb;
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp_b(colrcv_rgb_t rgb) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_RGB, 2, rgb.b, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE
+    );
+    // clamp blue channel
+    rgb.b = colrcv_clamp(rgb.b, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE);
+    return rgb;
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_rgb_to_hsv(colrcv_rgb_t rgb) {
+    colrcv_stats_conversion(COLRCV_MODEL_RGB, COLRCV_MODEL_HSV);
+    return kernel_rgb_to_hsv(rgb);
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_rgb_to_hsl(colrcv_rgb_t rgb) {
+    colrcv_stats_conversion(COLRCV_MODEL_RGB, COLRCV_MODEL_HSL);
+    return kernel_rgb_to_hsl(rgb);
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_rgb_to_lab(colrcv_rgb_t rgb) {
+    colrcv_stats_conversion(COLRCV_MODEL_RGB, COLRCV_MODEL_LAB);
+    // Two-step conversion using RGB->XYZ and XYZ->LAB
+    return kernel_xyz_to_lab(kernel_rgb_to_xyz(rgb));
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_rgb_to_xyz(colrcv_rgb_t rgb) {
+    colrcv_stats_conversion(COLRCV_MODEL_RGB, COLRCV_MODEL_XYZ);
+    return kernel_rgb_to_xyz(rgb);
+}
+
+COLRCV_SCALAR colrcv_hsvf_t colrcv_rgbf_to_hsvf(colrcv_rgbf_t rgb) {
+    return kernel_narrow_hsv(colrcv_rgb_to_hsv(kernel_widen_rgb(rgb)));
+}
+
+COLRCV_SCALAR colrcv_hslf_t colrcv_rgbf_to_hslf(colrcv_rgbf_t rgb) {
+    return kernel_narrow_hsl(colrcv_rgb_to_hsl(kernel_widen_rgb(rgb)));
+}
+
+COLRCV_SCALAR colrcv_labf_t colrcv_rgbf_to_labf(colrcv_rgbf_t rgb) {
+    return kernel_narrow_lab(colrcv_rgb_to_lab(kernel_widen_rgb(rgb)));
+}
+
+COLRCV_SCALAR colrcv_xyzf_t colrcv_rgbf_to_xyzf(colrcv_rgbf_t rgb) {
+    return kernel_narrow_xyz(colrcv_rgb_to_xyz(kernel_widen_rgb(rgb)));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
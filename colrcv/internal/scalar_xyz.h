@@ -0,0 +1,142 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file defines the scalar functions of the XYZ model
+ * (validation, clamping and single-colour conversions), so that they can be
+ * compiled into the library by xyz.c or inlined into the caller's code with
+ * COLRCV_INLINE (see colrcv.h).
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_SCALAR_XYZ_H
+#define SAXBOPHONE_COLRCV_INTERNAL_SCALAR_XYZ_H
+
+#include <stdbool.h>
+
+#include "../colrcv.h"
+#include "../models/xyz.h"
+#include "../models/rgb.h"
+#include "../models/hsv.h"
+#include "../models/hsl.h"
+#include "../models/lab.h"
+#include "kernels.h"
+#include "stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+COLRCV_SCALAR bool colrcv_xyz_x_is_valid(colrcv_xyz_t xyz) {
+    return colrcv_range_valid(
+        COLRCV_XYZ_MIN_VALUE, xyz.x, COLRCV_XYZ_X_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_xyz_y_is_valid(colrcv_xyz_t xyz) {
+    return colrcv_range_valid(
+        COLRCV_XYZ_MIN_VALUE, xyz.y, COLRCV_XYZ_Y_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_xyz_z_is_valid(colrcv_xyz_t xyz) {
+    return colrcv_range_valid(
+        COLRCV_XYZ_MIN_VALUE, xyz.z, COLRCV_XYZ_Z_MAX_VALUE
+    );
+}
+
+COLRCV_SCALAR bool colrcv_xyz_is_valid(colrcv_xyz_t xyz) {
+    // check that the value of each component is in range
+    const bool valid = (
+        colrcv_xyz_x_is_valid(xyz) &&
+        colrcv_xyz_y_is_valid(xyz) &&
+        colrcv_xyz_z_is_valid(xyz)
+    );
+    return colrcv_stats_valid(COLRCV_MODEL_XYZ, valid);
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp(colrcv_xyz_t xyz) {
+    // run all clamping functions on the value
+    return colrcv_xyz_clamp_z(colrcv_xyz_clamp_y(colrcv_xyz_clamp_x(xyz)));
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp_x(colrcv_xyz_t xyz) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_XYZ, 0, xyz.x, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_X_MAX_VALUE
+    );
+    // clamp x channel
+    xyz.x = colrcv_clamp(xyz.x, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_X_MAX_VALUE);
+    return xyz;
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp_y(colrcv_xyz_t xyz) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_XYZ, 1, xyz.y, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_Y_MAX_VALUE
+    );
+    // clamp y channel
+    xyz.y = colrcv_clamp(xyz.y, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_Y_MAX_VALUE);
+    return xyz;
+}
+
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp_z(colrcv_xyz_t xyz) {
+    colrcv_stats_clamp(
+        COLRCV_MODEL_XYZ, 2, xyz.z, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_Z_MAX_VALUE
+    );
+    // clamp z channel
+    xyz.z = colrcv_clamp(xyz.z, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_Z_MAX_VALUE);
+    return xyz;
+}
+
+COLRCV_SCALAR colrcv_rgb_t colrcv_xyz_to_rgb(colrcv_xyz_t xyz) {
+    colrcv_stats_conversion(COLRCV_MODEL_XYZ, COLRCV_MODEL_RGB);
+    return kernel_xyz_to_rgb(xyz);
+}
+
+COLRCV_SCALAR colrcv_hsv_t colrcv_xyz_to_hsv(colrcv_xyz_t xyz) {
+    colrcv_stats_conversion(COLRCV_MODEL_XYZ, COLRCV_MODEL_HSV);
+    // Two-step conversion using XYZ->RGB and RGB->HSV, without scaling RGB
+    const colrcv_rgb_t rgb = kernel_xyz_to_unit_rgb(xyz);
+    return kernel_unit_rgb_to_hsv(rgb.r, rgb.g, rgb.b);
+}
+
+COLRCV_SCALAR colrcv_hsl_t colrcv_xyz_to_hsl(colrcv_xyz_t xyz) {
+    colrcv_stats_conversion(COLRCV_MODEL_XYZ, COLRCV_MODEL_HSL);
+    // Two-step conversion using XYZ->RGB and RGB->HSL, without scaling RGB
+    const colrcv_rgb_t rgb = kernel_xyz_to_unit_rgb(xyz);
+    return kernel_unit_rgb_to_hsl(rgb.r, rgb.g, rgb.b);
+}
+
+COLRCV_SCALAR colrcv_lab_t colrcv_xyz_to_lab(colrcv_xyz_t xyz) {
+    colrcv_stats_conversion(COLRCV_MODEL_XYZ, COLRCV_MODEL_LAB);
+    return kernel_xyz_to_lab(xyz);
+}
+
+COLRCV_SCALAR colrcv_rgbf_t colrcv_xyzf_to_rgbf(colrcv_xyzf_t xyz) {
+    return kernel_narrow_rgb(colrcv_xyz_to_rgb(kernel_widen_xyz(xyz)));
+}
+
+COLRCV_SCALAR colrcv_hsvf_t colrcv_xyzf_to_hsvf(colrcv_xyzf_t xyz) {
+    return kernel_narrow_hsv(colrcv_xyz_to_hsv(kernel_widen_xyz(xyz)));
+}
+
+COLRCV_SCALAR colrcv_hslf_t colrcv_xyzf_to_hslf(colrcv_xyzf_t xyz) {
+    return kernel_narrow_hsl(colrcv_xyz_to_hsl(kernel_widen_xyz(xyz)));
+}
+
+COLRCV_SCALAR colrcv_labf_t colrcv_xyzf_to_labf(colrcv_xyzf_t xyz) {
+    return kernel_narrow_lab(colrcv_xyz_to_lab(kernel_widen_xyz(xyz)));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
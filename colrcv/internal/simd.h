@@ -0,0 +1,95 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file declares the SIMD kernels used by the batch
+ * conversion functions, which dispatch at runtime to the instruction set
+ * chosen in simd.h
+ *
+ * It is not part of the public API and is not installed.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_SIMD_H
+#define SAXBOPHONE_COLRCV_INTERNAL_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// x86 CPU dispatch needs GCC-style target attributes and cpu builtins
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COLRCV_SIMD_X86
+#endif
+
+/*
+ * multiplies each colour of channel arrays a, b, c (each first divided by
+ * `divisor`) by the row-major 3x3 `matrix`, writing channel arrays x, y, z.
+ * output arrays may be the same as input arrays but must not otherwise overlap.
+ */
+void colrcv_simd_multiply_matrix(
+    const double matrix[9], double divisor,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/*
+ * in-place fast approximation of the sRGB transfer function (0 -> 1 encoded
+ * to 0 -> 1 linear light), see fastmath_srgb_to_linear() for its accuracy
+ */
+void colrcv_simd_srgb_to_linear(double* channel, size_t count);
+
+/*
+ * in-place fast approximation of the inverse sRGB transfer function, see
+ * fastmath_linear_to_srgb() for its accuracy
+ */
+void colrcv_simd_linear_to_srgb(double* channel, size_t count);
+
+/*
+ * in-place fast approximation of the XYZ->LAB companding function, see
+ * fastmath_xyz_for_lab() for its accuracy
+ */
+void colrcv_simd_xyz_for_lab(double* channel, size_t count);
+
+/*
+ * finds the colours of channel arrays a, b, c of which any channel is outside
+ * of its range min[ch] -> max[ch] (as colrcv_range_valid(), so including
+ * NaNs), giving the number of them. if `invalid` isn't NULL, bit i % 8 of
+ * byte i / 8 of it is set for each such colour i and cleared for the others,
+ * so it must hold (count + 7) / 8 bytes
+ */
+size_t colrcv_simd_find_out_of_range(
+    const double* a, const double* b, const double* c,
+    const double min[3], const double max[3],
+    uint8_t* invalid, size_t count
+);
+
+/*
+ * in-place colrcv_clamp() of each value of a channel array to min -> max,
+ * giving bit-identical results to it
+ */
+void colrcv_simd_clamp(double* channel, double min, double max, size_t count);
+
+/*
+ * multiplicative hash of each of `count` keys, giving the top `bits` bits
+ * (1 -> 31) of each key multiplied by a large odd constant
+ */
+void colrcv_simd_hash_keys(
+    const uint32_t* keys, uint32_t* hashes, unsigned int bits, size_t count
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,194 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file declares the hooks through which the conversion,
+ * clamping and validation functions count statistics (see stats.h).
+ * Each hook is inline and only calls into stats.c while statistics are on.
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_STATS_H
+#define SAXBOPHONE_COLRCV_INTERNAL_STATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../colrcv.h"
+#include "../convert.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * loads and stores of values shared between threads. these are atomic where
+ * the compiler has the builtins for it, but impose no ordering, so cost no
+ * more than plain loads and stores
+ */
+#ifdef __GNUC__
+#define COLRCV_STATS_LOAD(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define COLRCV_STATS_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#else
+#define COLRCV_STATS_LOAD(p) (*(p))
+#define COLRCV_STATS_STORE(p, v) (*(p) = (v))
+#endif
+
+// whether statistics are on, read with COLRCV_STATS_LOAD()
+extern bool colrcv_stats_enabled;
+
+/*
+ * whether the hooks below should count. scalar functions inlined into the
+ * caller's code with COLRCV_INLINE never count, so that they stay as cheap as
+ * the code they are inlined into and don't stop it being vectorised
+ */
+#ifdef COLRCV_INLINE
+#define COLRCV_STATS_ON() false
+#else
+#define COLRCV_STATS_ON() COLRCV_STATS_LOAD(&colrcv_stats_enabled)
+#endif
+
+/* BEGIN counting functions, only to be called while statistics are on */
+
+/*
+ * counts a call to a single-colour conversion, unless it's being done as part
+ * of a batch conversion
+ */
+void colrcv_stats_add_conversion(colrcv_model_t from, colrcv_model_t to);
+
+/*
+ * counts a call to a batch conversion of `count` colours, which is done by
+ * the given Structure-of-Arrays conversion function, unless it's being done
+ * as part of another batch conversion. if `conversion` is NULL nothing is
+ * counted, but conversions done until it is left aren't counted either.
+ * colrcv_stats_leave_batch() must be called when it is done if this returns
+ * true
+ */
+bool colrcv_stats_enter_batch(
+    colrcv_soa_conversion_t conversion, size_t count
+);
+
+void colrcv_stats_leave_batch(void);
+
+/*
+ * counts the channels of `count` RGB colours which are outside of the range
+ * 0 -> `max`, before they are clipped
+ */
+void colrcv_stats_add_gamut_clips(
+    const double* r, const double* g, const double* b, size_t count,
+    double max
+);
+
+// counts `count` channels out of range given to a clamping function
+void colrcv_stats_add_clamp(
+    colrcv_model_t model, size_t channel, uint64_t count
+);
+
+// counts `count` colours found invalid by a validation function
+void colrcv_stats_add_invalid(colrcv_model_t model, uint64_t count);
+
+/* END counting functions */
+
+// counts a call to a single-colour conversion
+static inline void colrcv_stats_conversion(
+    colrcv_model_t from, colrcv_model_t to
+) {
+    if(COLRCV_STATS_ON()) {
+        colrcv_stats_add_conversion(from, to);
+    }
+}
+
+/*
+ * counts a call to a batch conversion. the result must be given to
+ * colrcv_stats_batch_end() when the conversion is done
+ */
+static inline bool colrcv_stats_batch_begin(
+    colrcv_soa_conversion_t conversion, size_t count
+) {
+    return (
+        COLRCV_STATS_ON() &&
+        colrcv_stats_enter_batch(conversion, count)
+    );
+}
+
+/*
+ * marks the start of part of a batch conversion that was counted by
+ * colrcv_stats_batch_begin() on another thread, such as the tiles converted
+ * by the threads of a pool, so that the conversions done for it aren't
+ * counted again. the result must be given to colrcv_stats_batch_end()
+ */
+static inline bool colrcv_stats_part_begin(void) {
+    return COLRCV_STATS_ON() && colrcv_stats_enter_batch(NULL, 0);
+}
+
+static inline void colrcv_stats_batch_end(bool begun) {
+    if(begun) {
+        colrcv_stats_leave_batch();
+    }
+}
+
+// counts the channels of RGB colours about to be clipped to 0 -> `max`
+static inline void colrcv_stats_gamut(
+    const double* r, const double* g, const double* b, size_t count,
+    double max
+) {
+    if(COLRCV_STATS_ON()) {
+        colrcv_stats_add_gamut_clips(r, g, b, count, max);
+    }
+}
+
+// counts a channel about to be clamped, if it is out of range
+static inline void colrcv_stats_clamp(
+    colrcv_model_t model, size_t channel, double value, double min, double max
+) {
+    if(
+        COLRCV_STATS_ON() &&
+        !colrcv_range_valid(min, value, max)
+    ) {
+        colrcv_stats_add_clamp(model, channel, 1);
+    }
+}
+
+// counts the values of a channel array about to be clamped, if out of range
+static inline void colrcv_stats_clamp_batch(
+    colrcv_model_t model, size_t channel, const double* values, size_t count,
+    double min, double max
+) {
+    if(COLRCV_STATS_ON()) {
+        uint64_t clamped = 0;
+        for(size_t i = 0; i < count; i++) {
+            clamped += !colrcv_range_valid(min, values[i], max);
+        }
+        colrcv_stats_add_clamp(model, channel, clamped);
+    }
+}
+
+// counts a colour found invalid, giving back whether it is valid
+static inline bool colrcv_stats_valid(colrcv_model_t model, bool valid) {
+    if(!valid && COLRCV_STATS_ON()) {
+        colrcv_stats_add_invalid(model, 1);
+    }
+    return valid;
+}
+
+// counts a number of colours found invalid by a batch validation function
+static inline void colrcv_stats_invalid(colrcv_model_t model, size_t count) {
+    if(count > 0 && COLRCV_STATS_ON()) {
+        colrcv_stats_add_invalid(model, count);
+    }
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,274 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "tables.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * generated with pow() and printed with 17 significant digits, so that each
+ * value reads back exactly as kernel_convert_rgb_for_xyz() works it out
+ */
+const double COLRCV_SRGB_TO_LINEAR_TABLE[256] = {
+    0, 0.00030352698354883752, 0.00060705396709767503,
+    0.00091058095064651249, 0.0012141079341953501, 0.0015176349177441874,
+    0.001821161901293025, 0.0021246888848418626, 0.0024282158683907001,
+    0.0027317428519395373, 0.0030352698354883748, 0.0033465357638991608,
+    0.0036765073240474359, 0.0040247170184963066, 0.0043914420374102934,
+    0.0047769534806937292, 0.005181516702338386, 0.0056053916242027229,
+    0.0060488330228570539, 0.0065120907925944752, 0.0069954101872653869,
+    0.0074990320432261753, 0.0080231929853849943, 0.0085681256180693069,
+    0.0091340587022207872, 0.0097212173202378491, 0.010329823029626936,
+    0.010960094006488246, 0.011612245179743885, 0.012286488356915872,
+    0.012983032342173012, 0.013702083047289686, 0.014443843596092545,
+    0.015208514422912709, 0.015996293365509631, 0.016807375752887384,
+    0.017641954488384078, 0.018500220128379697, 0.019382360956935723,
+    0.020288563056652401, 0.021219010376003555, 0.022173884793387381,
+    0.02315336617811041, 0.024157632448504756, 0.02518685962736163,
+    0.026241221894849898, 0.027320891639074894, 0.028426039504420793,
+    0.0295568344378088, 0.030713443732993635, 0.031896033073011532,
+    0.033104766570885055, 0.03433980680868217, 0.035601314875020343,
+    0.036889450401100039, 0.038204371595346502, 0.039546235276732837,
+    0.040915196906853191, 0.042311410620809675, 0.043735029256973465,
+    0.045186204385675541, 0.046665086336880095, 0.048171824226889419,
+    0.049706565984127232, 0.051269458374043238, 0.052860647023180246,
+    0.054480276442442369, 0.056128490049600091, 0.057805430191067229,
+    0.059511238162981199, 0.061246054231617608, 0.063010017653167674,
+    0.064803266692905773, 0.066625938643772892, 0.068478169844400166,
+    0.070360095696595876, 0.072271850682317479, 0.074213568380149628,
+    0.076185381481307851, 0.078187421805186327, 0.080219820314468324,
+    0.082282707129814794, 0.084376211544148816, 0.086500462036549763,
+    0.088655586285772942, 0.090841711183407683, 0.093058962846687451,
+    0.095307466630964705, 0.097587347141862457, 0.099898728247113891,
+    0.10224173308810132, 0.10461648409110419, 0.10702310297826761,
+    0.10946171077829933, 0.1119324278369056, 0.11443537382697373,
+    0.11697066775851084, 0.11953842798834562, 0.12213877222960187,
+    0.12477181756095049, 0.12743768043564743, 0.13013647669036429,
+    0.13286832155381798, 0.13563332965520566, 0.13843161503245183,
+    0.14126329114027164, 0.14412847085805777, 0.14702726649759498,
+    0.14995978981060856, 0.15292615199615017, 0.1559264637078274,
+    0.15896083506088041, 0.16202937563911099, 0.16513219450166761,
+    0.16826940018969075, 0.17144110073282259, 0.17464740365558504,
+    0.17788841598362912, 0.18116424424986022, 0.184474994500441,
+    0.18782077230067787, 0.19120168274079138, 0.1946178304415758,
+    0.19806931955994886, 0.20155625379439707, 0.20507873639031693,
+    0.20863687014525575, 0.21223075741405523, 0.21586050011389926,
+    0.21952619972926921, 0.2232279573168085, 0.22696587351009836,
+    0.23074004852434915, 0.23455058216100522, 0.238397573812271,
+    0.24228112246555486, 0.24620132670783548, 0.25015828472995344,
+    0.25415209433082675, 0.25818285292159582, 0.26225065752969623,
+    0.26635560480286247, 0.27049779101306581, 0.27467731206038465,
+    0.2788942634768104, 0.28314874042999211, 0.28744083772691748,
+    0.29177064981753587, 0.29613827079832111, 0.3005437944157765,
+    0.30498731406988627, 0.30946892281750854, 0.31398871337571754,
+    0.31854677812509186, 0.32314320911295075, 0.32777809805654218,
+    0.33245153634617935, 0.33716361504833037, 0.34191442490866092,
+    0.3467040563550296, 0.35153259950043936, 0.35640014414594351,
+    0.3613067797835095, 0.36625259559883949, 0.37123768047414912,
+    0.3762621229909065, 0.38132601143253014, 0.38642943378704903,
+    0.39157247774972326, 0.39675523072562685, 0.40197777983219579,
+    0.4072402119017367, 0.41254261348390375, 0.41788507084813747,
+    0.42326766998607168, 0.42869049661390662, 0.43415363617474895,
+    0.43965717384091879, 0.44520119451622786, 0.45078578283822346,
+    0.45641102318040466, 0.46207699965440707, 0.46778379611215898,
+    0.47353149614800955, 0.4793201831008268, 0.48514994005607037,
+    0.49102084984783562, 0.49693299506087041, 0.50288645803256871,
+    0.50888132085493376, 0.51491766537652139, 0.5209955732043543,
+    0.52711512570581309, 0.53327640401050524, 0.53947948901210718,
+    0.5457244613701866, 0.55201140151200012, 0.55834038963426791,
+    0.56471150570492923, 0.57112482946487308, 0.57758044042965062,
+    0.5840784178911641, 0.59061884091933692, 0.59720178836376336,
+    0.60382733885533779, 0.61049557080786476, 0.61720656241965111,
+    0.62396039167507611, 0.63075713634614683, 0.63759687399403264,
+    0.64447968197058214, 0.65140563741982416, 0.65837481727944847,
+    0.66538729828227205, 0.67244315695768753, 0.67954246963309384,
+    0.6866853124353135, 0.69387176129198991, 0.70110189193297312,
+    0.70837577989168676, 0.71569350050648073, 0.72305512892196933,
+    0.73046074009035367, 0.73791040877273084, 0.74540420954038744,
+    0.75294221677607787, 0.76052450467529242, 0.76815114724750699,
+    0.7758222183174236, 0.78353779152619352, 0.79129794033263023,
+    0.79910273801440901, 0.8069522576692516, 0.81484657221610124,
+    0.82278575439628354, 0.83076987677465464, 0.83879901174074001,
+    0.84687323150985805, 0.85499260812423383, 0.86315721345410235,
+    0.87136711919879717, 0.87962239688783173, 0.88792311788196632,
+    0.89626935337426639, 0.90466117439114957, 0.9130986517934192,
+    0.92158185627729461, 0.93011085837542373, 0.938685728457888,
+    0.94730653673319987, 0.95597335324928612, 0.96468624789446511,
+    0.97344529039841254, 0.98225055033311715, 0.99110209711382979,
+    1,
+};
+
+/*
+ * round(255 * 2^16 / i), for scaling a difference of 8-bit channels by a
+ * channel or sum of two channels i, from 1 to 510, to 0 -> 255 saturation in
+ * 16.16 fixed point. entry 0 is never used
+ */
+const uint32_t COLRCV_SATURATION_RECIPROCAL_TABLE[511] = {
+    0, 16711680, 8355840, 5570560, 4177920, 3342336, 2785280,
+    2387383, 2088960, 1856853, 1671168, 1519244, 1392640, 1285514,
+    1193691, 1114112, 1044480, 983040, 928427, 879562, 835584,
+    795794, 759622, 726595, 696320, 668467, 642757, 618951,
+    596846, 576265, 557056, 539086, 522240, 506415, 491520,
+    477477, 464213, 451667, 439781, 428505, 417792, 407602,
+    397897, 388644, 379811, 371371, 363297, 355568, 348160,
+    341055, 334234, 327680, 321378, 315315, 309476, 303849,
+    298423, 293187, 288132, 283249, 278528, 273962, 269543,
+    265265, 261120, 257103, 253207, 249428, 245760, 242198,
+    238738, 235376, 232107, 228927, 225834, 222822, 219891,
+    217035, 214252, 211540, 208896, 206317, 203801, 201346,
+    198949, 196608, 194322, 192088, 189905, 187772, 185685,
+    183645, 181649, 179695, 177784, 175912, 174080, 172285,
+    170527, 168805, 167117, 165462, 163840, 162249, 160689,
+    159159, 157657, 156184, 154738, 153318, 151924, 150556,
+    149211, 147891, 146594, 145319, 144066, 142835, 141624,
+    140434, 139264, 138113, 136981, 135867, 134772, 133693,
+    132632, 131588, 130560, 129548, 128551, 127570, 126604,
+    125652, 124714, 123790, 122880, 121983, 121099, 120228,
+    119369, 118523, 117688, 116865, 116053, 115253, 114464,
+    113685, 112917, 112159, 111411, 110673, 109945, 109227,
+    108517, 107817, 107126, 106444, 105770, 105105, 104448,
+    103799, 103159, 102526, 101900, 101283, 100673, 100070,
+    99474, 98886, 98304, 97729, 97161, 96599, 96044,
+    95495, 94953, 94416, 93886, 93361, 92843, 92330,
+    91822, 91321, 90824, 90333, 89848, 89367, 88892,
+    88422, 87956, 87496, 87040, 86589, 86143, 85701,
+    85264, 84831, 84402, 83978, 83558, 83143, 82731,
+    82324, 81920, 81520, 81125, 80733, 80345, 79960,
+    79579, 79202, 78829, 78459, 78092, 77729, 77369,
+    77012, 76659, 76309, 75962, 75618, 75278, 74940,
+    74606, 74274, 73945, 73620, 73297, 72977, 72659,
+    72345, 72033, 71724, 71417, 71114, 70812, 70513,
+    70217, 69923, 69632, 69343, 69057, 68772, 68490,
+    68211, 67934, 67659, 67386, 67115, 66847, 66580,
+    66316, 66054, 65794, 65536, 65280, 65026, 64774,
+    64524, 64276, 64029, 63785, 63543, 63302, 63063,
+    62826, 62591, 62357, 62125, 61895, 61667, 61440,
+    61215, 60992, 60770, 60550, 60331, 60114, 59898,
+    59685, 59472, 59261, 59052, 58844, 58637, 58432,
+    58229, 58027, 57826, 57626, 57428, 57232, 57036,
+    56842, 56650, 56458, 56268, 56079, 55892, 55706,
+    55521, 55337, 55154, 54973, 54792, 54613, 54435,
+    54259, 54083, 53909, 53735, 53563, 53392, 53222,
+    53053, 52885, 52718, 52552, 52388, 52224, 52061,
+    51900, 51739, 51579, 51421, 51263, 51106, 50950,
+    50795, 50641, 50488, 50336, 50185, 50035, 49886,
+    49737, 49590, 49443, 49297, 49152, 49008, 48865,
+    48722, 48580, 48440, 48300, 48160, 48022, 47884,
+    47748, 47612, 47476, 47342, 47208, 47075, 46943,
+    46811, 46681, 46551, 46421, 46293, 46165, 46038,
+    45911, 45785, 45660, 45536, 45412, 45289, 45167,
+    45045, 44924, 44803, 44684, 44564, 44446, 44328,
+    44211, 44094, 43978, 43863, 43748, 43634, 43520,
+    43407, 43295, 43183, 43071, 42961, 42850, 42741,
+    42632, 42523, 42415, 42308, 42201, 42095, 41989,
+    41884, 41779, 41675, 41571, 41468, 41366, 41263,
+    41162, 41061, 40960, 40860, 40760, 40661, 40562,
+    40464, 40366, 40269, 40172, 40076, 39980, 39885,
+    39790, 39695, 39601, 39508, 39414, 39322, 39229,
+    39137, 39046, 38955, 38864, 38774, 38684, 38595,
+    38506, 38418, 38330, 38242, 38155, 38068, 37981,
+    37895, 37809, 37724, 37639, 37554, 37470, 37386,
+    37303, 37220, 37137, 37055, 36973, 36891, 36810,
+    36729, 36648, 36568, 36488, 36409, 36330, 36251,
+    36172, 36094, 36017, 35939, 35862, 35785, 35709,
+    35633, 35557, 35481, 35406, 35331, 35257, 35182,
+    35109, 35035, 34962, 34889, 34816, 34744, 34672,
+    34600, 34528, 34457, 34386, 34316, 34245, 34175,
+    34105, 34036, 33967, 33898, 33829, 33761, 33693,
+    33625, 33558, 33490, 33423, 33357, 33290, 33224,
+    33158, 33092, 33027, 32962, 32897, 32832, 32768,
+};
+
+/*
+ * round(2^24 / (6 * i)), for scaling a difference of 8-bit channels by a delta
+ * i, from 1 to 255, to a sixth of a turn of hue in 8.24 fixed point. entry 0
+ * is never used
+ */
+const uint32_t COLRCV_HUE_RECIPROCAL_TABLE[256] = {
+    0, 2796203, 1398101, 932068, 699051, 559241, 466034,
+    399458, 349525, 310689, 279620, 254200, 233017, 215093,
+    199729, 186414, 174763, 164483, 155345, 147169, 139810,
+    133153, 127100, 121574, 116508, 111848, 107546, 103563,
+    99864, 96421, 93207, 90200, 87381, 84733, 82241,
+    79892, 77672, 75573, 73584, 71698, 69905, 68200,
+    66576, 65028, 63550, 62138, 60787, 59494, 58254,
+    57065, 55924, 54828, 53773, 52759, 51782, 50840,
+    49932, 49056, 48210, 47393, 46603, 45839, 45100,
+    44384, 43691, 43019, 42367, 41734, 41121, 40525,
+    39946, 39383, 38836, 38304, 37787, 37283, 36792,
+    36314, 35849, 35395, 34953, 34521, 34100, 33689,
+    33288, 32897, 32514, 32140, 31775, 31418, 31069,
+    30728, 30394, 30067, 29747, 29434, 29127, 28827,
+    28533, 28244, 27962, 27685, 27414, 27148, 26887,
+    26631, 26379, 26133, 25891, 25653, 25420, 25191,
+    24966, 24745, 24528, 24315, 24105, 23899, 23697,
+    23498, 23302, 23109, 22920, 22733, 22550, 22370,
+    22192, 22017, 21845, 21676, 21509, 21345, 21183,
+    21024, 20867, 20713, 20560, 20410, 20262, 20117,
+    19973, 19831, 19692, 19554, 19418, 19284, 19152,
+    19022, 18893, 18766, 18641, 18518, 18396, 18276,
+    18157, 18040, 17924, 17810, 17697, 17586, 17476,
+    17368, 17261, 17155, 17050, 16947, 16845, 16744,
+    16644, 16546, 16448, 16352, 16257, 16163, 16070,
+    15978, 15888, 15798, 15709, 15621, 15534, 15449,
+    15364, 15280, 15197, 15115, 15033, 14953, 14873,
+    14795, 14717, 14640, 14564, 14488, 14413, 14340,
+    14266, 14194, 14122, 14051, 13981, 13911, 13843,
+    13774, 13707, 13640, 13574, 13508, 13443, 13379,
+    13315, 13252, 13190, 13128, 13066, 13006, 12945,
+    12886, 12827, 12768, 12710, 12653, 12596, 12539,
+    12483, 12428, 12373, 12318, 12264, 12210, 12157,
+    12105, 12053, 12001, 11950, 11899, 11848, 11798,
+    11749, 11700, 11651, 11603, 11555, 11507, 11460,
+    11413, 11367, 11321, 11275, 11230, 11185, 11140,
+    11096, 11052, 11009, 10966,
+};
+
+double COLRCV_LINEAR_TO_SRGB_TABLE[COLRCV_LINEAR_TO_SRGB_TABLE_SIZE + 1];
+double COLRCV_LINEAR_TO_SRGB_FINE_TABLE[COLRCV_LINEAR_TO_SRGB_TABLE_SIZE + 1];
+
+// fills the linear->sRGB tables, only ever called once
+static void build_linear_to_srgb(void) {
+    const double size = COLRCV_LINEAR_TO_SRGB_TABLE_SIZE;
+    const double fine_size = size * COLRCV_LINEAR_TO_SRGB_FINE_RANGE;
+    /*
+     * the curved part of the encoding is used for every entry, as the linear
+     * part near black is not looked up and this avoids interpolating across
+     * the join between the two parts
+     */
+    for(int i = 0; i <= COLRCV_LINEAR_TO_SRGB_TABLE_SIZE; i++) {
+        COLRCV_LINEAR_TO_SRGB_TABLE[i] = 1.055 * pow(i / size, 1.0 / 2.4)
+            - 0.055;
+        COLRCV_LINEAR_TO_SRGB_FINE_TABLE[i] = 1.055 * pow(
+            i / fine_size, 1.0 / 2.4
+        ) - 0.055;
+    }
+}
+
+static pthread_once_t linear_to_srgb_once = PTHREAD_ONCE_INIT;
+
+void colrcv_tables_build_linear_to_srgb(void) {
+    pthread_once(&linear_to_srgb_once, build_linear_to_srgb);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,77 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This private header file declares the lookup tables used by the conversion
+ * kernels.
+ *
+ * It is not part of the public API, but is installed for COLRCV_INLINE.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_INTERNAL_TABLES_H
+#define SAXBOPHONE_COLRCV_INTERNAL_TABLES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * kernel_convert_rgb_for_xyz(i / 255.0) for every whole number RGB channel
+ * value i, from 0 to 255
+ */
+extern const double COLRCV_SRGB_TO_LINEAR_TABLE[256];
+
+/*
+ * round(255 * 2^16 / i) for i from 1 to 510, used by the 8-bit HSV and HSL
+ * kernels to work out saturation without dividing
+ */
+extern const uint32_t COLRCV_SATURATION_RECIPROCAL_TABLE[511];
+
+/*
+ * round(2^24 / (6 * i)) for i from 1 to 255, used by the 8-bit HSV and HSL
+ * kernels to work out hue without dividing
+ */
+extern const uint32_t COLRCV_HUE_RECIPROCAL_TABLE[256];
+
+// number of intervals in each of the linear->sRGB tables
+#define COLRCV_LINEAR_TO_SRGB_TABLE_SIZE 4096
+/*
+ * the sRGB curve bends sharply near black, so linear values below 1 / this are
+ * looked up in a second table that is this many times finer
+ */
+#define COLRCV_LINEAR_TO_SRGB_FINE_RANGE 16
+
+/*
+ * the curved part of kernel_convert_xyz_for_rgb() for each linear value
+ * i / COLRCV_LINEAR_TO_SRGB_TABLE_SIZE, from 0 to 1 inclusive
+ */
+extern double COLRCV_LINEAR_TO_SRGB_TABLE[COLRCV_LINEAR_TO_SRGB_TABLE_SIZE + 1];
+
+// as COLRCV_LINEAR_TO_SRGB_TABLE, but only from 0 to 1 / the fine range
+extern double COLRCV_LINEAR_TO_SRGB_FINE_TABLE[
+    COLRCV_LINEAR_TO_SRGB_TABLE_SIZE + 1
+];
+
+/*
+ * fills the linear->sRGB tables the first time it is called, so that they
+ * only cost anything for callers asking for 8-bit or 16-bit RGB output.
+ * they are filled with pthread_once(), so any number of threads may call this
+ * at the same time, and all of them can read the tables once it returns.
+ */
+void colrcv_tables_build_linear_to_srgb(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
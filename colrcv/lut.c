@@ -0,0 +1,399 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "lut.h"
+#include "pool.h"
+#include "internal/stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+struct colrcv_lut_t {
+    // the model converted from
+    colrcv_model_t from;
+    // the model converted to
+    colrcv_model_t to;
+    // the number of grid points along each side
+    size_t size;
+    // the range of each input channel covered by the grid
+    double min[3];
+    double max[3];
+    // grid points per unit of each input channel
+    double scale[3];
+    // whether the first output channel is a hue, in range 0 -> 360
+    bool hue;
+    /*
+     * the converted colour at each grid point, three values each, with the
+     * first input channel changing slowest and the third changing fastest
+     */
+    double* table;
+};
+
+// identifies a serialised LUT, followed by the version of the format
+static const uint8_t SERIALISED_MAGIC[4] = { 'C', 'L', 'U', 'T', };
+static const uint32_t SERIALISED_VERSION = 1;
+// magic, version, from, to and size
+static const size_t SERIALISED_HEADER_SIZE = 20;
+
+/*
+ * allocates a LUT and works out everything but the contents of the table.
+ * returns NULL if the arguments are not valid or memory can't be allocated
+ */
+static colrcv_lut_t* create_lut(
+    colrcv_model_t from, colrcv_model_t to, size_t size
+) {
+    if(
+        colrcv_get_soa_conversion(from, to) == NULL ||
+        size < COLRCV_LUT_MIN_SIZE || size > COLRCV_LUT_MAX_SIZE
+    ) {
+        return NULL;
+    }
+    colrcv_lut_t* lut = malloc(sizeof(colrcv_lut_t));
+    if(lut == NULL) {
+        return NULL;
+    }
+    lut->table = malloc(size * size * size * 3 * sizeof(double));
+    if(lut->table == NULL) {
+        free(lut);
+        return NULL;
+    }
+    lut->from = from;
+    lut->to = to;
+    lut->size = size;
+    colrcv_get_model_range(from, lut->min, lut->max);
+    for(size_t i = 0; i < 3; i++) {
+        lut->scale[i] = (size - 1) / (lut->max[i] - lut->min[i]);
+    }
+    lut->hue = (to == COLRCV_MODEL_HSV) || (to == COLRCV_MODEL_HSL);
+    return lut;
+}
+
+// the number of grid points sampled by each batch conversion of a build
+#define BUILD_CHUNK_SIZE 256
+
+/*
+ * samples the grid points from `start` to `end` of a LUT into its table, a
+ * chunk at a time. called by colrcv_pool_for(), possibly on many threads at
+ * once, each with a scratch buffer of its own. chunks always start at
+ * multiples of BUILD_CHUNK_SIZE, so every point is converted the same way
+ * however the grid is split between threads
+ */
+static void build_range(void* context, size_t start, size_t end) {
+    colrcv_lut_t* lut = context;
+    const size_t size = lut->size;
+    const colrcv_soa_conversion_t conversion = colrcv_get_soa_conversion(
+        lut->from, lut->to
+    );
+    double a[BUILD_CHUNK_SIZE], b[BUILD_CHUNK_SIZE], c[BUILD_CHUNK_SIZE];
+    // sampling the grid is part of building it, not a conversion to count
+    const bool begun = colrcv_stats_part_begin();
+    while(start < end) {
+        size_t chunk_end = (start / BUILD_CHUNK_SIZE + 1) * BUILD_CHUNK_SIZE;
+        if(chunk_end > end) {
+            chunk_end = end;
+        }
+        const size_t count = chunk_end - start;
+        for(size_t n = 0; n < count; n++) {
+            const size_t point = start + n;
+            // the first input channel changes slowest, the third fastest
+            a[n] = lut->min[0] + (point / (size * size)) / lut->scale[0];
+            b[n] = lut->min[1] + (point / size % size) / lut->scale[1];
+            c[n] = lut->min[2] + (point % size) / lut->scale[2];
+        }
+        conversion(a, b, c, a, b, c, count);
+        double* points = lut->table + start * 3;
+        for(size_t n = 0; n < count; n++) {
+            points[n * 3 + 0] = a[n];
+            points[n * 3 + 1] = b[n];
+            points[n * 3 + 2] = c[n];
+        }
+        start = chunk_end;
+    }
+    colrcv_stats_batch_end(begun);
+}
+
+colrcv_lut_t* colrcv_lut_build(
+    colrcv_model_t from, colrcv_model_t to, size_t size, colrcv_pool_t* pool
+) {
+    colrcv_lut_t* lut = create_lut(from, to, size);
+    if(lut == NULL) {
+        return NULL;
+    }
+    colrcv_pool_for(pool, build_range, lut, size * size * size);
+    return lut;
+}
+
+void colrcv_lut_free(colrcv_lut_t* lut) {
+    if(lut != NULL) {
+        free(lut->table);
+        free(lut);
+    }
+}
+
+size_t colrcv_lut_get_size(const colrcv_lut_t* lut) {
+    return lut->size;
+}
+
+colrcv_model_t colrcv_lut_get_from(const colrcv_lut_t* lut) {
+    return lut->from;
+}
+
+colrcv_model_t colrcv_lut_get_to(const colrcv_lut_t* lut) {
+    return lut->to;
+}
+
+/*
+ * finds the grid cell that a value of an input channel is in and how far
+ * along the cell it is, clamping it to the grid
+ */
+static size_t find_cell(
+    const colrcv_lut_t* lut, size_t channel, double value, double* fraction
+) {
+    double position = (value - lut->min[channel]) * lut->scale[channel];
+    // NaN is also clamped to the start
+    position = (position >= 0.0) ? position : 0.0;
+    position = (position < lut->size - 1) ? position : lut->size - 1;
+    // the end of the grid uses the end of the last cell
+    size_t cell = (size_t)position;
+    cell = (cell < lut->size - 2) ? cell : lut->size - 2;
+    *fraction = position - cell;
+    return cell;
+}
+
+// moves a hue to within half a turn of a reference hue
+static double unwrap_hue(double hue, double reference) {
+    if(hue - reference > 180.0) {
+        return hue - 360.0;
+    }
+    if(reference - hue > 180.0) {
+        return hue + 360.0;
+    }
+    return hue;
+}
+
+// swaps two of the axes in an ordering of them
+static void swap_axes(size_t order[3], size_t a, size_t b) {
+    const size_t swap = order[a];
+    order[a] = order[b];
+    order[b] = swap;
+}
+
+// converts one colour using the LUT
+static void apply_lut(
+    const colrcv_lut_t* lut, colrcv_lut_interpolation_t interpolation,
+    const double input[3], double output[3]
+) {
+    double f[3];
+    const size_t i = find_cell(lut, 0, input[0], &f[0]);
+    const size_t j = find_cell(lut, 1, input[1], &f[1]);
+    const size_t k = find_cell(lut, 2, input[2], &f[2]);
+    // distances in the table between neighbouring grid points on each axis
+    const size_t step[3] = { lut->size * lut->size * 3, lut->size * 3, 3, };
+    const double* base = lut->table + i * step[0] + j * step[1] + k * step[2];
+    /*
+     * the axes in order of decreasing fraction, which picks out the
+     * tetrahedron of the cell that the colour is in
+     */
+    size_t order[3] = { 0, 1, 2, };
+    if(f[order[0]] < f[order[1]]) {
+        swap_axes(order, 0, 1);
+    }
+    if(f[order[1]] < f[order[2]]) {
+        swap_axes(order, 1, 2);
+    }
+    if(f[order[0]] < f[order[1]]) {
+        swap_axes(order, 0, 1);
+    }
+    for(size_t ch = 0; ch < 3; ch++) {
+        // the 8 corners of the cell, indexed by bits (first axis is bit 2)
+        double v[8];
+        for(size_t corner = 0; corner < 8; corner++) {
+            v[corner] = base[
+                ((corner >> 2) & 1) * step[0] +
+                ((corner >> 1) & 1) * step[1] +
+                (corner & 1) * step[2] + ch
+            ];
+        }
+        const bool is_hue = lut->hue && ch == 0;
+        if(is_hue) {
+            for(size_t corner = 1; corner < 8; corner++) {
+                v[corner] = unwrap_hue(v[corner], v[0]);
+            }
+        }
+        double result;
+        if(interpolation == COLRCV_LUT_TETRAHEDRAL) {
+            // walk from corner 0 to 7 along the edges, largest fraction first
+            const size_t c1 = (size_t)4 >> order[0];
+            const size_t c2 = c1 | ((size_t)4 >> order[1]);
+            result = v[0] +
+                f[order[0]] * (v[c1] - v[0]) +
+                f[order[1]] * (v[c2] - v[c1]) +
+                f[order[2]] * (v[7] - v[c2]);
+        } else {
+            // interpolate along the third, then second, then first axis
+            const double v00 = v[0] + f[2] * (v[1] - v[0]);
+            const double v01 = v[2] + f[2] * (v[3] - v[2]);
+            const double v10 = v[4] + f[2] * (v[5] - v[4]);
+            const double v11 = v[6] + f[2] * (v[7] - v[6]);
+            const double v0 = v00 + f[1] * (v01 - v00);
+            const double v1 = v10 + f[1] * (v11 - v10);
+            result = v0 + f[0] * (v1 - v0);
+        }
+        if(is_hue) {
+            result = (result < 0.0) ? result + 360.0 : result;
+            result = (result >= 360.0) ? result - 360.0 : result;
+        }
+        output[ch] = result;
+    }
+}
+
+void colrcv_lut_apply_soa(
+    const colrcv_lut_t* lut, colrcv_lut_interpolation_t interpolation,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        // read all of a colour before writing any
+        const double input[3] = { a[i], b[i], c[i], };
+        double output[3];
+        apply_lut(lut, interpolation, input, output);
+        x[i] = output[0];
+        y[i] = output[1];
+        z[i] = output[2];
+    }
+}
+
+void colrcv_lut_apply_strided(
+    const colrcv_lut_t* lut, colrcv_lut_interpolation_t interpolation,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const double* colour = (const double*)(
+            (const char*)input + i * input_stride
+        );
+        // read all of a colour before writing any
+        const double channels[3] = { colour[0], colour[1], colour[2], };
+        apply_lut(
+            lut, interpolation, channels,
+            (double*)((char*)output + i * output_stride)
+        );
+    }
+}
+
+/* BEGIN serialisation */
+
+// writes a 32-bit unsigned integer, little-endian
+static uint8_t* write_uint32(uint8_t* buffer, uint32_t value) {
+    for(size_t i = 0; i < 4; i++) {
+        buffer[i] = (uint8_t)(value >> (i * 8));
+    }
+    return buffer + 4;
+}
+
+// reads a 32-bit unsigned integer, little-endian
+static uint32_t read_uint32(const uint8_t* buffer) {
+    uint32_t value = 0;
+    for(size_t i = 0; i < 4; i++) {
+        value |= (uint32_t)buffer[i] << (i * 8);
+    }
+    return value;
+}
+
+// writes a double as its IEEE 754 bit pattern, little-endian
+static uint8_t* write_double(uint8_t* buffer, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for(size_t i = 0; i < 8; i++) {
+        buffer[i] = (uint8_t)(bits >> (i * 8));
+    }
+    return buffer + 8;
+}
+
+// reads a double from its IEEE 754 bit pattern, little-endian
+static double read_double(const uint8_t* buffer) {
+    uint64_t bits = 0;
+    for(size_t i = 0; i < 8; i++) {
+        bits |= (uint64_t)buffer[i] << (i * 8);
+    }
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+size_t colrcv_lut_serialised_size(const colrcv_lut_t* lut) {
+    return SERIALISED_HEADER_SIZE + lut->size * lut->size * lut->size * 3 * 8;
+}
+
+void colrcv_lut_serialise(const colrcv_lut_t* lut, uint8_t* buffer) {
+    memcpy(buffer, SERIALISED_MAGIC, sizeof(SERIALISED_MAGIC));
+    buffer += sizeof(SERIALISED_MAGIC);
+    buffer = write_uint32(buffer, SERIALISED_VERSION);
+    buffer = write_uint32(buffer, (uint32_t)lut->from);
+    buffer = write_uint32(buffer, (uint32_t)lut->to);
+    buffer = write_uint32(buffer, (uint32_t)lut->size);
+    const size_t values = lut->size * lut->size * lut->size * 3;
+    for(size_t i = 0; i < values; i++) {
+        buffer = write_double(buffer, lut->table[i]);
+    }
+}
+
+colrcv_lut_t* colrcv_lut_deserialise(const uint8_t* buffer, size_t length) {
+    if(
+        length < SERIALISED_HEADER_SIZE ||
+        memcmp(buffer, SERIALISED_MAGIC, sizeof(SERIALISED_MAGIC)) != 0 ||
+        read_uint32(buffer + 4) != SERIALISED_VERSION
+    ) {
+        return NULL;
+    }
+    const uint32_t from = read_uint32(buffer + 8);
+    const uint32_t to = read_uint32(buffer + 12);
+    const uint32_t size = read_uint32(buffer + 16);
+    // check these before converting them to enums or allocating anything
+    if(
+        from >= COLRCV_MODEL_COUNT || to >= COLRCV_MODEL_COUNT ||
+        size < COLRCV_LUT_MIN_SIZE || size > COLRCV_LUT_MAX_SIZE
+    ) {
+        return NULL;
+    }
+    const size_t values = (size_t)size * size * size * 3;
+    if(length < SERIALISED_HEADER_SIZE + values * 8) {
+        return NULL;
+    }
+    colrcv_lut_t* lut = create_lut(
+        (colrcv_model_t)from, (colrcv_model_t)to, size
+    );
+    if(lut == NULL) {
+        return NULL;
+    }
+    const uint8_t* data = buffer + SERIALISED_HEADER_SIZE;
+    for(size_t i = 0; i < values; i++) {
+        lut->table[i] = read_double(data + i * 8);
+    }
+    return lut;
+}
+
+/* END serialisation */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
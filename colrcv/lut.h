@@ -0,0 +1,205 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares functions for baking any conversion into a
+ * 3D lookup table (LUT) and applying it.
+ * @details A LUT samples a conversion on an evenly-spaced grid covering the
+ * 'standard' range of the input colour model (see `colrcv_get_model_range()`).
+ * Applying it interpolates between the 8 grid points surrounding each colour,
+ * which costs the same for every conversion, however many steps the direct
+ * conversion takes. Inputs outside of the range are clamped to it.
+ *
+ * A LUT with a size of 33 is accurate enough for most purposes, a size of 65
+ * is more accurate but needs 8 times the memory.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_LUT_H
+#define SAXBOPHONE_COLRCV_LUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "convert.h"
+#include "pool.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief An opaque 3D lookup table, made by `colrcv_lut_build()` or
+ * `colrcv_lut_deserialise()` and freed by `colrcv_lut_free()`
+ * @since `v0.6.0`
+ */
+typedef struct colrcv_lut_t colrcv_lut_t;
+
+/**
+ * @brief The ways of interpolating between the grid points of a LUT
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_lut_interpolation_t {
+    /** @brief Interpolate between all 8 surrounding grid points */
+    COLRCV_LUT_TRILINEAR = 0,
+    /**
+     * @brief Interpolate between the 4 surrounding grid points that form a
+     * tetrahedron around the colour
+     * @details This is quicker than trilinear interpolation.
+     */
+    COLRCV_LUT_TETRAHEDRAL,
+} colrcv_lut_interpolation_t;
+
+/**
+ * @brief The smallest number of grid points along each side of a LUT
+ * @since `v0.6.0`
+ */
+#define COLRCV_LUT_MIN_SIZE 2
+
+/**
+ * @brief The largest number of grid points along each side of a LUT
+ * @since `v0.6.0`
+ */
+#define COLRCV_LUT_MAX_SIZE 256
+
+/**
+ * @brief Builds a LUT for the conversion between two colour models
+ * @details The LUT is sampled with the batch conversion functions, so follows
+ * the current accuracy mode (see `colrcv_set_accuracy()`). When converting to
+ * HSV or HSL, hue is interpolated the short way around the colour wheel.
+ * @param from The colour model to convert from
+ * @param to The colour model to convert to
+ * @param size The number of grid points along each side of the LUT, from
+ * `COLRCV_LUT_MIN_SIZE` to `COLRCV_LUT_MAX_SIZE`. The LUT needs
+ * `size * size * size * 3 * sizeof(double)` bytes of memory.
+ * @param pool The pool to sample the grid points with, split between its
+ * threads. If this is `NULL`, they are all sampled on the calling thread. The
+ * LUT is exactly the same either way
+ * @returns A new LUT, which should be freed with `colrcv_lut_free()`
+ * @returns `NULL` if the models are the same or not valid, the size is out of
+ * range or memory could not be allocated
+ * @since `v0.6.0`
+ */
+colrcv_lut_t* colrcv_lut_build(
+    colrcv_model_t from, colrcv_model_t to, size_t size, colrcv_pool_t* pool
+);
+
+/**
+ * @brief Frees a LUT
+ * @param lut The LUT to free. Does nothing if this is `NULL`
+ * @since `v0.6.0`
+ */
+void colrcv_lut_free(colrcv_lut_t* lut);
+
+/**
+ * @brief Gets the number of grid points along each side of a LUT
+ * @since `v0.6.0`
+ */
+size_t colrcv_lut_get_size(const colrcv_lut_t* lut);
+
+/**
+ * @brief Gets the colour model that a LUT converts from
+ * @since `v0.6.0`
+ */
+colrcv_model_t colrcv_lut_get_from(const colrcv_lut_t* lut);
+
+/**
+ * @brief Gets the colour model that a LUT converts to
+ * @since `v0.6.0`
+ */
+colrcv_model_t colrcv_lut_get_to(const colrcv_lut_t* lut);
+
+/**
+ * @brief Converts an array of colours using a LUT
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param lut The LUT to convert with
+ * @param interpolation The way of interpolating between grid points
+ * @param a Array of the first channels of the colours to be converted
+ * @param b Array of the second channels of the colours to be converted
+ * @param c Array of the third channels of the colours to be converted
+ * @param[out] x Array to write the first channels of the converted colours to
+ * @param[out] y Array to write the second channels of the converted colours to
+ * @param[out] z Array to write the third channels of the converted colours to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_lut_apply_soa(
+    const colrcv_lut_t* lut, colrcv_lut_interpolation_t interpolation,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of colours using a LUT
+ * @details The colours may be stored in arrays of colour structs, such as
+ * `colrcv_rgb_t` and `colrcv_lab_t`, or be fields of larger structs, by giving
+ * the distance in bytes between each colour. The conversion may be done
+ * in-place by giving the same address and stride for input and output.
+ * @param lut The LUT to convert with
+ * @param interpolation The way of interpolating between grid points
+ * @param input Pointer to the first colour struct to be converted
+ * @param input_stride Distance in bytes between each input colour
+ * @param[out] output Pointer to write the first converted colour struct to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_lut_apply_strided(
+    const colrcv_lut_t* lut, colrcv_lut_interpolation_t interpolation,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Gets the number of bytes needed to serialise a LUT
+ * @since `v0.6.0`
+ */
+size_t colrcv_lut_serialised_size(const colrcv_lut_t* lut);
+
+/**
+ * @brief Serialises a LUT so that it can be saved and loaded again later
+ * @details The serialised form is the same on all platforms, so can be loaded
+ * on a different machine.
+ * @param lut The LUT to serialise
+ * @param[out] buffer Buffer to write to, which must be at least
+ * `colrcv_lut_serialised_size()` bytes long
+ * @since `v0.6.0`
+ */
+void colrcv_lut_serialise(const colrcv_lut_t* lut, uint8_t* buffer);
+
+/**
+ * @brief Loads a LUT that was serialised with `colrcv_lut_serialise()`
+ * @param buffer The serialised LUT
+ * @param length The length of the buffer in bytes
+ * @returns A new LUT, which should be freed with `colrcv_lut_free()`
+ * @returns `NULL` if the buffer does not hold a valid serialised LUT or memory
+ * could not be allocated
+ * @since `v0.6.0`
+ */
+colrcv_lut_t* colrcv_lut_deserialise(const uint8_t* buffer, size_t length);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
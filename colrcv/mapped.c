@@ -0,0 +1,216 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for mmap() and friends when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "mapped.h"
+#include "pool.h"
+#include "internal/batch.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * the number of pages' worth of pixels mapped at a time. a chunk is a whole
+ * number of pages of both files, whatever the size of their pixels
+ */
+#define CHUNK_PAGES 256
+
+// a chunk of pixels mapped from each file
+typedef struct mapped_chunk_t {
+    colrcv_raw_format_t format;
+    // NULL if the colours are only to be copied
+    colrcv_soa_conversion_t conversion;
+    const uint8_t* input;
+    float* output;
+} mapped_chunk_t;
+
+// gets the number of bytes in each pixel of a format
+static size_t get_pixel_size(colrcv_raw_format_t format) {
+    return (format == COLRCV_RAW_RGB8) ? 3 : 3 * sizeof(float);
+}
+
+// converts 8-bit RGB pixels from `start` up to `end` to floats
+static void convert_rgb8_range(
+    const mapped_chunk_t* chunk, size_t start, size_t end
+) {
+    // one array per channel, colours are converted in-place within these
+    double r[COLRCV_BATCH_TILE_SIZE];
+    double g[COLRCV_BATCH_TILE_SIZE];
+    double b[COLRCV_BATCH_TILE_SIZE];
+    for(size_t first = start; first < end; first += COLRCV_BATCH_TILE_SIZE) {
+        const size_t tile = (end - first < COLRCV_BATCH_TILE_SIZE)
+            ? end - first
+            : COLRCV_BATCH_TILE_SIZE;
+        const uint8_t* pixels = chunk->input + first * 3;
+        for(size_t i = 0; i < tile; i++) {
+            r[i] = pixels[i * 3];
+            g[i] = pixels[i * 3 + 1];
+            b[i] = pixels[i * 3 + 2];
+        }
+        if(chunk->conversion != NULL) {
+            chunk->conversion(r, g, b, r, g, b, tile);
+        }
+        float* colours = chunk->output + first * 3;
+        for(size_t i = 0; i < tile; i++) {
+            colours[i * 3] = (float)r[i];
+            colours[i * 3 + 1] = (float)g[i];
+            colours[i * 3 + 2] = (float)b[i];
+        }
+    }
+}
+
+// converts the pixels of a chunk from `start` up to `end`
+static void convert_range(void* context, size_t start, size_t end) {
+    const mapped_chunk_t* chunk = context;
+    const size_t colour_size = 3 * sizeof(float);
+    if(chunk->format == COLRCV_RAW_RGB8) {
+        convert_rgb8_range(chunk, start, end);
+    } else if(chunk->conversion != NULL) {
+        colrcv_batch_convert_float_strided(
+            chunk->conversion,
+            chunk->input + start * colour_size, colour_size,
+            chunk->output + start * 3, colour_size,
+            end - start
+        );
+    } else {
+        memcpy(
+            chunk->output + start * 3, chunk->input + start * colour_size,
+            (end - start) * colour_size
+        );
+    }
+}
+
+/*
+ * maps, converts and unmaps each chunk of the files in turn.
+ * returns false if a chunk could not be mapped
+ */
+static bool convert_chunks(
+    int input_file, int output_file, mapped_chunk_t chunk,
+    size_t count, colrcv_pool_t* pool
+) {
+    const size_t input_size = get_pixel_size(chunk.format);
+    const size_t output_size = 3 * sizeof(float);
+    const long page_size = sysconf(_SC_PAGESIZE);
+    const size_t chunk_pixels = (size_t)(
+        (page_size > 0) ? page_size : 4096
+    ) * CHUNK_PAGES;
+    for(size_t start = 0; start < count; start += chunk_pixels) {
+        const size_t pixels = (count - start < chunk_pixels)
+            ? count - start
+            : chunk_pixels;
+        const off_t input_offset = (off_t)start * (off_t)input_size;
+        const off_t output_offset = (off_t)start * (off_t)output_size;
+        void* input = mmap(
+            NULL, pixels * input_size, PROT_READ, MAP_SHARED,
+            input_file, input_offset
+        );
+        void* output = mmap(
+            NULL, pixels * output_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            output_file, output_offset
+        );
+        const bool mapped = input != MAP_FAILED && output != MAP_FAILED;
+        if(mapped) {
+            posix_madvise(
+                input, pixels * input_size, POSIX_MADV_SEQUENTIAL
+            );
+            posix_madvise(
+                output, pixels * output_size, POSIX_MADV_SEQUENTIAL
+            );
+            chunk.input = input;
+            chunk.output = output;
+            colrcv_pool_for(pool, convert_range, &chunk, pixels);
+            // start writing the output back now, rather than all at the end
+            msync(output, pixels * output_size, MS_ASYNC);
+        }
+        if(input != MAP_FAILED) {
+            munmap(input, pixels * input_size);
+        }
+        if(output != MAP_FAILED) {
+            munmap(output, pixels * output_size);
+        }
+        if(!mapped) {
+            return false;
+        }
+#ifdef POSIX_FADV_DONTNEED
+        // the input won't be read again, so needn't stay in the page cache
+        posix_fadvise(
+            input_file, input_offset, (off_t)(pixels * input_size),
+            POSIX_FADV_DONTNEED
+        );
+#endif
+    }
+    return true;
+}
+
+bool colrcv_raw_convert_file(
+    const char* input_path, colrcv_raw_format_t format, colrcv_model_t from,
+    const char* output_path, colrcv_model_t to, colrcv_pool_t* pool
+) {
+    if(
+        (format != COLRCV_RAW_RGB8 && format != COLRCV_RAW_FLOAT) ||
+        !colrcv_model_is_valid(from) || !colrcv_model_is_valid(to) ||
+        (format == COLRCV_RAW_RGB8 && from != COLRCV_MODEL_RGB)
+    ) {
+        return false;
+    }
+    const size_t input_size = get_pixel_size(format);
+    const int input_file = open(input_path, O_RDONLY);
+    if(input_file == -1) {
+        return false;
+    }
+    struct stat status;
+    if(
+        fstat(input_file, &status) != 0 ||
+        (size_t)status.st_size % input_size != 0
+    ) {
+        close(input_file);
+        return false;
+    }
+    const size_t count = (size_t)status.st_size / input_size;
+    const int output_file = open(
+        output_path, O_RDWR | O_CREAT | O_TRUNC, 0666
+    );
+    if(output_file == -1) {
+        close(input_file);
+        return false;
+    }
+    const mapped_chunk_t chunk = {
+        .format = format,
+        .conversion = colrcv_get_soa_conversion(from, to),
+        .input = NULL, .output = NULL,
+    };
+    // the output must be its full size before it can be mapped
+    bool success = ftruncate(
+        output_file, (off_t)(count * 3 * sizeof(float))
+    ) == 0 && convert_chunks(input_file, output_file, chunk, count, pool);
+    close(input_file);
+    success = (close(output_file) == 0) && success;
+    return success;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,94 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares functions for converting raw files of
+ * pixels by mapping them into memory.
+ * @details A raw file is nothing but pixels, each of three channels stored
+ * one after the other, with no header. The batch conversion runs straight
+ * over the mapped files, so the pixels are never copied into buffers by
+ * `read()` or into arrays of colour structs.
+ *
+ * The files are mapped a chunk at a time, with the operating system told that
+ * they are read in order. Each chunk of the input is dropped from the page
+ * cache once it has been converted and each chunk of the output is queued to
+ * be written back, so that converting a file much bigger than memory does not
+ * push everything else out of the page cache.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_MAPPED_H
+#define SAXBOPHONE_COLRCV_MAPPED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "convert.h"
+#include "pool.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief The ways that the pixels of a raw file can be stored
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_raw_format_t {
+    /**
+     * @brief Three 8-bit RGB channels, as in `colrcv_rgb8_t`
+     * @details Can only be used for RGB colours.
+     */
+    COLRCV_RAW_RGB8 = 0,
+    /**
+     * @brief Three native-endian 32-bit floats, as in `colrcv_rgbf_t` and
+     * the other single-precision colour structs
+     */
+    COLRCV_RAW_FLOAT,
+} colrcv_raw_format_t;
+
+/**
+ * @brief Converts a raw file of pixels to a raw file of floats
+ * @details The output file is created, or replaced if it exists, and holds
+ * the converted colours as `COLRCV_RAW_FLOAT` pixels. The batch conversion
+ * functions are used, so this follows the current accuracy mode.
+ * @param input_path The path of the file to convert
+ * @param format The way the pixels of the input file are stored
+ * @param from The colour model of the input pixels, which must be
+ * `COLRCV_MODEL_RGB` for `COLRCV_RAW_RGB8`
+ * @param output_path The path of the file to write
+ * @param to The colour model to convert to, which may be the same as `from`
+ * to only change the format
+ * @param pool The pool to convert each chunk with, or `NULL` to convert on
+ * the calling thread
+ * @returns `true` if the file was converted
+ * @returns `false` if the arguments are not valid, the size of the input file
+ * is not a whole number of pixels, or the files could not be mapped
+ * @since `v0.6.0`
+ */
+bool colrcv_raw_convert_file(
+    const char* input_path, colrcv_raw_format_t format, colrcv_model_t from,
+    const char* output_path, colrcv_model_t to, colrcv_pool_t* pool
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
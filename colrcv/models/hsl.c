@@ -9,6 +9,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "../colrcv.h"
 #include "hsl.h"
@@ -16,6 +17,10 @@
 #include "hsv.h"
 #include "lab.h"
 #include "xyz.h"
+#include "../internal/batch.h"
+#include "../internal/kernels.h"
+#include "../internal/scalar_hsl.h"
+#include "../internal/stats.h"
 
 
 #ifdef __cplusplus
@@ -27,112 +32,243 @@ const double COLRCV_HSL_H_MAX_VALUE = 360;
 const double COLRCV_HSL_S_MAX_VALUE = 100;
 const double COLRCV_HSL_L_MAX_VALUE = 100;
 
-bool colrcv_hsl_h_is_valid(colrcv_hsl_t hsl) {
-    return colrcv_range_valid(
-        COLRCV_HSL_MIN_VALUE, hsl.h, COLRCV_HSL_H_MAX_VALUE
+size_t colrcv_hsl_validate_soa(
+    const double* h, const double* s, const double* l,
+    uint8_t* invalid, size_t count
+) {
+    return colrcv_batch_validate(
+        COLRCV_MODEL_HSL, h, s, l, invalid, count
     );
 }
 
-bool colrcv_hsl_s_is_valid(colrcv_hsl_t hsl) {
-    return colrcv_range_valid(
-        COLRCV_HSL_MIN_VALUE, hsl.s, COLRCV_HSL_S_MAX_VALUE
+void colrcv_hsl_clamp_soa(
+    double* h, double* s, double* l, size_t count
+) {
+    colrcv_batch_clamp(COLRCV_MODEL_HSL, h, s, l, count);
+}
+
+void colrcv_hsl_to_rgb_soa(
+    const double* h, const double* s, const double* l,
+    double* r, double* g, double* b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsl_to_rgb_soa, count
     );
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_rgb_t rgb = kernel_hsl_to_rgb(
+            (colrcv_hsl_t){ .h = h[i], .s = s[i], .l = l[i], }
+        );
+        r[i] = rgb.r;
+        g[i] = rgb.g;
+        b[i] = rgb.b;
+    }
+    colrcv_stats_batch_end(begun);
 }
 
-bool colrcv_hsl_l_is_valid(colrcv_hsl_t hsl) {
-    return colrcv_range_valid(
-        COLRCV_HSL_MIN_VALUE, hsl.l, COLRCV_HSL_L_MAX_VALUE
+void colrcv_hsl_to_hsv_soa(
+    const double* hsl_h, const double* hsl_s, const double* l,
+    double* hsv_h, double* hsv_s, double* v,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsl_to_hsv_soa, count
     );
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsv_t hsv = kernel_hsl_to_hsv(
+            (colrcv_hsl_t){ .h = hsl_h[i], .s = hsl_s[i], .l = l[i], }
+        );
+        hsv_h[i] = hsv.h;
+        hsv_s[i] = hsv.s;
+        v[i] = hsv.v;
+    }
+    colrcv_stats_batch_end(begun);
 }
 
-bool colrcv_hsl_is_valid(colrcv_hsl_t hsl) {
-    // check that the value of each component is in range
-    return (
-        colrcv_hsl_h_is_valid(hsl) &&
-        colrcv_hsl_s_is_valid(hsl) &&
-        colrcv_hsl_l_is_valid(hsl)
+void colrcv_hsl_to_lab_soa(
+    const double* h, const double* s, const double* hsl_l,
+    double* lab_l, double* a, double* b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsl_to_lab_soa, count
+    );
+    // Three-step conversion using HSL->RGB, RGB->XYZ and XYZ->LAB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_batch_hsl_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_xyz,
+        colrcv_xyz_to_lab_soa,
+    };
+    colrcv_batch_convert_chain(
+        stages, 3, h, s, hsl_l, lab_l, a, b, count
     );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_hsl_t colrcv_hsl_clamp(colrcv_hsl_t hsl) {
-    // run all clamping functions on the value
-    return colrcv_hsl_clamp_l(colrcv_hsl_clamp_s(colrcv_hsl_clamp_h(hsl)));
+void colrcv_hsl_to_xyz_soa(
+    const double* h, const double* s, const double* l,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsl_to_xyz_soa, count
+    );
+    // Two-step conversion using HSL->RGB and RGB->XYZ, without scaling RGB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_batch_hsl_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_xyz,
+    };
+    colrcv_batch_convert_chain(
+        stages, 2, h, s, l, x, y, z, count
+    );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_hsl_t colrcv_hsl_clamp_h(colrcv_hsl_t hsl) {
-    // clamp hue
-    hsl.h = colrcv_clamp(hsl.h, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_H_MAX_VALUE);
-    return hsl;
+void colrcv_hsl_to_rgb_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsl_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-colrcv_hsl_t colrcv_hsl_clamp_s(colrcv_hsl_t hsl) {
-    // clamp saturation
-    hsl.s = colrcv_clamp(hsl.s, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_S_MAX_VALUE);
-    return hsl;
+void colrcv_hsl_to_hsv_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsl_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-colrcv_hsl_t colrcv_hsl_clamp_l(colrcv_hsl_t hsl) {
-    // clamp lightness
-    hsl.l = colrcv_clamp(hsl.l, COLRCV_HSL_MIN_VALUE, COLRCV_HSL_L_MAX_VALUE);
-    return hsl;
+void colrcv_hsl_to_lab_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsl_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-// private helper function for colrcv_hsl_to_rgb
-static double hue_to_rgb(double a, double b, double h) {
-    if(h < 0) {
-        h += 1;
-    } else if(h > 1) {
-        h -= 1;
-    }
-    if((6 * h) < 1) {
-        return (a + (b - a) * 6 * h);
-    } else if((2 * h) < 1) {
-        return b;
-    } else if((3 * h) < 2) {
-        return (a + (b - a) * ((2.0 / 3) - h) * 6);
-    } else {
-        return a;
-    }
+void colrcv_hsl_to_xyz_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsl_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=19#text19
-colrcv_rgb_t colrcv_hsl_to_rgb(colrcv_hsl_t hsl) {
-    colrcv_rgb_t rgb;
-    // if saturation is 0, it's an achromatic grey so return early
-    if(hsl.s == 0) {
-        rgb.r = hsl.l / 100 * 255;
-        rgb.g = hsl.l / 100 * 255;
-        rgb.b = hsl.l / 100 * 255;
-    } else {
-        // down-scale all channels
-        const double h = hsl.h / 360;
-        const double s = hsl.s / 100;
-        const double l = hsl.l / 100;
-        // get temporary 'b'
-        const double temp_b = (l < 0.5) ? (l * (1 + s)) : ((l + s) - (s * l));
-        // get temporary 'a'
-        const double temp_a = 2 * l - temp_b;
-        // get component amounts with respect to hue and temporaries
-        rgb.r = 255 * hue_to_rgb(temp_a, temp_b, h + (1.0 / 3));
-        rgb.g = 255 * hue_to_rgb(temp_a, temp_b, h);
-        rgb.b = 255 * hue_to_rgb(temp_a, temp_b, h - (1.0 / 3));
-    }
-    return rgb;
+void colrcv_hslf_to_rgbf_soa(
+    const float* h, const float* s, const float* l,
+    float* r, float* g, float* b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsl_to_rgb_soa, h, s, l, r, g, b, count
+    );
 }
 
-colrcv_hsv_t colrcv_hsl_to_hsv(colrcv_hsl_t hsl) {
-    // Two-step conversion using HSL->RGB and RGB->HSV
-    return colrcv_rgb_to_hsv(colrcv_hsl_to_rgb(hsl));
+void colrcv_hslf_to_hsvf_soa(
+    const float* hsl_h, const float* hsl_s, const float* l,
+    float* hsv_h, float* hsv_s, float* v,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsl_to_hsv_soa, hsl_h, hsl_s, l, hsv_h, hsv_s, v, count
+    );
 }
 
-colrcv_lab_t colrcv_hsl_to_lab(colrcv_hsl_t hsl) {
-    // Two-step conversion using HSL->RGB and RGB->LAB
-    return colrcv_rgb_to_lab(colrcv_hsl_to_rgb(hsl));
+void colrcv_hslf_to_labf_soa(
+    const float* h, const float* s, const float* hsl_l,
+    float* lab_l, float* a, float* b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsl_to_lab_soa, h, s, hsl_l, lab_l, a, b, count
+    );
 }
 
-colrcv_xyz_t colrcv_hsl_to_xyz(colrcv_hsl_t hsl) {
-    // Two-step conversion using HSL->RGB and RGB->XYZ
-    return colrcv_rgb_to_xyz(colrcv_hsl_to_rgb(hsl));
+void colrcv_hslf_to_xyzf_soa(
+    const float* h, const float* s, const float* l,
+    float* x, float* y, float* z,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsl_to_xyz_soa, h, s, l, x, y, z, count
+    );
+}
+
+void colrcv_hslf_to_rgbf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsl_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hslf_to_hsvf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsl_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hslf_to_labf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsl_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hslf_to_xyzf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsl_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+colrcv_rgb8_t colrcv_hsl8_to_rgb8(colrcv_hsl8_t hsl) {
+    return kernel_hsl8_to_rgb8(hsl);
+}
+
+void colrcv_hsl8_to_rgb8_strided(
+    const colrcv_hsl8_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsl8_t* hsl = (const colrcv_hsl8_t*)(
+            (const char*)input + i * input_stride
+        );
+        *(colrcv_rgb8_t*)((char*)output + i * output_stride) = (
+            kernel_hsl8_to_rgb8(*hsl)
+        );
+    }
 }
 
 #ifdef __cplusplus
@@ -25,7 +25,10 @@
 #define SAXBOPHONE_COLRCV_MODELS_HSL_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+#include "../colrcv.h"
 #include "types.h"
 
 
@@ -47,6 +50,39 @@ struct colrcv_hsl_t {
     double l;
 };
 
+/**
+ * @brief Used to represent a HSL colour in single precision
+ * @details This has the same channels and ranges as `colrcv_hsl_t`, for
+ * pipelines which store colours as floats.
+ * @since `v0.6.0`
+ */
+struct colrcv_hslf_t {
+    /** @brief The hue. Should be in range 0 -> 360 */
+    float h;
+    /** @brief The saturation. Should be in range 0 -> 100 */
+    float s;
+    /** @brief The lightness. Should be in range 0 -> 100 */
+    float l;
+};
+
+/**
+ * @brief Used to represent a HSL colour with 8-bit saturation and lightness
+ * @details For converting 8-bit RGB colours with integer arithmetic only, see
+ * `colrcv_rgb8_to_hsl8()` and `colrcv_hsl8_to_rgb8()`. Every value of each
+ * channel is valid.
+ * @since `v0.6.0`
+ */
+struct colrcv_hsl8_t {
+    /**
+     * @brief The hue, in 1/65536ths of a turn, so 65536 would be 360 degrees
+     */
+    uint16_t h;
+    /** @brief The saturation, in range 0 -> 255 for 0 -> 100 */
+    uint8_t s;
+    /** @brief The lightness, in range 0 -> 255 for 0 -> 100 */
+    uint8_t l;
+};
+
 /**
  * @details The minimum value that any of the components should have
  * @since `v0.1.0`
@@ -77,7 +113,7 @@ extern const double COLRCV_HSL_L_MAX_VALUE;
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsl_h_is_valid(colrcv_hsl_t hsl);
+COLRCV_SCALAR bool colrcv_hsl_h_is_valid(colrcv_hsl_t hsl);
 
 /**
  * @brief Checks that saturation component of a given `colrcv_hsl_t` struct is
@@ -86,7 +122,7 @@ bool colrcv_hsl_h_is_valid(colrcv_hsl_t hsl);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsl_s_is_valid(colrcv_hsl_t hsl);
+COLRCV_SCALAR bool colrcv_hsl_s_is_valid(colrcv_hsl_t hsl);
 
 /**
  * @brief Checks that value component of a given `colrcv_hsl_t` struct is valid
@@ -94,7 +130,7 @@ bool colrcv_hsl_s_is_valid(colrcv_hsl_t hsl);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsl_l_is_valid(colrcv_hsl_t hsl);
+COLRCV_SCALAR bool colrcv_hsl_l_is_valid(colrcv_hsl_t hsl);
 
 /**
  * @brief Checks that the components of a given `colrcv_hsl_t` struct are valid
@@ -102,7 +138,7 @@ bool colrcv_hsl_l_is_valid(colrcv_hsl_t hsl);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsl_is_valid(colrcv_hsl_t hsl);
+COLRCV_SCALAR bool colrcv_hsl_is_valid(colrcv_hsl_t hsl);
 
 /**
  * @brief Makes all of the channels of a given `colrcv_hsl_t` struct fit within
@@ -111,7 +147,7 @@ bool colrcv_hsl_is_valid(colrcv_hsl_t hsl);
  * range.
  * @since `v0.4.0`
  */
-colrcv_hsl_t colrcv_hsl_clamp(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp(colrcv_hsl_t hsl);
 
 /**
  * @brief Makes the hue channel of a given `colrcv_hsl_t` struct fit within the
@@ -120,7 +156,7 @@ colrcv_hsl_t colrcv_hsl_clamp(colrcv_hsl_t hsl);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_hsl_t colrcv_hsl_clamp_h(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp_h(colrcv_hsl_t hsl);
 
 /**
  * @brief Makes the saturation channel of a given `colrcv_hsl_t` struct fit
@@ -129,7 +165,7 @@ colrcv_hsl_t colrcv_hsl_clamp_h(colrcv_hsl_t hsl);
  * be within range.
  * @since `v0.4.0`
  */
-colrcv_hsl_t colrcv_hsl_clamp_s(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp_s(colrcv_hsl_t hsl);
 
 /**
  * @brief Makes the lightnness channel of a given `colrcv_hsl_t` struct fit
@@ -138,7 +174,44 @@ colrcv_hsl_t colrcv_hsl_clamp_s(colrcv_hsl_t hsl);
  * be within range.
  * @since `v0.4.0`
  */
-colrcv_hsl_t colrcv_hsl_clamp_l(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsl_clamp_l(colrcv_hsl_t hsl);
+
+/**
+ * @brief Checks that the components of an array of HSL colours are valid
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is checked as by `colrcv_hsl_is_valid()`, but several
+ * colours are checked at once with the SIMD instructions chosen in `simd.h`.
+ * @param h Array of the HSL hue components to be checked
+ * @param s Array of the HSL saturation components to be checked
+ * @param l Array of the HSL lightness components to be checked
+ * @param[out] invalid Array of `(count + 7) / 8` bytes to set bit `i % 8` of
+ * byte `i / 8` of for each colour `i` which is not valid, clearing the bits of
+ * the others. May be `NULL` if only the number of invalid colours is needed.
+ * @param count The number of colours in each of the arrays
+ * @returns The number of colours which are not valid
+ * @since `v0.6.0`
+ */
+size_t colrcv_hsl_validate_soa(
+    const double* h, const double* s, const double* l,
+    uint8_t* invalid, size_t count
+);
+
+/**
+ * @brief Makes each colour of an array of HSL colours fit within the
+ * 'standard' range of each channel, in-place
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is clamped as by `colrcv_hsl_clamp()`, giving exactly
+ * the same results, but several colours are clamped at once with the SIMD
+ * instructions chosen in `simd.h`.
+ * @param[in,out] h Array of the HSL hue components to be clamped
+ * @param[in,out] s Array of the HSL saturation components to be clamped
+ * @param[in,out] l Array of the HSL lightness components to be clamped
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_clamp_soa(
+    double* h, double* s, double* l, size_t count
+);
 
 /**
  * @brief Converts a HSL colour to an RGB colour
@@ -146,7 +219,7 @@ colrcv_hsl_t colrcv_hsl_clamp_l(colrcv_hsl_t hsl);
  * @returns The RGB colour that the HSL colour was converted to
  * @since `v0.1.0`
  */
-colrcv_rgb_t colrcv_hsl_to_rgb(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_rgb_t colrcv_hsl_to_rgb(colrcv_hsl_t hsl);
 
 /**
  * @brief Converts a HSL colour to a HSV colour
@@ -154,7 +227,7 @@ colrcv_rgb_t colrcv_hsl_to_rgb(colrcv_hsl_t hsl);
  * @returns The HSV colour that the HSL colour was converted to
  * @since `v0.1.0`
  */
-colrcv_hsv_t colrcv_hsl_to_hsv(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsl_to_hsv(colrcv_hsl_t hsl);
 
 /**
  * @brief Converts a HSL colour to a LAB colour
@@ -162,7 +235,7 @@ colrcv_hsv_t colrcv_hsl_to_hsv(colrcv_hsl_t hsl);
  * @returns The LAB colour that the HSL colour was converted to
  * @since `v0.1.0`
  */
-colrcv_lab_t colrcv_hsl_to_lab(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_lab_t colrcv_hsl_to_lab(colrcv_hsl_t hsl);
 
 /**
  * @brief Converts a HSL colour to an XYZ colour
@@ -170,11 +243,406 @@ colrcv_lab_t colrcv_hsl_to_lab(colrcv_hsl_t hsl);
  * @returns The XYZ colour that the HSL colour was converted to
  * @since `v0.1.0`
  */
-colrcv_xyz_t colrcv_hsl_to_xyz(colrcv_hsl_t hsl);
+COLRCV_SCALAR colrcv_xyz_t colrcv_hsl_to_xyz(colrcv_hsl_t hsl);
+
+/**
+ * @brief Converts an array of HSL colours to RGB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param h Array of the HSL hue components to be converted
+ * @param s Array of the HSL saturation components to be converted
+ * @param l Array of the HSL lightness components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_rgb_soa(
+    const double* h, const double* s, const double* l,
+    double* r, double* g, double* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSL colours to HSV colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param hsl_h Array of the HSL hue components to be converted
+ * @param hsl_s Array of the HSL saturation components to be converted
+ * @param l Array of the HSL lightness components to be converted
+ * @param[out] hsv_h Array to write the converted HSV hue components to
+ * @param[out] hsv_s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_hsv_soa(
+    const double* hsl_h, const double* hsl_s, const double* l,
+    double* hsv_h, double* hsv_s, double* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSL colours to LAB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param h Array of the HSL hue components to be converted
+ * @param s Array of the HSL saturation components to be converted
+ * @param hsl_l Array of the HSL lightness components to be converted
+ * @param[out] lab_l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_lab_soa(
+    const double* h, const double* s, const double* hsl_l,
+    double* lab_l, double* a, double* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSL colours to XYZ colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param h Array of the HSL hue components to be converted
+ * @param s Array of the HSL saturation components to be converted
+ * @param l Array of the HSL lightness components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_xyz_soa(
+    const double* h, const double* s, const double* l,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSL colours to RGB colours
+ * @details The colours may be stored in arrays of `colrcv_hsl_t` and
+ * `colrcv_rgb_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsl_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_rgb_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSL colours to HSV colours
+ * @details The colours may be stored in arrays of `colrcv_hsl_t` and
+ * `colrcv_hsv_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsl_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_hsv_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSL colours to LAB colours
+ * @details The colours may be stored in arrays of `colrcv_hsl_t` and
+ * `colrcv_lab_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsl_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_lab_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSL colours to XYZ colours
+ * @details The colours may be stored in arrays of `colrcv_hsl_t` and
+ * `colrcv_xyz_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsl_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsl_to_xyz_strided(
+    const colrcv_hsl_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts a single-precision HSL colour to an RGB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsl_to_rgb()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsl A single-precision HSL colour to be converted
+ * @returns The single-precision RGB colour that the HSL colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_rgbf_t colrcv_hslf_to_rgbf(colrcv_hslf_t hsl);
+
+/**
+ * @brief Converts a single-precision HSL colour to a HSV colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsl_to_hsv()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsl A single-precision HSL colour to be converted
+ * @returns The single-precision HSV colour that the HSL colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hsvf_t colrcv_hslf_to_hsvf(colrcv_hslf_t hsl);
+
+/**
+ * @brief Converts a single-precision HSL colour to a LAB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsl_to_lab()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsl A single-precision HSL colour to be converted
+ * @returns The single-precision LAB colour that the HSL colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_labf_t colrcv_hslf_to_labf(colrcv_hslf_t hsl);
+
+/**
+ * @brief Converts a single-precision HSL colour to an XYZ colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsl_to_xyz()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsl A single-precision HSL colour to be converted
+ * @returns The single-precision XYZ colour that the HSL colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_xyzf_t colrcv_hslf_to_xyzf(colrcv_hslf_t hsl);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to RGB colours
+ * @details As `colrcv_hsl_to_rgb_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param h Array of the HSL hue components to be converted
+ * @param s Array of the HSL saturation components to be converted
+ * @param l Array of the HSL lightness components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_rgbf_soa(
+    const float* h, const float* s, const float* l,
+    float* r, float* g, float* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to HSV colours
+ * @details As `colrcv_hsl_to_hsv_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param hsl_h Array of the HSL hue components to be converted
+ * @param hsl_s Array of the HSL saturation components to be converted
+ * @param l Array of the HSL lightness components to be converted
+ * @param[out] hsv_h Array to write the converted HSV hue components to
+ * @param[out] hsv_s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_hsvf_soa(
+    const float* hsl_h, const float* hsl_s, const float* l,
+    float* hsv_h, float* hsv_s, float* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to LAB colours
+ * @details As `colrcv_hsl_to_lab_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param h Array of the HSL hue components to be converted
+ * @param s Array of the HSL saturation components to be converted
+ * @param hsl_l Array of the HSL lightness components to be converted
+ * @param[out] lab_l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_labf_soa(
+    const float* h, const float* s, const float* hsl_l,
+    float* lab_l, float* a, float* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to XYZ colours
+ * @details As `colrcv_hsl_to_xyz_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param h Array of the HSL hue components to be converted
+ * @param s Array of the HSL saturation components to be converted
+ * @param l Array of the HSL lightness components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_xyzf_soa(
+    const float* h, const float* s, const float* l,
+    float* x, float* y, float* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to RGB colours
+ * @details As `colrcv_hsl_to_rgb_strided()`, but for `colrcv_hslf_t` and
+ * `colrcv_rgbf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsl_to_rgb()` rounded to the nearest float.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hslf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_rgbf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to HSV colours
+ * @details As `colrcv_hsl_to_hsv_strided()`, but for `colrcv_hslf_t` and
+ * `colrcv_hsvf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsl_to_hsv()` rounded to the nearest float.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hslf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_hsvf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to LAB colours
+ * @details As `colrcv_hsl_to_lab_strided()`, but for `colrcv_hslf_t` and
+ * `colrcv_labf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsl_to_lab()` rounded to the nearest float.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hslf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_labf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSL colours to XYZ colours
+ * @details As `colrcv_hsl_to_xyz_strided()`, but for `colrcv_hslf_t` and
+ * `colrcv_xyzf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsl_to_xyz()` rounded to the nearest float.
+ * @param input Pointer to the first HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hslf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hslf_to_xyzf_strided(
+    const colrcv_hslf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an 8-bit HSL colour to an 8-bit RGB colour
+ * @details This uses integer arithmetic only. Each channel is within
+ * 1 of the result of `colrcv_hsl_to_rgb()` rounded to the nearest
+ * whole number.
+ * @param hsl An 8-bit HSL colour to be converted
+ * @returns The 8-bit RGB colour that the HSL colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_rgb8_t colrcv_hsl8_to_rgb8(colrcv_hsl8_t hsl);
+
+/**
+ * @brief Converts an array of 8-bit HSL colours to 8-bit RGB colours
+ * @details The results are the same as those of `colrcv_hsl8_to_rgb8()`. The
+ * colours may be fields of larger structs, by giving the distance in bytes
+ * between each colour.
+ * @param input Pointer to the first 8-bit HSL colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsl8_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsl8_to_rgb8_strided(
+    const colrcv_hsl8_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+);
 
 #ifdef __cplusplus
 } // extern "C"
 #endif
 
+// the definitions of the scalar functions, when they are to be inlined
+#ifdef COLRCV_INLINE
+#include "../internal/inline.h"
+#endif
+
 // end of header file
 #endif
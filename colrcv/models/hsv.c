@@ -9,6 +9,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "../colrcv.h"
 #include "hsv.h"
@@ -16,6 +17,10 @@
 #include "hsl.h"
 #include "lab.h"
 #include "xyz.h"
+#include "../internal/batch.h"
+#include "../internal/kernels.h"
+#include "../internal/scalar_hsv.h"
+#include "../internal/stats.h"
 
 
 #ifdef __cplusplus
@@ -27,134 +32,243 @@ const double COLRCV_HSV_H_MAX_VALUE = 360;
 const double COLRCV_HSV_S_MAX_VALUE = 100;
 const double COLRCV_HSV_V_MAX_VALUE = 100;
 
-bool colrcv_hsv_h_is_valid(colrcv_hsv_t hsv) {
-    return colrcv_range_valid(
-        COLRCV_HSV_MIN_VALUE, hsv.h, COLRCV_HSV_H_MAX_VALUE
-    );
-}
-
-bool colrcv_hsv_s_is_valid(colrcv_hsv_t hsv) {
-    return colrcv_range_valid(
-        COLRCV_HSV_MIN_VALUE, hsv.s, COLRCV_HSV_S_MAX_VALUE
-    );
-}
-
-bool colrcv_hsv_v_is_valid(colrcv_hsv_t hsv) {
-    return colrcv_range_valid(
-        COLRCV_HSV_MIN_VALUE, hsv.v, COLRCV_HSV_V_MAX_VALUE
-    );
-}
-
-bool colrcv_hsv_is_valid(colrcv_hsv_t hsv) {
-    // check that the value of each component is in range
-    return (
-        colrcv_hsv_h_is_valid(hsv) &&
-        colrcv_hsv_s_is_valid(hsv) &&
-        colrcv_hsv_v_is_valid(hsv)
-    );
-}
-
-colrcv_hsv_t colrcv_hsv_clamp(colrcv_hsv_t hsv) {
-    // run all clamping functions on the value
-    return colrcv_hsv_clamp_v(colrcv_hsv_clamp_s(colrcv_hsv_clamp_h(hsv)));
-}
-
-colrcv_hsv_t colrcv_hsv_clamp_h(colrcv_hsv_t hsv) {
-    // clamp hue
-    hsv.h = colrcv_clamp(hsv.h, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_H_MAX_VALUE);
-    return hsv;
-}
-
-colrcv_hsv_t colrcv_hsv_clamp_s(colrcv_hsv_t hsv) {
-    // clamp saturation
-    hsv.s = colrcv_clamp(hsv.s, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_S_MAX_VALUE);
-    return hsv;
-}
-
-colrcv_hsv_t colrcv_hsv_clamp_v(colrcv_hsv_t hsv) {
-    // clamp value
-    hsv.v = colrcv_clamp(hsv.v, COLRCV_HSV_MIN_VALUE, COLRCV_HSV_V_MAX_VALUE);
-    return hsv;
-}
-
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=21#text21
-colrcv_rgb_t colrcv_hsv_to_rgb(colrcv_hsv_t hsv) {
-    colrcv_rgb_t rgb = { .r = 0, .g = 0, .b = 0, };
-    // down-scale s and v input values first
-    const double s = hsv.s / 100;
-    const double v = hsv.v / 100;
-    // if saturation is 0 then all channels are a product of the value
-    if(s == 0) {
-        rgb.r = v * 255;
-        rgb.g = v * 255;
-        rgb.b = v * 255;
-    } else {
-        // scale down H to be in range 0 -> 6
-        double scaled_h = hsv.h / 60;
-        // h value must be snapped to range 0.0 -> 6.0
-        if(scaled_h >= 6.0) {
-            scaled_h -= 6.0;
-        }
-        // floor convert to int
-        const uint16_t integer_h = (uint16_t)scaled_h;
-        // this further lot of temporaries are used in the channel multiplex
-        const double temp_a = v * (1.0 - s);
-        const double temp_b = v * (1.0 - s * (scaled_h - integer_h));
-        const double temp_c = v * (1.0 - s * (1.0 - (scaled_h - integer_h)));
-        // choose one of many different multiplexes based on value of integer_h
-        switch(integer_h % 6) {
-            case 0:
-                rgb.r = v;
-                rgb.g = temp_c;
-                rgb.b = temp_a;
-                break;
-            case 1:
-                rgb.r = temp_b;
-                rgb.g = v;
-                rgb.b = temp_a;
-                break;
-            case 2:
-                rgb.r = temp_a;
-                rgb.g = v;
-                rgb.b = temp_c;
-                break;
-            case 3:
-                rgb.r = temp_a;
-                rgb.g = temp_b;
-                rgb.b = v;
-                break;
-            case 4:
-                rgb.r = temp_c;
-                rgb.g = temp_a;
-                rgb.b = v;
-                break;
-            case 5:
-                rgb.r = v;
-                rgb.g = temp_a;
-                rgb.b = temp_b;
-                break;
-        }
-        // up-scale output values to be in 0-255 range
-        rgb.r *= 255;
-        rgb.g *= 255;
-        rgb.b *= 255;
+size_t colrcv_hsv_validate_soa(
+    const double* h, const double* s, const double* v,
+    uint8_t* invalid, size_t count
+) {
+    return colrcv_batch_validate(
+        COLRCV_MODEL_HSV, h, s, v, invalid, count
+    );
+}
+
+void colrcv_hsv_clamp_soa(
+    double* h, double* s, double* v, size_t count
+) {
+    colrcv_batch_clamp(COLRCV_MODEL_HSV, h, s, v, count);
+}
+
+void colrcv_hsv_to_rgb_soa(
+    const double* h, const double* s, const double* v,
+    double* r, double* g, double* b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsv_to_rgb_soa, count
+    );
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_rgb_t rgb = kernel_hsv_to_rgb(
+            (colrcv_hsv_t){ .h = h[i], .s = s[i], .v = v[i], }
+        );
+        r[i] = rgb.r;
+        g[i] = rgb.g;
+        b[i] = rgb.b;
+    }
+    colrcv_stats_batch_end(begun);
+}
+
+void colrcv_hsv_to_hsl_soa(
+    const double* hsv_h, const double* hsv_s, const double* v,
+    double* hsl_h, double* hsl_s, double* l,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsv_to_hsl_soa, count
+    );
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsl_t hsl = kernel_hsv_to_hsl(
+            (colrcv_hsv_t){ .h = hsv_h[i], .s = hsv_s[i], .v = v[i], }
+        );
+        hsl_h[i] = hsl.h;
+        hsl_s[i] = hsl.s;
+        l[i] = hsl.l;
     }
-    return rgb;
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_hsl_t colrcv_hsv_to_hsl(colrcv_hsv_t hsv) {
-    // Two-step conversion using HSV->RGB and RGB->HSL
-    return colrcv_rgb_to_hsl(colrcv_hsv_to_rgb(hsv));
+void colrcv_hsv_to_lab_soa(
+    const double* h, const double* s, const double* v,
+    double* l, double* a, double* b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsv_to_lab_soa, count
+    );
+    // Three-step conversion using HSV->RGB, RGB->XYZ and XYZ->LAB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_batch_hsv_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_xyz,
+        colrcv_xyz_to_lab_soa,
+    };
+    colrcv_batch_convert_chain(
+        stages, 3, h, s, v, l, a, b, count
+    );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_lab_t colrcv_hsv_to_lab(colrcv_hsv_t hsv) {
-    // Two-step conversion using HSV->RGB and RGB->LAB
-    return colrcv_rgb_to_lab(colrcv_hsv_to_rgb(hsv));
+void colrcv_hsv_to_xyz_soa(
+    const double* h, const double* s, const double* v,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_hsv_to_xyz_soa, count
+    );
+    // Two-step conversion using HSV->RGB and RGB->XYZ, without scaling RGB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_batch_hsv_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_xyz,
+    };
+    colrcv_batch_convert_chain(
+        stages, 2, h, s, v, x, y, z, count
+    );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_xyz_t colrcv_hsv_to_xyz(colrcv_hsv_t hsv) {
-    // Two-step conversion using HSV->RGB and RGB->XYZ
-    return colrcv_rgb_to_xyz(colrcv_hsv_to_rgb(hsv));
+void colrcv_hsv_to_rgb_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsv_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hsv_to_hsl_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsv_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hsv_to_lab_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsv_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hsv_to_xyz_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_hsv_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hsvf_to_rgbf_soa(
+    const float* h, const float* s, const float* v,
+    float* r, float* g, float* b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsv_to_rgb_soa, h, s, v, r, g, b, count
+    );
+}
+
+void colrcv_hsvf_to_hslf_soa(
+    const float* hsv_h, const float* hsv_s, const float* v,
+    float* hsl_h, float* hsl_s, float* l,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsv_to_hsl_soa, hsv_h, hsv_s, v, hsl_h, hsl_s, l, count
+    );
+}
+
+void colrcv_hsvf_to_labf_soa(
+    const float* h, const float* s, const float* v,
+    float* l, float* a, float* b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsv_to_lab_soa, h, s, v, l, a, b, count
+    );
+}
+
+void colrcv_hsvf_to_xyzf_soa(
+    const float* h, const float* s, const float* v,
+    float* x, float* y, float* z,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_hsv_to_xyz_soa, h, s, v, x, y, z, count
+    );
+}
+
+void colrcv_hsvf_to_rgbf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsv_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hsvf_to_hslf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsv_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hsvf_to_labf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsv_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_hsvf_to_xyzf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_hsv_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+colrcv_rgb8_t colrcv_hsv8_to_rgb8(colrcv_hsv8_t hsv) {
+    return kernel_hsv8_to_rgb8(hsv);
+}
+
+void colrcv_hsv8_to_rgb8_strided(
+    const colrcv_hsv8_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsv8_t* hsv = (const colrcv_hsv8_t*)(
+            (const char*)input + i * input_stride
+        );
+        *(colrcv_rgb8_t*)((char*)output + i * output_stride) = (
+            kernel_hsv8_to_rgb8(*hsv)
+        );
+    }
 }
 
 #ifdef __cplusplus
@@ -25,7 +25,10 @@
 #define SAXBOPHONE_COLRCV_MODELS_HSV_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+#include "../colrcv.h"
 #include "types.h"
 
 
@@ -47,6 +50,39 @@ struct colrcv_hsv_t {
     double v;
 };
 
+/**
+ * @brief Used to represent a HSV colour in single precision
+ * @details This has the same channels and ranges as `colrcv_hsv_t`, for
+ * pipelines which store colours as floats.
+ * @since `v0.6.0`
+ */
+struct colrcv_hsvf_t {
+    /** @brief The hue. Should be in range 0 -> 360 */
+    float h;
+    /** @brief The saturation. Should be in range 0 -> 100 */
+    float s;
+    /** @brief The value. Should be in range 0 -> 100 */
+    float v;
+};
+
+/**
+ * @brief Used to represent a HSV colour with 8-bit saturation and value
+ * @details For converting 8-bit RGB colours with integer arithmetic only, see
+ * `colrcv_rgb8_to_hsv8()` and `colrcv_hsv8_to_rgb8()`. Every value of each
+ * channel is valid.
+ * @since `v0.6.0`
+ */
+struct colrcv_hsv8_t {
+    /**
+     * @brief The hue, in 1/65536ths of a turn, so 65536 would be 360 degrees
+     */
+    uint16_t h;
+    /** @brief The saturation, in range 0 -> 255 for 0 -> 100 */
+    uint8_t s;
+    /** @brief The value, in range 0 -> 255 for 0 -> 100 */
+    uint8_t v;
+};
+
 /**
  * @details The minimum value that any of the components should have
  * @since `v0.1.0`
@@ -77,7 +113,7 @@ extern const double COLRCV_HSV_V_MAX_VALUE;
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsv_h_is_valid(colrcv_hsv_t hsv);
+COLRCV_SCALAR bool colrcv_hsv_h_is_valid(colrcv_hsv_t hsv);
 
 /**
  * @brief Checks that saturation component of a given `colrcv_hsv_t` struct is
@@ -86,7 +122,7 @@ bool colrcv_hsv_h_is_valid(colrcv_hsv_t hsv);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsv_s_is_valid(colrcv_hsv_t hsv);
+COLRCV_SCALAR bool colrcv_hsv_s_is_valid(colrcv_hsv_t hsv);
 
 /**
  * @brief Checks that value component of a given `colrcv_hsv_t` struct is valid
@@ -94,7 +130,7 @@ bool colrcv_hsv_s_is_valid(colrcv_hsv_t hsv);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsv_v_is_valid(colrcv_hsv_t hsv);
+COLRCV_SCALAR bool colrcv_hsv_v_is_valid(colrcv_hsv_t hsv);
 
 /**
  * @brief Checks that the components of a given `colrcv_hsv_t` struct are valid
@@ -102,7 +138,7 @@ bool colrcv_hsv_v_is_valid(colrcv_hsv_t hsv);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_hsv_is_valid(colrcv_hsv_t hsv);
+COLRCV_SCALAR bool colrcv_hsv_is_valid(colrcv_hsv_t hsv);
 
 /**
  * @brief Makes all of the channels of a given `colrcv_hsv_t` struct fit within
@@ -111,7 +147,7 @@ bool colrcv_hsv_is_valid(colrcv_hsv_t hsv);
  * range.
  * @since `v0.4.0`
  */
-colrcv_hsv_t colrcv_hsv_clamp(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp(colrcv_hsv_t hsv);
 
 /**
  * @brief Makes the hue channel of a given `colrcv_hsv_t` struct fit within the
@@ -120,7 +156,7 @@ colrcv_hsv_t colrcv_hsv_clamp(colrcv_hsv_t hsv);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_hsv_t colrcv_hsv_clamp_h(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp_h(colrcv_hsv_t hsv);
 
 /**
  * @brief Makes the saturation channel of a given `colrcv_hsv_t` struct fit
@@ -129,7 +165,7 @@ colrcv_hsv_t colrcv_hsv_clamp_h(colrcv_hsv_t hsv);
  * be within range.
  * @since `v0.4.0`
  */
-colrcv_hsv_t colrcv_hsv_clamp_s(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp_s(colrcv_hsv_t hsv);
 
 /**
  * @brief Makes the value channel of a given `colrcv_hsv_t` struct fit within
@@ -138,7 +174,44 @@ colrcv_hsv_t colrcv_hsv_clamp_s(colrcv_hsv_t hsv);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_hsv_t colrcv_hsv_clamp_v(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_hsv_t colrcv_hsv_clamp_v(colrcv_hsv_t hsv);
+
+/**
+ * @brief Checks that the components of an array of HSV colours are valid
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is checked as by `colrcv_hsv_is_valid()`, but several
+ * colours are checked at once with the SIMD instructions chosen in `simd.h`.
+ * @param h Array of the HSV hue components to be checked
+ * @param s Array of the HSV saturation components to be checked
+ * @param v Array of the HSV value components to be checked
+ * @param[out] invalid Array of `(count + 7) / 8` bytes to set bit `i % 8` of
+ * byte `i / 8` of for each colour `i` which is not valid, clearing the bits of
+ * the others. May be `NULL` if only the number of invalid colours is needed.
+ * @param count The number of colours in each of the arrays
+ * @returns The number of colours which are not valid
+ * @since `v0.6.0`
+ */
+size_t colrcv_hsv_validate_soa(
+    const double* h, const double* s, const double* v,
+    uint8_t* invalid, size_t count
+);
+
+/**
+ * @brief Makes each colour of an array of HSV colours fit within the
+ * 'standard' range of each channel, in-place
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is clamped as by `colrcv_hsv_clamp()`, giving exactly
+ * the same results, but several colours are clamped at once with the SIMD
+ * instructions chosen in `simd.h`.
+ * @param[in,out] h Array of the HSV hue components to be clamped
+ * @param[in,out] s Array of the HSV saturation components to be clamped
+ * @param[in,out] v Array of the HSV value components to be clamped
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_clamp_soa(
+    double* h, double* s, double* v, size_t count
+);
 
 /**
  * @brief Converts a HSV colour to an RGB colour
@@ -146,7 +219,7 @@ colrcv_hsv_t colrcv_hsv_clamp_v(colrcv_hsv_t hsv);
  * @returns The RGB colour that the HSV colour was converted to
  * @since `v0.1.0`
  */
-colrcv_rgb_t colrcv_hsv_to_rgb(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_rgb_t colrcv_hsv_to_rgb(colrcv_hsv_t hsv);
 
 /**
  * @brief Converts a HSV colour to a HSL colour
@@ -154,7 +227,7 @@ colrcv_rgb_t colrcv_hsv_to_rgb(colrcv_hsv_t hsv);
  * @returns The HSL colour that the HSV colour was converted to
  * @since `v0.1.0`
  */
-colrcv_hsl_t colrcv_hsv_to_hsl(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_hsl_t colrcv_hsv_to_hsl(colrcv_hsv_t hsv);
 
 /**
  * @brief Converts a HSV colour to a LAB colour
@@ -162,7 +235,7 @@ colrcv_hsl_t colrcv_hsv_to_hsl(colrcv_hsv_t hsv);
  * @returns The LAB colour that the HSV colour was converted to
  * @since `v0.1.0`
  */
-colrcv_lab_t colrcv_hsv_to_lab(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_lab_t colrcv_hsv_to_lab(colrcv_hsv_t hsv);
 
 /**
  * @brief Converts a HSV colour to an XYZ colour
@@ -170,11 +243,406 @@ colrcv_lab_t colrcv_hsv_to_lab(colrcv_hsv_t hsv);
  * @returns The XYZ colour that the HSV colour was converted to
  * @since `v0.1.0`
  */
-colrcv_xyz_t colrcv_hsv_to_xyz(colrcv_hsv_t hsv);
+COLRCV_SCALAR colrcv_xyz_t colrcv_hsv_to_xyz(colrcv_hsv_t hsv);
+
+/**
+ * @brief Converts an array of HSV colours to RGB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param h Array of the HSV hue components to be converted
+ * @param s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_rgb_soa(
+    const double* h, const double* s, const double* v,
+    double* r, double* g, double* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSV colours to HSL colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param hsv_h Array of the HSV hue components to be converted
+ * @param hsv_s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] hsl_h Array to write the converted HSL hue components to
+ * @param[out] hsl_s Array to write the converted HSL saturation components to
+ * @param[out] l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_hsl_soa(
+    const double* hsv_h, const double* hsv_s, const double* v,
+    double* hsl_h, double* hsl_s, double* l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSV colours to LAB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param h Array of the HSV hue components to be converted
+ * @param s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_lab_soa(
+    const double* h, const double* s, const double* v,
+    double* l, double* a, double* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSV colours to XYZ colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param h Array of the HSV hue components to be converted
+ * @param s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_xyz_soa(
+    const double* h, const double* s, const double* v,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSV colours to RGB colours
+ * @details The colours may be stored in arrays of `colrcv_hsv_t` and
+ * `colrcv_rgb_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsv_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_rgb_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSV colours to HSL colours
+ * @details The colours may be stored in arrays of `colrcv_hsv_t` and
+ * `colrcv_hsl_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsv_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_hsl_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSV colours to LAB colours
+ * @details The colours may be stored in arrays of `colrcv_hsv_t` and
+ * `colrcv_lab_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsv_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_lab_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of HSV colours to XYZ colours
+ * @details The colours may be stored in arrays of `colrcv_hsv_t` and
+ * `colrcv_xyz_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsv_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsv_to_xyz_strided(
+    const colrcv_hsv_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts a single-precision HSV colour to an RGB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsv_to_rgb()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsv A single-precision HSV colour to be converted
+ * @returns The single-precision RGB colour that the HSV colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_rgbf_t colrcv_hsvf_to_rgbf(colrcv_hsvf_t hsv);
+
+/**
+ * @brief Converts a single-precision HSV colour to a HSL colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsv_to_hsl()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsv A single-precision HSV colour to be converted
+ * @returns The single-precision HSL colour that the HSV colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hslf_t colrcv_hsvf_to_hslf(colrcv_hsvf_t hsv);
+
+/**
+ * @brief Converts a single-precision HSV colour to a LAB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsv_to_lab()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsv A single-precision HSV colour to be converted
+ * @returns The single-precision LAB colour that the HSV colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_labf_t colrcv_hsvf_to_labf(colrcv_hsvf_t hsv);
+
+/**
+ * @brief Converts a single-precision HSV colour to an XYZ colour
+ * @details The conversion is done in double precision by
+ * `colrcv_hsv_to_xyz()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param hsv A single-precision HSV colour to be converted
+ * @returns The single-precision XYZ colour that the HSV colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_xyzf_t colrcv_hsvf_to_xyzf(colrcv_hsvf_t hsv);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to RGB colours
+ * @details As `colrcv_hsv_to_rgb_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param h Array of the HSV hue components to be converted
+ * @param s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_rgbf_soa(
+    const float* h, const float* s, const float* v,
+    float* r, float* g, float* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to HSL colours
+ * @details As `colrcv_hsv_to_hsl_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param hsv_h Array of the HSV hue components to be converted
+ * @param hsv_s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] hsl_h Array to write the converted HSL hue components to
+ * @param[out] hsl_s Array to write the converted HSL saturation components to
+ * @param[out] l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_hslf_soa(
+    const float* hsv_h, const float* hsv_s, const float* v,
+    float* hsl_h, float* hsl_s, float* l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to LAB colours
+ * @details As `colrcv_hsv_to_lab_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param h Array of the HSV hue components to be converted
+ * @param s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_labf_soa(
+    const float* h, const float* s, const float* v,
+    float* l, float* a, float* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to XYZ colours
+ * @details As `colrcv_hsv_to_xyz_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param h Array of the HSV hue components to be converted
+ * @param s Array of the HSV saturation components to be converted
+ * @param v Array of the HSV value components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_xyzf_soa(
+    const float* h, const float* s, const float* v,
+    float* x, float* y, float* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to RGB colours
+ * @details As `colrcv_hsv_to_rgb_strided()`, but for `colrcv_hsvf_t` and
+ * `colrcv_rgbf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsv_to_rgb()` rounded to the nearest float.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsvf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_rgbf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to HSL colours
+ * @details As `colrcv_hsv_to_hsl_strided()`, but for `colrcv_hsvf_t` and
+ * `colrcv_hslf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsv_to_hsl()` rounded to the nearest float.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsvf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_hslf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to LAB colours
+ * @details As `colrcv_hsv_to_lab_strided()`, but for `colrcv_hsvf_t` and
+ * `colrcv_labf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsv_to_lab()` rounded to the nearest float.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsvf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_labf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision HSV colours to XYZ colours
+ * @details As `colrcv_hsv_to_xyz_strided()`, but for `colrcv_hsvf_t` and
+ * `colrcv_xyzf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_hsv_to_xyz()` rounded to the nearest float.
+ * @param input Pointer to the first HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsvf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsvf_to_xyzf_strided(
+    const colrcv_hsvf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an 8-bit HSV colour to an 8-bit RGB colour
+ * @details This uses integer arithmetic only. Each channel is within
+ * 1 of the result of `colrcv_hsv_to_rgb()` rounded to the nearest
+ * whole number.
+ * @param hsv An 8-bit HSV colour to be converted
+ * @returns The 8-bit RGB colour that the HSV colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_rgb8_t colrcv_hsv8_to_rgb8(colrcv_hsv8_t hsv);
+
+/**
+ * @brief Converts an array of 8-bit HSV colours to 8-bit RGB colours
+ * @details The results are the same as those of `colrcv_hsv8_to_rgb8()`. The
+ * colours may be fields of larger structs, by giving the distance in bytes
+ * between each colour.
+ * @param input Pointer to the first 8-bit HSV colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_hsv8_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_hsv8_to_rgb8_strided(
+    const colrcv_hsv8_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+);
 
 #ifdef __cplusplus
 } // extern "C"
 #endif
 
+// the definitions of the scalar functions, when they are to be inlined
+#ifdef COLRCV_INLINE
+#include "../internal/inline.h"
+#endif
+
 // end of header file
 #endif
@@ -9,7 +9,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 #include <stdbool.h>
-#include <math.h>
+#include <stddef.h>
 
 #include "../colrcv.h"
 #include "lab.h"
@@ -17,6 +17,11 @@
 #include "hsv.h"
 #include "hsl.h"
 #include "xyz.h"
+#include "../internal/batch.h"
+#include "../internal/kernels.h"
+#include "../internal/scalar_lab.h"
+#include "../internal/stats.h"
+#include "../internal/simd.h"
 
 
 #ifdef __cplusplus
@@ -28,91 +33,269 @@ const double COLRCV_LAB_A_MIN_VALUE = -100;
 const double COLRCV_LAB_B_MIN_VALUE = -100;
 const double COLRCV_LAB_MAX_VALUE = 100;
 
-bool colrcv_lab_l_is_valid(colrcv_lab_t lab) {
-    return colrcv_range_valid(
-        COLRCV_LAB_L_MIN_VALUE, lab.l, COLRCV_LAB_MAX_VALUE
+size_t colrcv_lab_validate_soa(
+    const double* l, const double* a, const double* b,
+    uint8_t* invalid, size_t count
+) {
+    return colrcv_batch_validate(
+        COLRCV_MODEL_LAB, l, a, b, invalid, count
     );
 }
 
-bool colrcv_lab_a_is_valid(colrcv_lab_t lab) {
-    return colrcv_range_valid(
-        COLRCV_LAB_A_MIN_VALUE, lab.a, COLRCV_LAB_MAX_VALUE
+void colrcv_lab_clamp_soa(
+    double* l, double* a, double* b, size_t count
+) {
+    colrcv_batch_clamp(COLRCV_MODEL_LAB, l, a, b, count);
+}
+
+colrcv_rgb8_t colrcv_lab_to_rgb8(colrcv_lab_t lab) {
+    // Two-step conversion using LAB->XYZ and XYZ->RGB
+    return colrcv_xyz_to_rgb8(kernel_lab_to_xyz(lab));
+}
+
+colrcv_rgb16_t colrcv_lab_to_rgb16(colrcv_lab_t lab) {
+    // Two-step conversion using LAB->XYZ and XYZ->RGB
+    return colrcv_xyz_to_rgb16(kernel_lab_to_xyz(lab));
+}
+
+void colrcv_lab_to_rgb_soa(
+    const double* l, const double* a, const double* lab_b,
+    double* r, double* g, double* rgb_b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_lab_to_rgb_soa, count
+    );
+    // Two-step conversion using LAB->XYZ and XYZ->RGB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_lab_to_xyz_soa,
+        colrcv_xyz_to_rgb_soa,
+    };
+    colrcv_batch_convert_chain(
+        stages, 2, l, a, lab_b, r, g, rgb_b, count
     );
+    colrcv_stats_batch_end(begun);
 }
 
-bool colrcv_lab_b_is_valid(colrcv_lab_t lab) {
-    return colrcv_range_valid(
-        COLRCV_LAB_B_MIN_VALUE, lab.b, COLRCV_LAB_MAX_VALUE
+void colrcv_lab_to_hsv_soa(
+    const double* l, const double* a, const double* b,
+    double* h, double* s, double* v,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_lab_to_hsv_soa, count
+    );
+    // Three-step conversion using LAB->XYZ, XYZ->RGB and RGB->HSV
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_lab_to_xyz_soa,
+        colrcv_batch_xyz_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_hsv,
+    };
+    colrcv_batch_convert_chain(
+        stages, 3, l, a, b, h, s, v, count
     );
+    colrcv_stats_batch_end(begun);
 }
 
-bool colrcv_lab_is_valid(colrcv_lab_t lab) {
-    // check that the value of each component is in range
-    return (
-        colrcv_lab_l_is_valid(lab) &&
-        colrcv_lab_a_is_valid(lab) &&
-        colrcv_lab_b_is_valid(lab)
+void colrcv_lab_to_hsl_soa(
+    const double* lab_l, const double* a, const double* b,
+    double* h, double* s, double* hsl_l,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_lab_to_hsl_soa, count
+    );
+    // Three-step conversion using LAB->XYZ, XYZ->RGB and RGB->HSL
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_lab_to_xyz_soa,
+        colrcv_batch_xyz_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_hsl,
+    };
+    colrcv_batch_convert_chain(
+        stages, 3, lab_l, a, b, h, s, hsl_l, count
     );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_lab_t colrcv_lab_clamp(colrcv_lab_t lab) {
-    // run all clamping functions on the value
-    return colrcv_lab_clamp_b(colrcv_lab_clamp_a(colrcv_lab_clamp_l(lab)));
+void colrcv_lab_to_xyz_soa(
+    const double* l, const double* a, const double* b,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_lab_to_xyz_soa, count
+    );
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_xyz_t xyz = kernel_lab_to_xyz(
+            (colrcv_lab_t){ .l = l[i], .a = a[i], .b = b[i], }
+        );
+        x[i] = xyz.x;
+        y[i] = xyz.y;
+        z[i] = xyz.z;
+    }
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_lab_t colrcv_lab_clamp_l(colrcv_lab_t lab) {
-    // clamp lightness channel
-    lab.l = colrcv_clamp(lab.l, COLRCV_LAB_L_MIN_VALUE, COLRCV_LAB_MAX_VALUE);
-    return lab;
+// Structure-of-Arrays conversion from LAB to linear RGB in range 0 -> 1
+static void lab_to_linear_rgb_soa(
+    const double* l, const double* a, const double* b,
+    double* r, double* g, double* rgb_b,
+    size_t count
+) {
+    colrcv_lab_to_xyz_soa(l, a, b, r, g, rgb_b, count);
+    colrcv_simd_multiply_matrix(
+        KERNEL_XYZ_TO_RGB_MATRIX, 100.0, r, g, rgb_b, r, g, rgb_b, count
+    );
 }
 
-colrcv_lab_t colrcv_lab_clamp_a(colrcv_lab_t lab) {
-    // clamp a component channel
-    lab.a = colrcv_clamp(lab.a, COLRCV_LAB_A_MIN_VALUE, COLRCV_LAB_MAX_VALUE);
-    return lab;
+void colrcv_lab_to_rgb_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_lab_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-colrcv_lab_t colrcv_lab_clamp_b(colrcv_lab_t lab) {
-    // clamp b component channel
-    lab.b = colrcv_clamp(lab.b, COLRCV_LAB_B_MIN_VALUE, COLRCV_LAB_MAX_VALUE);
-    return lab;
+void colrcv_lab_to_hsv_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_lab_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-colrcv_rgb_t colrcv_lab_to_rgb(colrcv_lab_t lab) {
-    // Two-step conversion using LAB->XYZ and XYZ->RGB
-    return colrcv_xyz_to_rgb(colrcv_lab_to_xyz(lab));
+void colrcv_lab_to_hsl_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_lab_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-colrcv_hsv_t colrcv_lab_to_hsv(colrcv_lab_t lab) {
-    // Two-step conversion using LAB->RGB and RGB->HSV
-    return colrcv_rgb_to_hsv(colrcv_lab_to_rgb(lab));
+void colrcv_lab_to_xyz_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_lab_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-colrcv_hsl_t colrcv_lab_to_hsl(colrcv_lab_t lab) {
-    // Two-step conversion using LAB->RGB and RGB->HSL
-    return colrcv_rgb_to_hsl(colrcv_lab_to_rgb(lab));
+void colrcv_lab_to_rgb8_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_encode_rgb(
+        lab_to_linear_rgb_soa,
+        input, input_stride, output, output_stride, false, count
+    );
 }
 
-// private helper function for colrcv_lab_to_xyz
-static double convert_lab_for_xyz(double c) {
-    // get c cubed
-    const double c_cubed = pow(c, 3.0);
-    // converted component depends on size of cubed component
-    return (c_cubed > 0.008856) ? c_cubed : ((c - 16.0 / 116.0) / 7.787);
+void colrcv_lab_to_rgb16_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_rgb16_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_encode_rgb(
+        lab_to_linear_rgb_soa,
+        input, input_stride, output, output_stride, true, count
+    );
 }
 
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=08#text8
-colrcv_xyz_t colrcv_lab_to_xyz(colrcv_lab_t lab) {
-    // skew input values
-    const double y = (lab.l + 16.0) / 116.0;
-    const double x = lab.a / 500.0 + y;
-    const double z = y - lab.b / 200.0;
-    // normalise components and adjust for observer calibration
-    return (colrcv_xyz_t){
-        .x = COLRCV_XYZ_X_REF_VALUE * convert_lab_for_xyz(x),
-        .y = COLRCV_XYZ_Y_REF_VALUE * convert_lab_for_xyz(y),
-        .z = COLRCV_XYZ_Z_REF_VALUE * convert_lab_for_xyz(z),
-    };
+void colrcv_labf_to_rgbf_soa(
+    const float* l, const float* a, const float* lab_b,
+    float* r, float* g, float* rgb_b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_lab_to_rgb_soa, l, a, lab_b, r, g, rgb_b, count
+    );
+}
+
+void colrcv_labf_to_hsvf_soa(
+    const float* l, const float* a, const float* b,
+    float* h, float* s, float* v,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_lab_to_hsv_soa, l, a, b, h, s, v, count
+    );
+}
+
+void colrcv_labf_to_hslf_soa(
+    const float* lab_l, const float* a, const float* b,
+    float* h, float* s, float* hsl_l,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_lab_to_hsl_soa, lab_l, a, b, h, s, hsl_l, count
+    );
+}
+
+void colrcv_labf_to_xyzf_soa(
+    const float* l, const float* a, const float* b,
+    float* x, float* y, float* z,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_lab_to_xyz_soa, l, a, b, x, y, z, count
+    );
+}
+
+void colrcv_labf_to_rgbf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_lab_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_labf_to_hsvf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_lab_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_labf_to_hslf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_lab_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_labf_to_xyzf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_lab_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
 #ifdef __cplusplus
@@ -25,7 +25,10 @@
 #define SAXBOPHONE_COLRCV_MODELS_LAB_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+#include "../colrcv.h"
 #include "types.h"
 
 
@@ -47,6 +50,21 @@ struct colrcv_lab_t {
     double b;
 };
 
+/**
+ * @brief Used to represent a LAB colour in single precision
+ * @details This has the same channels and ranges as `colrcv_lab_t`, for
+ * pipelines which store colours as floats.
+ * @since `v0.6.0`
+ */
+struct colrcv_labf_t {
+    /** @brief The lightness. Should be in range 0 -> 100 */
+    float l;
+    /** @brief The a component. Should be in range -100 -> 100 */
+    float a;
+    /** @brief The b component. Should be in range -100 -> 100 */
+    float b;
+};
+
 /**
  * @details The minimum value that the l component should have
  * @since `v0.1.0`
@@ -77,7 +95,7 @@ extern const double COLRCV_LAB_MAX_VALUE;
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_lab_l_is_valid(colrcv_lab_t lab);
+COLRCV_SCALAR bool colrcv_lab_l_is_valid(colrcv_lab_t lab);
 
 /**
  * @brief Checks that saturation component of a given `colrcv_lab_t` struct is
@@ -86,7 +104,7 @@ bool colrcv_lab_l_is_valid(colrcv_lab_t lab);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_lab_a_is_valid(colrcv_lab_t lab);
+COLRCV_SCALAR bool colrcv_lab_a_is_valid(colrcv_lab_t lab);
 
 /**
  * @brief Checks that value component of a given `colrcv_lab_t` struct is valid
@@ -94,7 +112,7 @@ bool colrcv_lab_a_is_valid(colrcv_lab_t lab);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_lab_b_is_valid(colrcv_lab_t lab);
+COLRCV_SCALAR bool colrcv_lab_b_is_valid(colrcv_lab_t lab);
 
 /**
  * @brief Checks that the components of a given `colrcv_lab_t` struct are valid
@@ -102,7 +120,7 @@ bool colrcv_lab_b_is_valid(colrcv_lab_t lab);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_lab_is_valid(colrcv_lab_t lab);
+COLRCV_SCALAR bool colrcv_lab_is_valid(colrcv_lab_t lab);
 
 /**
  * @brief Makes all of the channels of a given `colrcv_lab_t` struct fit within
@@ -111,7 +129,7 @@ bool colrcv_lab_is_valid(colrcv_lab_t lab);
  * range.
  * @since `v0.4.0`
  */
-colrcv_lab_t colrcv_lab_clamp(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp(colrcv_lab_t lab);
 
 /**
  * @brief Makes the lightness channel of a given `colrcv_lab_t` struct fit
@@ -120,7 +138,7 @@ colrcv_lab_t colrcv_lab_clamp(colrcv_lab_t lab);
  * be within range.
  * @since `v0.4.0`
  */
-colrcv_lab_t colrcv_lab_clamp_l(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp_l(colrcv_lab_t lab);
 
 /**
  * @brief Makes the a component of a given `colrcv_lab_t` struct fit within the
@@ -129,7 +147,7 @@ colrcv_lab_t colrcv_lab_clamp_l(colrcv_lab_t lab);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_lab_t colrcv_lab_clamp_a(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp_a(colrcv_lab_t lab);
 
 /**
  * @brief Makes the b component of a given `colrcv_lab_t` struct fit within the
@@ -138,7 +156,44 @@ colrcv_lab_t colrcv_lab_clamp_a(colrcv_lab_t lab);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_lab_t colrcv_lab_clamp_b(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_lab_t colrcv_lab_clamp_b(colrcv_lab_t lab);
+
+/**
+ * @brief Checks that the components of an array of LAB colours are valid
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is checked as by `colrcv_lab_is_valid()`, but several
+ * colours are checked at once with the SIMD instructions chosen in `simd.h`.
+ * @param l Array of the LAB lightness components to be checked
+ * @param a Array of the LAB a components to be checked
+ * @param b Array of the LAB b components to be checked
+ * @param[out] invalid Array of `(count + 7) / 8` bytes to set bit `i % 8` of
+ * byte `i / 8` of for each colour `i` which is not valid, clearing the bits of
+ * the others. May be `NULL` if only the number of invalid colours is needed.
+ * @param count The number of colours in each of the arrays
+ * @returns The number of colours which are not valid
+ * @since `v0.6.0`
+ */
+size_t colrcv_lab_validate_soa(
+    const double* l, const double* a, const double* b,
+    uint8_t* invalid, size_t count
+);
+
+/**
+ * @brief Makes each colour of an array of LAB colours fit within the
+ * 'standard' range of each channel, in-place
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is clamped as by `colrcv_lab_clamp()`, giving exactly
+ * the same results, but several colours are clamped at once with the SIMD
+ * instructions chosen in `simd.h`.
+ * @param[in,out] l Array of the LAB lightness components to be clamped
+ * @param[in,out] a Array of the LAB a components to be clamped
+ * @param[in,out] b Array of the LAB b components to be clamped
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_lab_clamp_soa(
+    double* l, double* a, double* b, size_t count
+);
 
 /**
  * @brief Converts a LAB colour to an RGB colour
@@ -146,7 +201,31 @@ colrcv_lab_t colrcv_lab_clamp_b(colrcv_lab_t lab);
  * @returns The RGB colour that the LAB colour was converted to
  * @since `v0.1.0`
  */
-colrcv_rgb_t colrcv_lab_to_rgb(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_rgb_t colrcv_lab_to_rgb(colrcv_lab_t lab);
+
+/**
+ * @brief Converts a LAB colour to an 8-bit RGB colour
+ * @details The sRGB encoding is interpolated from a table rather than worked
+ * out with `pow()`. The interpolation error is below 0.02 of an output code,
+ * so the result is always within 0.52 of a code of the exact value found by
+ * `colrcv_lab_to_rgb()` (scaled to 8 bits).
+ * @param lab A LAB colour to be converted
+ * @returns The 8-bit RGB colour that the LAB colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_rgb8_t colrcv_lab_to_rgb8(colrcv_lab_t lab);
+
+/**
+ * @brief Converts a LAB colour to a 16-bit RGB colour
+ * @details The sRGB encoding is interpolated from a table rather than worked
+ * out with `pow()`. The interpolation error is below 0.02 of an output code,
+ * so the result is always within 0.52 of a code of the exact value found by
+ * `colrcv_lab_to_rgb()` (scaled to 16 bits).
+ * @param lab A LAB colour to be converted
+ * @returns The 16-bit RGB colour that the LAB colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_rgb16_t colrcv_lab_to_rgb16(colrcv_lab_t lab);
 
 /**
  * @brief Converts a LAB colour to a HSV colour
@@ -154,7 +233,7 @@ colrcv_rgb_t colrcv_lab_to_rgb(colrcv_lab_t lab);
  * @returns The HSV colour that the LAB colour was converted to
  * @since `v0.2.0`
  */
-colrcv_hsv_t colrcv_lab_to_hsv(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_hsv_t colrcv_lab_to_hsv(colrcv_lab_t lab);
 
 /**
  * @brief Converts a LAB colour to a HSL colour
@@ -162,7 +241,7 @@ colrcv_hsv_t colrcv_lab_to_hsv(colrcv_lab_t lab);
  * @returns The HSL colour that the LAB colour was converted to
  * @since `v0.2.0`
  */
-colrcv_hsl_t colrcv_lab_to_hsl(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_hsl_t colrcv_lab_to_hsl(colrcv_lab_t lab);
 
 /**
  * @brief Converts a LAB colour to an XYZ colour
@@ -170,11 +249,414 @@ colrcv_hsl_t colrcv_lab_to_hsl(colrcv_lab_t lab);
  * @returns The XYZ colour that the LAB colour was converted to
  * @since `v0.1.0`
  */
-colrcv_xyz_t colrcv_lab_to_xyz(colrcv_lab_t lab);
+COLRCV_SCALAR colrcv_xyz_t colrcv_lab_to_xyz(colrcv_lab_t lab);
+
+/**
+ * @brief Converts an array of LAB colours to RGB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param lab_b Array of the LAB b components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] rgb_b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_rgb_soa(
+    const double* l, const double* a, const double* lab_b,
+    double* r, double* g, double* rgb_b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to HSV colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param b Array of the LAB b components to be converted
+ * @param[out] h Array to write the converted HSV hue components to
+ * @param[out] s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_hsv_soa(
+    const double* l, const double* a, const double* b,
+    double* h, double* s, double* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to HSL colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param lab_l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param b Array of the LAB b components to be converted
+ * @param[out] h Array to write the converted HSL hue components to
+ * @param[out] s Array to write the converted HSL saturation components to
+ * @param[out] hsl_l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_hsl_soa(
+    const double* lab_l, const double* a, const double* b,
+    double* h, double* s, double* hsl_l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to XYZ colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param b Array of the LAB b components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_xyz_soa(
+    const double* l, const double* a, const double* b,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to RGB colours
+ * @details The colours may be stored in arrays of `colrcv_lab_t` and
+ * `colrcv_rgb_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_lab_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_rgb_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to HSV colours
+ * @details The colours may be stored in arrays of `colrcv_lab_t` and
+ * `colrcv_hsv_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_lab_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_hsv_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to HSL colours
+ * @details The colours may be stored in arrays of `colrcv_lab_t` and
+ * `colrcv_hsl_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_lab_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_hsl_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to XYZ colours
+ * @details The colours may be stored in arrays of `colrcv_lab_t` and
+ * `colrcv_xyz_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_lab_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_xyz_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to 8-bit RGB colours
+ * @details Gives the same results as `colrcv_lab_to_rgb8()`, to within
+ * rounding error. The colours may be fields of larger structs, by giving the
+ * distance in bytes between each colour.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_lab_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_rgb8_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of LAB colours to 16-bit RGB colours
+ * @details Gives the same results as `colrcv_lab_to_rgb16()`, to within
+ * rounding error. The colours may be fields of larger structs, by giving the
+ * distance in bytes between each colour.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_lab_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_lab_to_rgb16_strided(
+    const colrcv_lab_t* input, size_t input_stride,
+    colrcv_rgb16_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts a single-precision LAB colour to an RGB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_lab_to_rgb()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param lab A single-precision LAB colour to be converted
+ * @returns The single-precision RGB colour that the LAB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_rgbf_t colrcv_labf_to_rgbf(colrcv_labf_t lab);
+
+/**
+ * @brief Converts a single-precision LAB colour to a HSV colour
+ * @details The conversion is done in double precision by
+ * `colrcv_lab_to_hsv()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param lab A single-precision LAB colour to be converted
+ * @returns The single-precision HSV colour that the LAB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hsvf_t colrcv_labf_to_hsvf(colrcv_labf_t lab);
+
+/**
+ * @brief Converts a single-precision LAB colour to a HSL colour
+ * @details The conversion is done in double precision by
+ * `colrcv_lab_to_hsl()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param lab A single-precision LAB colour to be converted
+ * @returns The single-precision HSL colour that the LAB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hslf_t colrcv_labf_to_hslf(colrcv_labf_t lab);
+
+/**
+ * @brief Converts a single-precision LAB colour to an XYZ colour
+ * @details The conversion is done in double precision by
+ * `colrcv_lab_to_xyz()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param lab A single-precision LAB colour to be converted
+ * @returns The single-precision XYZ colour that the LAB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_xyzf_t colrcv_labf_to_xyzf(colrcv_labf_t lab);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to RGB colours
+ * @details As `colrcv_lab_to_rgb_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param lab_b Array of the LAB b components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] rgb_b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_rgbf_soa(
+    const float* l, const float* a, const float* lab_b,
+    float* r, float* g, float* rgb_b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to HSV colours
+ * @details As `colrcv_lab_to_hsv_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param b Array of the LAB b components to be converted
+ * @param[out] h Array to write the converted HSV hue components to
+ * @param[out] s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_hsvf_soa(
+    const float* l, const float* a, const float* b,
+    float* h, float* s, float* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to HSL colours
+ * @details As `colrcv_lab_to_hsl_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param lab_l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param b Array of the LAB b components to be converted
+ * @param[out] h Array to write the converted HSL hue components to
+ * @param[out] s Array to write the converted HSL saturation components to
+ * @param[out] hsl_l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_hslf_soa(
+    const float* lab_l, const float* a, const float* b,
+    float* h, float* s, float* hsl_l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to XYZ colours
+ * @details As `colrcv_lab_to_xyz_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param l Array of the LAB lightness components to be converted
+ * @param a Array of the LAB a components to be converted
+ * @param b Array of the LAB b components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_xyzf_soa(
+    const float* l, const float* a, const float* b,
+    float* x, float* y, float* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to RGB colours
+ * @details As `colrcv_lab_to_rgb_strided()`, but for `colrcv_labf_t` and
+ * `colrcv_rgbf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_lab_to_rgb()` rounded to the nearest float.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_labf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_rgbf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to HSV colours
+ * @details As `colrcv_lab_to_hsv_strided()`, but for `colrcv_labf_t` and
+ * `colrcv_hsvf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_lab_to_hsv()` rounded to the nearest float.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_labf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_hsvf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to HSL colours
+ * @details As `colrcv_lab_to_hsl_strided()`, but for `colrcv_labf_t` and
+ * `colrcv_hslf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_lab_to_hsl()` rounded to the nearest float.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_labf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_hslf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision LAB colours to XYZ colours
+ * @details As `colrcv_lab_to_xyz_strided()`, but for `colrcv_labf_t` and
+ * `colrcv_xyzf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_lab_to_xyz()` rounded to the nearest float.
+ * @param input Pointer to the first LAB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_labf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_labf_to_xyzf_strided(
+    const colrcv_labf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+);
 
 #ifdef __cplusplus
 } // extern "C"
 #endif
 
+// the definitions of the scalar functions, when they are to be inlined
+#ifdef COLRCV_INLINE
+#include "../internal/inline.h"
+#endif
+
 // end of header file
 #endif
@@ -9,7 +9,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 #include <stdbool.h>
-#include <math.h>
+#include <stddef.h>
 
 #include "../colrcv.h"
 #include "rgb.h"
@@ -17,6 +17,12 @@
 #include "hsl.h"
 #include "lab.h"
 #include "xyz.h"
+#include "../internal/batch.h"
+#include "../internal/kernels.h"
+#include "../internal/scalar_rgb.h"
+#include "../internal/stats.h"
+#include "../internal/simd.h"
+#include "../internal/tables.h"
 
 
 #ifdef __cplusplus
@@ -26,187 +32,326 @@ extern "C"{
 const double COLRCV_RGB_MIN_VALUE = 0;
 const double COLRCV_RGB_MAX_VALUE = 255;
 
-bool colrcv_rgb_r_is_valid(colrcv_rgb_t rgb) {
-    return colrcv_range_valid(
-        COLRCV_RGB_MIN_VALUE, rgb.r, COLRCV_RGB_MAX_VALUE
+size_t colrcv_rgb_validate_soa(
+    const double* r, const double* g, const double* b,
+    uint8_t* invalid, size_t count
+) {
+    return colrcv_batch_validate(
+        COLRCV_MODEL_RGB, r, g, b, invalid, count
     );
 }
 
-bool colrcv_rgb_g_is_valid(colrcv_rgb_t rgb) {
-    return colrcv_range_valid(
-        COLRCV_RGB_MIN_VALUE, rgb.g, COLRCV_RGB_MAX_VALUE
-    );
+void colrcv_rgb_clamp_soa(
+    double* r, double* g, double* b, size_t count
+) {
+    colrcv_batch_clamp(COLRCV_MODEL_RGB, r, g, b, count);
 }
 
-bool colrcv_rgb_b_is_valid(colrcv_rgb_t rgb) {
-    return colrcv_range_valid(
-        COLRCV_RGB_MIN_VALUE, rgb.b, COLRCV_RGB_MAX_VALUE
+colrcv_xyz_t colrcv_rgb8_to_xyz(colrcv_rgb8_t rgb) {
+    return kernel_rgb8_to_xyz(rgb);
+}
+
+colrcv_hsv8_t colrcv_rgb8_to_hsv8(colrcv_rgb8_t rgb) {
+    return kernel_rgb8_to_hsv8(rgb);
+}
+
+colrcv_hsl8_t colrcv_rgb8_to_hsl8(colrcv_rgb8_t rgb) {
+    return kernel_rgb8_to_hsl8(rgb);
+}
+
+void colrcv_rgb_to_hsv_soa(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* v,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_rgb_to_hsv_soa, count
     );
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsv_t hsv = kernel_rgb_to_hsv(
+            (colrcv_rgb_t){ .r = r[i], .g = g[i], .b = b[i], }
+        );
+        h[i] = hsv.h;
+        s[i] = hsv.s;
+        v[i] = hsv.v;
+    }
+    colrcv_stats_batch_end(begun);
 }
 
-bool colrcv_rgb_is_valid(colrcv_rgb_t rgb) {
-    // check that the value of each component is in range
-    return (
-        colrcv_rgb_r_is_valid(rgb) &&
-        colrcv_rgb_g_is_valid(rgb) &&
-        colrcv_rgb_b_is_valid(rgb)
+void colrcv_rgb_to_hsl_soa(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* l,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_rgb_to_hsl_soa, count
     );
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_hsl_t hsl = kernel_rgb_to_hsl(
+            (colrcv_rgb_t){ .r = r[i], .g = g[i], .b = b[i], }
+        );
+        h[i] = hsl.h;
+        s[i] = hsl.s;
+        l[i] = hsl.l;
+    }
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_rgb_t colrcv_rgb_clamp(colrcv_rgb_t rgb) {
-    // run all clamping functions on the value
-    return colrcv_rgb_clamp_b(colrcv_rgb_clamp_g(colrcv_rgb_clamp_r(rgb)));
+void colrcv_rgb_to_lab_soa(
+    const double* r, const double* g, const double* rgb_b,
+    double* l, double* a, double* lab_b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_rgb_to_lab_soa, count
+    );
+    // Two-step conversion using RGB->XYZ and XYZ->LAB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_rgb_to_xyz_soa,
+        colrcv_xyz_to_lab_soa,
+    };
+    colrcv_batch_convert_chain(
+        stages, 2, r, g, rgb_b, l, a, lab_b, count
+    );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_rgb_t colrcv_rgb_clamp_r(colrcv_rgb_t rgb) {
-    // clamp red channel
-    rgb.r = colrcv_clamp(rgb.r, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE);
-    return rgb;
+/*
+ * kernel_linearise_rgb() scaled up by 100 for each of `count` rgb channel
+ * values, approximated in fast accuracy mode. `out` may be the same as `in`
+ */
+static void convert_channel_for_xyz(
+    const double* in, double* out, size_t count
+) {
+    if(colrcv_get_accuracy() == COLRCV_ACCURACY_FAST) {
+        for(size_t i = 0; i < count; i++) {
+            out[i] = in[i] / 255;
+        }
+        colrcv_simd_srgb_to_linear(out, count);
+        for(size_t i = 0; i < count; i++) {
+            out[i] *= 100;
+        }
+    } else {
+        for(size_t i = 0; i < count; i++) {
+            out[i] = kernel_linearise_rgb(in[i]) * 100;
+        }
+    }
 }
 
-colrcv_rgb_t colrcv_rgb_clamp_g(colrcv_rgb_t rgb) {
-    // clamp green channel
-    rgb.g = colrcv_clamp(rgb.g, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE);
-    return rgb;
+void colrcv_rgb_to_xyz_soa(
+    const double* r, const double* g, const double* b,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_rgb_to_xyz_soa, count
+    );
+    // scale down and translate each channel
+    convert_channel_for_xyz(r, x, count);
+    convert_channel_for_xyz(g, y, count);
+    convert_channel_for_xyz(b, z, count);
+    // apply matrix transforms
+    colrcv_simd_multiply_matrix(
+        KERNEL_RGB_TO_XYZ_MATRIX, 1.0, x, y, z, x, y, z, count
+    );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_rgb_t colrcv_rgb_clamp_b(colrcv_rgb_t rgb) {
-    // clamp blue channel
-    rgb.b = colrcv_clamp(rgb.b, COLRCV_RGB_MIN_VALUE, COLRCV_RGB_MAX_VALUE);
-    return rgb;
+void colrcv_rgb_to_hsv_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_rgb_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-/* BEGIN private support functions */
+void colrcv_rgb_to_hsl_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_rgb_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
 
-// Scales down RGB amounts from 0->255 to 0->1
-static void scale_down_rgb(
-    colrcv_rgb_t rgb, double* restrict r, double* restrict g, double* restrict b
+void colrcv_rgb_to_lab_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
 ) {
-    *r = rgb.r / 255;
-    *g = rgb.g / 255;
-    *b = rgb.b / 255;
+    colrcv_batch_convert_strided(
+        colrcv_rgb_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-// sets the minimum, maximum and delta for a given set of rgb amounts
-static void get_min_max_delta(
-    double r, double g, double b,
-    double* restrict min, double* restrict max, double* restrict delta
+void colrcv_rgb_to_xyz_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
 ) {
-    *min = colrcv_min(r, colrcv_min(g, b));
-    *max = colrcv_max(r, colrcv_max(g, b));
-    *delta = *max - *min;
+    colrcv_batch_convert_strided(
+        colrcv_rgb_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-// returns the hue amount of HSV/HSL for given r, g, b, max and delta
-static double get_hue_amount(
-    double r, double g, double b, double max, double delta
+void colrcv_rgb8_to_xyz_strided(
+    const colrcv_rgb8_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
 ) {
-    // set the hue based on delta and which channel had the highest value
-    // (http://wiki.secondlife.com/wiki/Color_conversion_scripts)
-    double hue;
-    if(r == max) {
-        hue = (g - b) / delta;
-    } else if(g == max) {
-        hue = 2 + (b - r) / delta;
-    } else { // b == max
-        hue = 4 + (r - g) / delta;
-    }
-    // adjust hue to be in the 0-360 range
-    hue *= 60;
-    // wrap-around the output value of hue if needed
-    if(hue < 0) {
-        hue += 360;
-    } else if(hue > 360) {
-        hue -= 360;
+    // one array per channel, colours are converted in-place within these
+    double x[COLRCV_BATCH_TILE_SIZE];
+    double y[COLRCV_BATCH_TILE_SIZE];
+    double z[COLRCV_BATCH_TILE_SIZE];
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t remaining = count - start;
+        const size_t tile = (remaining < COLRCV_BATCH_TILE_SIZE)
+            ? remaining
+            : COLRCV_BATCH_TILE_SIZE;
+        // look up each channel of each colour into the tile
+        for(size_t i = 0; i < tile; i++) {
+            const colrcv_rgb8_t* rgb = (const colrcv_rgb8_t*)(
+                (const char*)input + (start + i) * input_stride
+            );
+            x[i] = COLRCV_SRGB_TO_LINEAR_TABLE[rgb->r] * 100;
+            y[i] = COLRCV_SRGB_TO_LINEAR_TABLE[rgb->g] * 100;
+            z[i] = COLRCV_SRGB_TO_LINEAR_TABLE[rgb->b] * 100;
+        }
+        // apply matrix transforms
+        colrcv_simd_multiply_matrix(
+            KERNEL_RGB_TO_XYZ_MATRIX, 1.0, x, y, z, x, y, z, tile
+        );
+        // scatter the converted channels out
+        for(size_t i = 0; i < tile; i++) {
+            colrcv_xyz_t* xyz = (colrcv_xyz_t*)(
+                (char*)output + (start + i) * output_stride
+            );
+            xyz->x = x[i];
+            xyz->y = y[i];
+            xyz->z = z[i];
+        }
     }
-    return hue;
-}
-
-/* END private support functions */
-
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=20#text20
-colrcv_hsv_t colrcv_rgb_to_hsv(colrcv_rgb_t rgb) {
-    double r, g, b, min_channel, max_channel, delta_channel;
-    // scale down each RGB channel
-    scale_down_rgb(rgb, &r, &g, &b);
-    // get min and max of these channels and the delta of min and max
-    get_min_max_delta(r, g, b, &min_channel, &max_channel, &delta_channel);
-    // output variable
-    colrcv_hsv_t hsv;
-    // the value component is set to max_channel (upscaled to 0-100 range)
-    hsv.v = max_channel * 100;
-    // if delta is 0, this is an achromatic grey
-    if(delta_channel == 0) {
-        hsv.h = 0;
-        hsv.s = 0;
-    } else {
-        // set saturation and upscale to the 0-100 range
-        hsv.s = (delta_channel / max_channel) * 100;
-        // finally, set the hue
-        hsv.h = get_hue_amount(r, g, b, max_channel, delta_channel);
+}
+
+void colrcv_rgb8_to_hsv8_strided(
+    const colrcv_rgb8_t* input, size_t input_stride,
+    colrcv_hsv8_t* output, size_t output_stride,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_rgb8_t* rgb = (const colrcv_rgb8_t*)(
+            (const char*)input + i * input_stride
+        );
+        *(colrcv_hsv8_t*)((char*)output + i * output_stride) = (
+            kernel_rgb8_to_hsv8(*rgb)
+        );
     }
-    return hsv;
-}
-
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=18#text18
-colrcv_hsl_t colrcv_rgb_to_hsl(colrcv_rgb_t rgb) {
-    double r, g, b, min_channel, max_channel, delta_channel;
-    // scale down each RGB channel
-    scale_down_rgb(rgb, &r, &g, &b);
-    // get min and max of these channels and the delta of min and max
-    get_min_max_delta(r, g, b, &min_channel, &max_channel, &delta_channel);
-    // output variable
-    colrcv_hsl_t hsl;
-    // the lightness component is set to the average of max and min of channels
-    hsl.l = (max_channel + min_channel) / 2 * 100;
-    // if delta is 0, this is an achromatic grey
-    if(delta_channel == 0) {
-        hsl.h = 0;
-        hsl.s = 0;
-    } else {
-        /*
-         * saturation is set differently depending on if lightness amount is
-         * less than or greater than half
-         */
-        if(hsl.l < 50) {
-            hsl.s = delta_channel / (max_channel + min_channel) * 100;
-        } else {
-            hsl.s = delta_channel / (2 - max_channel - min_channel) * 100;
-        }
-        // finally, set the hue
-        hsl.h = get_hue_amount(r, g, b, max_channel, delta_channel);
+}
+
+void colrcv_rgb8_to_hsl8_strided(
+    const colrcv_rgb8_t* input, size_t input_stride,
+    colrcv_hsl8_t* output, size_t output_stride,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        const colrcv_rgb8_t* rgb = (const colrcv_rgb8_t*)(
+            (const char*)input + i * input_stride
+        );
+        *(colrcv_hsl8_t*)((char*)output + i * output_stride) = (
+            kernel_rgb8_to_hsl8(*rgb)
+        );
     }
-    return hsl;
 }
 
-colrcv_lab_t colrcv_rgb_to_lab(colrcv_rgb_t rgb) {
-    // Two-step conversion using RGB->XYZ and XYZ->LAB
-    return colrcv_xyz_to_lab(colrcv_rgb_to_xyz(rgb));
+void colrcv_rgbf_to_hsvf_soa(
+    const float* r, const float* g, const float* b,
+    float* h, float* s, float* v,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_rgb_to_hsv_soa, r, g, b, h, s, v, count
+    );
 }
 
-/*
- * private function for translating an rgb component into the range needed for
- * converting to XYZ
- */
-static double convert_rgb_for_xyz(double c) {
-    return (c > 0.04045) ? pow((c + 0.055) / 1.055, 2.4) : (c / 12.92);
-}
-
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=02#text2
-colrcv_xyz_t colrcv_rgb_to_xyz(colrcv_rgb_t rgb) {
-    double r, g, b;
-    // scale down each RGB channel
-    scale_down_rgb(rgb, &r, &g, &b);
-    // translate each channel
-    r = convert_rgb_for_xyz(r) * 100;
-    g = convert_rgb_for_xyz(g) * 100;
-    b = convert_rgb_for_xyz(b) * 100;
-    // apply matrix transforms
-    return (colrcv_xyz_t){
-        .x = r * 0.4124 + g * 0.3576 + b * 0.1805,
-        .y = r * 0.2126 + g * 0.7152 + b * 0.0722,
-        .z = r * 0.0193 + g * 0.1192 + b * 0.9505,
-    };
+void colrcv_rgbf_to_hslf_soa(
+    const float* r, const float* g, const float* b,
+    float* h, float* s, float* l,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_rgb_to_hsl_soa, r, g, b, h, s, l, count
+    );
+}
+
+void colrcv_rgbf_to_labf_soa(
+    const float* r, const float* g, const float* rgb_b,
+    float* l, float* a, float* lab_b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_rgb_to_lab_soa, r, g, rgb_b, l, a, lab_b, count
+    );
+}
+
+void colrcv_rgbf_to_xyzf_soa(
+    const float* r, const float* g, const float* b,
+    float* x, float* y, float* z,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_rgb_to_xyz_soa, r, g, b, x, y, z, count
+    );
+}
+
+void colrcv_rgbf_to_hsvf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_rgb_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_rgbf_to_hslf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_rgb_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_rgbf_to_labf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_rgb_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_rgbf_to_xyzf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_rgb_to_xyz_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
 #ifdef __cplusplus
@@ -25,7 +25,10 @@
 #define SAXBOPHONE_COLRCV_MODELS_RGB_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+#include "../colrcv.h"
 #include "types.h"
 
 
@@ -48,6 +51,51 @@ struct colrcv_rgb_t {
     double b;
 };
 
+/**
+ * @brief Used to represent an RGB colour with 8 bits per channel
+ * @details Such as the pixels of most image files. Every value of each channel
+ * is valid.
+ * @since `v0.6.0`
+ */
+struct colrcv_rgb8_t {
+    /** @brief The red component, in range 0 -> 255 */
+    uint8_t r;
+    /** @brief The green component, in range 0 -> 255 */
+    uint8_t g;
+    /** @brief The blue component, in range 0 -> 255 */
+    uint8_t b;
+};
+
+/**
+ * @brief Used to represent an RGB colour with 16 bits per channel
+ * @details Every value of each channel is valid. 65535 is the same brightness
+ * as 255 in `colrcv_rgb_t`.
+ * @since `v0.6.0`
+ */
+struct colrcv_rgb16_t {
+    /** @brief The red component, in range 0 -> 65535 */
+    uint16_t r;
+    /** @brief The green component, in range 0 -> 65535 */
+    uint16_t g;
+    /** @brief The blue component, in range 0 -> 65535 */
+    uint16_t b;
+};
+
+/**
+ * @brief Used to represent an RGB colour in single precision
+ * @details This has the same channels and ranges as `colrcv_rgb_t`, for
+ * pipelines which store colours as floats.
+ * @since `v0.6.0`
+ */
+struct colrcv_rgbf_t {
+    /** @brief The red component. Should be in range 0 -> 255 */
+    float r;
+    /** @brief The green component. Should be in range 0 -> 255 */
+    float g;
+    /** @brief The blue component. Should be in range 0 -> 255 */
+    float b;
+};
+
 /**
  * @details The minimum value that any of the components should have
  * @since `v0.1.0`
@@ -66,7 +114,7 @@ extern const double COLRCV_RGB_MAX_VALUE;
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_rgb_r_is_valid(colrcv_rgb_t rgb);
+COLRCV_SCALAR bool colrcv_rgb_r_is_valid(colrcv_rgb_t rgb);
 
 /**
  * @brief Checks that green component of a given `colrcv_rgb_t` struct is valid
@@ -74,7 +122,7 @@ bool colrcv_rgb_r_is_valid(colrcv_rgb_t rgb);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_rgb_g_is_valid(colrcv_rgb_t rgb);
+COLRCV_SCALAR bool colrcv_rgb_g_is_valid(colrcv_rgb_t rgb);
 
 /**
  * @brief Checks that blue component of a given `colrcv_rgb_t` struct is valid
@@ -82,7 +130,7 @@ bool colrcv_rgb_g_is_valid(colrcv_rgb_t rgb);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_rgb_b_is_valid(colrcv_rgb_t rgb);
+COLRCV_SCALAR bool colrcv_rgb_b_is_valid(colrcv_rgb_t rgb);
 
 /**
  * @brief Checks that the components of a given `colrcv_rgb_t` struct are valid
@@ -90,7 +138,7 @@ bool colrcv_rgb_b_is_valid(colrcv_rgb_t rgb);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_rgb_is_valid(colrcv_rgb_t rgb);
+COLRCV_SCALAR bool colrcv_rgb_is_valid(colrcv_rgb_t rgb);
 
 /**
  * @brief Makes all of the channels of a given `colrcv_rgb_t` struct fit within
@@ -99,7 +147,7 @@ bool colrcv_rgb_is_valid(colrcv_rgb_t rgb);
  * range.
  * @since `v0.4.0`
  */
-colrcv_rgb_t colrcv_rgb_clamp(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp(colrcv_rgb_t rgb);
 
 /**
  * @brief Makes the red channel of a given `colrcv_rgb_t` struct fit within the
@@ -108,7 +156,7 @@ colrcv_rgb_t colrcv_rgb_clamp(colrcv_rgb_t rgb);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_rgb_t colrcv_rgb_clamp_r(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp_r(colrcv_rgb_t rgb);
 
 /**
  * @brief Makes the green channel of a given `colrcv_rgb_t` struct fit within
@@ -117,7 +165,7 @@ colrcv_rgb_t colrcv_rgb_clamp_r(colrcv_rgb_t rgb);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_rgb_t colrcv_rgb_clamp_g(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp_g(colrcv_rgb_t rgb);
 
 /**
  * @brief Makes the blue channel of a given `colrcv_rgb_t` struct fit within
@@ -126,7 +174,44 @@ colrcv_rgb_t colrcv_rgb_clamp_g(colrcv_rgb_t rgb);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_rgb_t colrcv_rgb_clamp_b(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_rgb_t colrcv_rgb_clamp_b(colrcv_rgb_t rgb);
+
+/**
+ * @brief Checks that the components of an array of RGB colours are valid
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is checked as by `colrcv_rgb_is_valid()`, but several
+ * colours are checked at once with the SIMD instructions chosen in `simd.h`.
+ * @param r Array of the RGB red components to be checked
+ * @param g Array of the RGB green components to be checked
+ * @param b Array of the RGB blue components to be checked
+ * @param[out] invalid Array of `(count + 7) / 8` bytes to set bit `i % 8` of
+ * byte `i / 8` of for each colour `i` which is not valid, clearing the bits of
+ * the others. May be `NULL` if only the number of invalid colours is needed.
+ * @param count The number of colours in each of the arrays
+ * @returns The number of colours which are not valid
+ * @since `v0.6.0`
+ */
+size_t colrcv_rgb_validate_soa(
+    const double* r, const double* g, const double* b,
+    uint8_t* invalid, size_t count
+);
+
+/**
+ * @brief Makes each colour of an array of RGB colours fit within the
+ * 'standard' range of each channel, in-place
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is clamped as by `colrcv_rgb_clamp()`, giving exactly
+ * the same results, but several colours are clamped at once with the SIMD
+ * instructions chosen in `simd.h`.
+ * @param[in,out] r Array of the RGB red components to be clamped
+ * @param[in,out] g Array of the RGB green components to be clamped
+ * @param[in,out] b Array of the RGB blue components to be clamped
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_clamp_soa(
+    double* r, double* g, double* b, size_t count
+);
 
 /**
  * @brief Converts an RGB colour to a HSV colour
@@ -134,7 +219,7 @@ colrcv_rgb_t colrcv_rgb_clamp_b(colrcv_rgb_t rgb);
  * @returns The HSV colour that the RGB colour was converted to
  * @since `v0.1.0`
  */
-colrcv_hsv_t colrcv_rgb_to_hsv(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_hsv_t colrcv_rgb_to_hsv(colrcv_rgb_t rgb);
 
 /**
  * @brief Converts an RGB colour to a HSL colour
@@ -142,7 +227,7 @@ colrcv_hsv_t colrcv_rgb_to_hsv(colrcv_rgb_t rgb);
  * @returns The HSL colour that the RGB colour was converted to
  * @since `v0.1.0`
  */
-colrcv_hsl_t colrcv_rgb_to_hsl(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_hsl_t colrcv_rgb_to_hsl(colrcv_rgb_t rgb);
 
 /**
  * @brief Converts an RGB colour to a LAB colour
@@ -150,7 +235,7 @@ colrcv_hsl_t colrcv_rgb_to_hsl(colrcv_rgb_t rgb);
  * @returns The LAB colour that the RGB colour was converted to
  * @since `v0.1.0`
  */
-colrcv_lab_t colrcv_rgb_to_lab(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_lab_t colrcv_rgb_to_lab(colrcv_rgb_t rgb);
 
 /**
  * @brief Converts an RGB colour to an XYZ colour
@@ -158,11 +243,469 @@ colrcv_lab_t colrcv_rgb_to_lab(colrcv_rgb_t rgb);
  * @returns The XYZ colour that the RGB colour was converted to
  * @since `v0.1.0`
  */
-colrcv_xyz_t colrcv_rgb_to_xyz(colrcv_rgb_t rgb);
+COLRCV_SCALAR colrcv_xyz_t colrcv_rgb_to_xyz(colrcv_rgb_t rgb);
+
+/**
+ * @brief Converts an 8-bit RGB colour to an XYZ colour
+ * @details Each channel is looked up in a table rather than worked out, so
+ * this is quicker than `colrcv_rgb_to_xyz()`, which also uses the table for
+ * channels that are whole numbers. The results are exactly the same.
+ * @param rgb An 8-bit RGB colour to be converted
+ * @returns The XYZ colour that the RGB colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_xyz_t colrcv_rgb8_to_xyz(colrcv_rgb8_t rgb);
+
+/**
+ * @brief Converts an 8-bit RGB colour to an 8-bit HSV colour
+ * @details This uses integer arithmetic only, looking up reciprocals in tables
+ * instead of dividing. Hue and saturation are within 1 of the result of
+ * `colrcv_rgb_to_hsv()` scaled to the ranges of `colrcv_hsv8_t` and rounded to
+ * the nearest whole number, and value is exactly that.
+ * @param rgb An 8-bit RGB colour to be converted
+ * @returns The 8-bit HSV colour that the RGB colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_hsv8_t colrcv_rgb8_to_hsv8(colrcv_rgb8_t rgb);
+
+/**
+ * @brief Converts an 8-bit RGB colour to an 8-bit HSL colour
+ * @details This uses integer arithmetic only, looking up reciprocals in tables
+ * instead of dividing. Each channel is within 1 of the result of
+ * `colrcv_rgb_to_hsl()` scaled to the ranges of `colrcv_hsl8_t` and rounded to
+ * the nearest whole number.
+ * @param rgb An 8-bit RGB colour to be converted
+ * @returns The 8-bit HSL colour that the RGB colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_hsl8_t colrcv_rgb8_to_hsl8(colrcv_rgb8_t rgb);
+
+/**
+ * @brief Converts an array of RGB colours to HSV colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param b Array of the RGB blue components to be converted
+ * @param[out] h Array to write the converted HSV hue components to
+ * @param[out] s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_hsv_soa(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of RGB colours to HSL colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param b Array of the RGB blue components to be converted
+ * @param[out] h Array to write the converted HSL hue components to
+ * @param[out] s Array to write the converted HSL saturation components to
+ * @param[out] l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_hsl_soa(
+    const double* r, const double* g, const double* b,
+    double* h, double* s, double* l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of RGB colours to LAB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param rgb_b Array of the RGB blue components to be converted
+ * @param[out] l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] lab_b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_lab_soa(
+    const double* r, const double* g, const double* rgb_b,
+    double* l, double* a, double* lab_b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of RGB colours to XYZ colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param b Array of the RGB blue components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_xyz_soa(
+    const double* r, const double* g, const double* b,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of RGB colours to HSV colours
+ * @details The colours may be stored in arrays of `colrcv_rgb_t` and
+ * `colrcv_hsv_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgb_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_hsv_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of RGB colours to HSL colours
+ * @details The colours may be stored in arrays of `colrcv_rgb_t` and
+ * `colrcv_hsl_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgb_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_hsl_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of RGB colours to LAB colours
+ * @details The colours may be stored in arrays of `colrcv_rgb_t` and
+ * `colrcv_lab_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgb_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_lab_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of RGB colours to XYZ colours
+ * @details The colours may be stored in arrays of `colrcv_rgb_t` and
+ * `colrcv_xyz_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgb_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgb_to_xyz_strided(
+    const colrcv_rgb_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of 8-bit RGB colours to XYZ colours
+ * @details Each channel is looked up in a table rather than worked out. The
+ * results are the same as those of `colrcv_rgb8_to_xyz()`, to within rounding
+ * error. The colours may be fields of larger structs, by giving the distance
+ * in bytes between each colour.
+ * @param input Pointer to the first 8-bit RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgb8_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgb8_to_xyz_strided(
+    const colrcv_rgb8_t* input, size_t input_stride,
+    colrcv_xyz_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of 8-bit RGB colours to 8-bit HSV colours
+ * @details The results are the same as those of `colrcv_rgb8_to_hsv8()`. The
+ * colours may be fields of larger structs, by giving the distance in bytes
+ * between each colour.
+ * @param input Pointer to the first 8-bit RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgb8_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgb8_to_hsv8_strided(
+    const colrcv_rgb8_t* input, size_t input_stride,
+    colrcv_hsv8_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of 8-bit RGB colours to 8-bit HSL colours
+ * @details The results are the same as those of `colrcv_rgb8_to_hsl8()`. The
+ * colours may be fields of larger structs, by giving the distance in bytes
+ * between each colour.
+ * @param input Pointer to the first 8-bit RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgb8_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgb8_to_hsl8_strided(
+    const colrcv_rgb8_t* input, size_t input_stride,
+    colrcv_hsl8_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts a single-precision RGB colour to a HSV colour
+ * @details The conversion is done in double precision by
+ * `colrcv_rgb_to_hsv()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param rgb A single-precision RGB colour to be converted
+ * @returns The single-precision HSV colour that the RGB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hsvf_t colrcv_rgbf_to_hsvf(colrcv_rgbf_t rgb);
+
+/**
+ * @brief Converts a single-precision RGB colour to a HSL colour
+ * @details The conversion is done in double precision by
+ * `colrcv_rgb_to_hsl()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param rgb A single-precision RGB colour to be converted
+ * @returns The single-precision HSL colour that the RGB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hslf_t colrcv_rgbf_to_hslf(colrcv_rgbf_t rgb);
+
+/**
+ * @brief Converts a single-precision RGB colour to a LAB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_rgb_to_lab()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param rgb A single-precision RGB colour to be converted
+ * @returns The single-precision LAB colour that the RGB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_labf_t colrcv_rgbf_to_labf(colrcv_rgbf_t rgb);
+
+/**
+ * @brief Converts a single-precision RGB colour to an XYZ colour
+ * @details The conversion is done in double precision by
+ * `colrcv_rgb_to_xyz()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param rgb A single-precision RGB colour to be converted
+ * @returns The single-precision XYZ colour that the RGB colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_xyzf_t colrcv_rgbf_to_xyzf(colrcv_rgbf_t rgb);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to HSV colours
+ * @details As `colrcv_rgb_to_hsv_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param b Array of the RGB blue components to be converted
+ * @param[out] h Array to write the converted HSV hue components to
+ * @param[out] s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_hsvf_soa(
+    const float* r, const float* g, const float* b,
+    float* h, float* s, float* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to HSL colours
+ * @details As `colrcv_rgb_to_hsl_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param b Array of the RGB blue components to be converted
+ * @param[out] h Array to write the converted HSL hue components to
+ * @param[out] s Array to write the converted HSL saturation components to
+ * @param[out] l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_hslf_soa(
+    const float* r, const float* g, const float* b,
+    float* h, float* s, float* l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to LAB colours
+ * @details As `colrcv_rgb_to_lab_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param rgb_b Array of the RGB blue components to be converted
+ * @param[out] l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] lab_b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_labf_soa(
+    const float* r, const float* g, const float* rgb_b,
+    float* l, float* a, float* lab_b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to XYZ colours
+ * @details As `colrcv_rgb_to_xyz_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param r Array of the RGB red components to be converted
+ * @param g Array of the RGB green components to be converted
+ * @param b Array of the RGB blue components to be converted
+ * @param[out] x Array to write the converted XYZ x components to
+ * @param[out] y Array to write the converted XYZ y components to
+ * @param[out] z Array to write the converted XYZ z components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_xyzf_soa(
+    const float* r, const float* g, const float* b,
+    float* x, float* y, float* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to HSV colours
+ * @details As `colrcv_rgb_to_hsv_strided()`, but for `colrcv_rgbf_t` and
+ * `colrcv_hsvf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_rgb_to_hsv()` rounded to the nearest float.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgbf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_hsvf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to HSL colours
+ * @details As `colrcv_rgb_to_hsl_strided()`, but for `colrcv_rgbf_t` and
+ * `colrcv_hslf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_rgb_to_hsl()` rounded to the nearest float.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgbf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_hslf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to LAB colours
+ * @details As `colrcv_rgb_to_lab_strided()`, but for `colrcv_rgbf_t` and
+ * `colrcv_labf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_rgb_to_lab()` rounded to the nearest float.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgbf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_labf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision RGB colours to XYZ colours
+ * @details As `colrcv_rgb_to_xyz_strided()`, but for `colrcv_rgbf_t` and
+ * `colrcv_xyzf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_rgb_to_xyz()` rounded to the nearest float.
+ * @param input Pointer to the first RGB colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_rgbf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted XYZ colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_rgbf_to_xyzf_strided(
+    const colrcv_rgbf_t* input, size_t input_stride,
+    colrcv_xyzf_t* output, size_t output_stride,
+    size_t count
+);
 
 #ifdef __cplusplus
 } // extern "C"
 #endif
 
+// the definitions of the scalar functions, when they are to be inlined
+#ifdef COLRCV_INLINE
+#include "../internal/inline.h"
+#endif
+
 // end of header file
 #endif
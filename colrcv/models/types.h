@@ -35,18 +35,27 @@ extern "C"{
 
 // RGB
 typedef struct colrcv_rgb_t colrcv_rgb_t;
+typedef struct colrcv_rgb8_t colrcv_rgb8_t;
+typedef struct colrcv_rgb16_t colrcv_rgb16_t;
+typedef struct colrcv_rgbf_t colrcv_rgbf_t;
 
 // HSV
 typedef struct colrcv_hsv_t colrcv_hsv_t;
+typedef struct colrcv_hsvf_t colrcv_hsvf_t;
+typedef struct colrcv_hsv8_t colrcv_hsv8_t;
 
 // HSL
 typedef struct colrcv_hsl_t colrcv_hsl_t;
+typedef struct colrcv_hslf_t colrcv_hslf_t;
+typedef struct colrcv_hsl8_t colrcv_hsl8_t;
 
 // LAB
 typedef struct colrcv_lab_t colrcv_lab_t;
+typedef struct colrcv_labf_t colrcv_labf_t;
 
 // XYZ
 typedef struct colrcv_xyz_t colrcv_xyz_t;
+typedef struct colrcv_xyzf_t colrcv_xyzf_t;
 
 #ifdef __cplusplus
 } // extern "C"
@@ -9,7 +9,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 #include <stdbool.h>
-#include <math.h>
+#include <stddef.h>
 
 #include "../colrcv.h"
 #include "xyz.h"
@@ -17,6 +17,12 @@
 #include "hsv.h"
 #include "hsl.h"
 #include "lab.h"
+#include "../internal/batch.h"
+#include "../internal/kernels.h"
+#include "../internal/scalar_xyz.h"
+#include "../internal/stats.h"
+#include "../internal/tables.h"
+#include "../internal/simd.h"
 
 
 #ifdef __cplusplus
@@ -33,124 +39,290 @@ const double COLRCV_XYZ_X_REF_VALUE = 95.047;
 const double COLRCV_XYZ_Y_REF_VALUE = 100.0;
 const double COLRCV_XYZ_Z_REF_VALUE = 108.883;
 
-bool colrcv_xyz_x_is_valid(colrcv_xyz_t xyz) {
-    return colrcv_range_valid(
-        COLRCV_XYZ_MIN_VALUE, xyz.x, COLRCV_XYZ_X_MAX_VALUE
+size_t colrcv_xyz_validate_soa(
+    const double* x, const double* y, const double* z,
+    uint8_t* invalid, size_t count
+) {
+    return colrcv_batch_validate(
+        COLRCV_MODEL_XYZ, x, y, z, invalid, count
     );
 }
 
-bool colrcv_xyz_y_is_valid(colrcv_xyz_t xyz) {
-    return colrcv_range_valid(
-        COLRCV_XYZ_MIN_VALUE, xyz.y, COLRCV_XYZ_Y_MAX_VALUE
+void colrcv_xyz_clamp_soa(
+    double* x, double* y, double* z, size_t count
+) {
+    colrcv_batch_clamp(COLRCV_MODEL_XYZ, x, y, z, count);
+}
+
+colrcv_rgb8_t colrcv_xyz_to_rgb8(colrcv_xyz_t xyz) {
+    colrcv_tables_build_linear_to_srgb();
+    return kernel_xyz_to_rgb8(xyz);
+}
+
+colrcv_rgb16_t colrcv_xyz_to_rgb16(colrcv_xyz_t xyz) {
+    colrcv_tables_build_linear_to_srgb();
+    return kernel_xyz_to_rgb16(xyz);
+}
+
+void colrcv_xyz_to_rgb_soa(
+    const double* x, const double* y, const double* z,
+    double* r, double* g, double* b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_xyz_to_rgb_soa, count
     );
+    // convert and clamp components, then upscale them
+    colrcv_batch_xyz_to_unit_rgb(x, y, z, r, g, b, count);
+    for(size_t i = 0; i < count; i++) {
+        r[i] *= 255.0;
+        g[i] *= 255.0;
+        b[i] *= 255.0;
+    }
+    colrcv_stats_batch_end(begun);
 }
 
-bool colrcv_xyz_z_is_valid(colrcv_xyz_t xyz) {
-    return colrcv_range_valid(
-        COLRCV_XYZ_MIN_VALUE, xyz.z, COLRCV_XYZ_Z_MAX_VALUE
+void colrcv_xyz_to_hsv_soa(
+    const double* x, const double* y, const double* z,
+    double* h, double* s, double* v,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_xyz_to_hsv_soa, count
+    );
+    // Two-step conversion using XYZ->RGB and RGB->HSV, without scaling RGB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_batch_xyz_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_hsv,
+    };
+    colrcv_batch_convert_chain(
+        stages, 2, x, y, z, h, s, v, count
     );
+    colrcv_stats_batch_end(begun);
 }
 
-bool colrcv_xyz_is_valid(colrcv_xyz_t xyz) {
-    // check that the value of each component is in range
-    return (
-        colrcv_xyz_x_is_valid(xyz) &&
-        colrcv_xyz_y_is_valid(xyz) &&
-        colrcv_xyz_z_is_valid(xyz)
+void colrcv_xyz_to_hsl_soa(
+    const double* x, const double* y, const double* z,
+    double* h, double* s, double* l,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_xyz_to_hsl_soa, count
+    );
+    // Two-step conversion using XYZ->RGB and RGB->HSL, without scaling RGB
+    static const colrcv_soa_conversion_t stages[] = {
+        colrcv_batch_xyz_to_unit_rgb,
+        colrcv_batch_unit_rgb_to_hsl,
+    };
+    colrcv_batch_convert_chain(
+        stages, 2, x, y, z, h, s, l, count
     );
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_xyz_t colrcv_xyz_clamp(colrcv_xyz_t xyz) {
-    // run all clamping functions on the value
-    return colrcv_xyz_clamp_z(colrcv_xyz_clamp_y(colrcv_xyz_clamp_x(xyz)));
+// in-place kernel_convert_xyz_for_lab(), approximated in fast accuracy mode
+static void convert_channel_for_lab(double* channel, size_t count) {
+    if(colrcv_get_accuracy() == COLRCV_ACCURACY_FAST) {
+        colrcv_simd_xyz_for_lab(channel, count);
+    } else {
+        for(size_t i = 0; i < count; i++) {
+            channel[i] = kernel_convert_xyz_for_lab(channel[i]);
+        }
+    }
 }
 
-colrcv_xyz_t colrcv_xyz_clamp_x(colrcv_xyz_t xyz) {
-    // clamp x channel
-    xyz.x = colrcv_clamp(xyz.x, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_X_MAX_VALUE);
-    return xyz;
+void colrcv_xyz_to_lab_soa(
+    const double* x, const double* y, const double* z,
+    double* l, double* a, double* b,
+    size_t count
+) {
+    const bool begun = colrcv_stats_batch_begin(
+        colrcv_xyz_to_lab_soa, count
+    );
+    // skew input values, l, a and b hold the skewed x, y and z for now
+    for(size_t i = 0; i < count; i++) {
+        const double skewed_x = x[i] / COLRCV_XYZ_X_REF_VALUE;
+        const double skewed_y = y[i] / COLRCV_XYZ_Y_REF_VALUE;
+        const double skewed_z = z[i] / COLRCV_XYZ_Z_REF_VALUE;
+        l[i] = skewed_x;
+        a[i] = skewed_y;
+        b[i] = skewed_z;
+    }
+    // convert them
+    convert_channel_for_lab(l, count);
+    convert_channel_for_lab(a, count);
+    convert_channel_for_lab(b, count);
+    // convert to LAB ranges
+    for(size_t i = 0; i < count; i++) {
+        const double converted_x = l[i];
+        const double converted_y = a[i];
+        const double converted_z = b[i];
+        l[i] = (116 * converted_y) - 16;
+        a[i] = 500 * (converted_x - converted_y);
+        b[i] = 200 * (converted_y - converted_z);
+    }
+    colrcv_stats_batch_end(begun);
 }
 
-colrcv_xyz_t colrcv_xyz_clamp_y(colrcv_xyz_t xyz) {
-    // clamp y channel
-    xyz.y = colrcv_clamp(xyz.y, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_Y_MAX_VALUE);
-    return xyz;
+// Structure-of-Arrays conversion from XYZ to linear RGB in range 0 -> 1
+static void xyz_to_linear_rgb_soa(
+    const double* x, const double* y, const double* z,
+    double* r, double* g, double* b,
+    size_t count
+) {
+    colrcv_simd_multiply_matrix(
+        KERNEL_XYZ_TO_RGB_MATRIX, 100.0, x, y, z, r, g, b, count
+    );
 }
 
-colrcv_xyz_t colrcv_xyz_clamp_z(colrcv_xyz_t xyz) {
-    // clamp z channel
-    xyz.z = colrcv_clamp(xyz.z, COLRCV_XYZ_MIN_VALUE, COLRCV_XYZ_Z_MAX_VALUE);
-    return xyz;
+void colrcv_xyz_to_rgb_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_xyz_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-/* BEGIN private helper functions for colrcv_xyz_to_rgb */
+void colrcv_xyz_to_hsv_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_xyz_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
 
-static double convert_xyz_for_rgb(double c) {
-    return (c > 0.0031308) ? (1.055 * pow(c, 1.0 / 2.4) - 0.055) : (12.92 * c);
+void colrcv_xyz_to_hsl_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_xyz_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-// TODO: This will be added as a public library function later
-// XXX: This bit (clamping) wasn't in EasyRGB's algorithm. A bit questionable.
-static void clamp_rgb(colrcv_rgb_t* rgb) {
-    rgb->r = (rgb->r > 255) ? 255 : rgb->r;
-    rgb->r = (rgb->r < 0) ? 0 : rgb->r;
-    rgb->g = (rgb->g > 255) ? 255 : rgb->g;
-    rgb->g = (rgb->g < 0) ? 0 : rgb->g;
-    rgb->b = (rgb->b > 255) ? 255 : rgb->b;
-    rgb->b = (rgb->b < 0) ? 0 : rgb->b;
+void colrcv_xyz_to_lab_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_strided(
+        colrcv_xyz_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
-/* END private helper functions for colrcv_xyz_to_rgb */
+void colrcv_xyz_to_rgb8_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_encode_rgb(
+        xyz_to_linear_rgb_soa,
+        input, input_stride, output, output_stride, false, count
+    );
+}
 
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=01#text1
-colrcv_rgb_t colrcv_xyz_to_rgb(colrcv_xyz_t xyz) {
-    // shrink larger numbers downs
-    const double x = xyz.x / 100.0;
-    const double y = xyz.y / 100.0;
-    const double z = xyz.z / 100.0;
-    // multiplex the values
-    const double r = x *  3.2406 + y * -1.5372 + z * -0.4986;
-    const double g = x * -0.9689 + y *  1.8758 + z *  0.0415;
-    const double b = x *  0.0557 + y * -0.2040 + z *  1.0570;
-    // declare output variable
-    colrcv_rgb_t rgb;
-    // convert components and upscale
-    rgb.r = convert_xyz_for_rgb(r) * 255.0;
-    rgb.g = convert_xyz_for_rgb(g) * 255.0;
-    rgb.b = convert_xyz_for_rgb(b) * 255.0;
-    // clamp components
-    clamp_rgb(&rgb);
-    return rgb;
+void colrcv_xyz_to_rgb16_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_rgb16_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_encode_rgb(
+        xyz_to_linear_rgb_soa,
+        input, input_stride, output, output_stride, true, count
+    );
 }
 
-colrcv_hsv_t colrcv_xyz_to_hsv(colrcv_xyz_t xyz) {
-    // Two-step conversion using XYZ->RGB and RGB->HSV
-    return colrcv_rgb_to_hsv(colrcv_xyz_to_rgb(xyz));
+void colrcv_xyzf_to_rgbf_soa(
+    const float* x, const float* y, const float* z,
+    float* r, float* g, float* b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_xyz_to_rgb_soa, x, y, z, r, g, b, count
+    );
 }
 
-colrcv_hsl_t colrcv_xyz_to_hsl(colrcv_xyz_t xyz) {
-    // Two-step conversion using XYZ->RGB and RGB->HSL
-    return colrcv_rgb_to_hsl(colrcv_xyz_to_rgb(xyz));
+void colrcv_xyzf_to_hsvf_soa(
+    const float* x, const float* y, const float* z,
+    float* h, float* s, float* v,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_xyz_to_hsv_soa, x, y, z, h, s, v, count
+    );
 }
 
-// private helper function for colrcv_xyz_to_lab
-static double convert_xyz_for_lab(double c) {
-    // converted component needs the cube root of input if over a given size
-    return (c > 0.008856) ? pow(c, (1.0 / 3)) : (7.787 * c) + (16.0 / 116);
+void colrcv_xyzf_to_hslf_soa(
+    const float* x, const float* y, const float* z,
+    float* h, float* s, float* l,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_xyz_to_hsl_soa, x, y, z, h, s, l, count
+    );
 }
 
-// Algorithm: http://www.easyrgb.com/index.php?X=MATH&H=07#text7
-colrcv_lab_t colrcv_xyz_to_lab(colrcv_xyz_t xyz) {
-    // skew and convert input values
-    const double x = convert_xyz_for_lab(xyz.x / COLRCV_XYZ_X_REF_VALUE);
-    const double y = convert_xyz_for_lab(xyz.y / COLRCV_XYZ_Y_REF_VALUE);
-    const double z = convert_xyz_for_lab(xyz.z / COLRCV_XYZ_Z_REF_VALUE);
-    // convert to LAB ranges
-    return (colrcv_lab_t){
-        .l = (116 * y) - 16,
-        .a = 500 * (x - y),
-        .b = 200 * (y - z),
-    };
+void colrcv_xyzf_to_labf_soa(
+    const float* x, const float* y, const float* z,
+    float* l, float* a, float* b,
+    size_t count
+) {
+    colrcv_batch_convert_float_soa(
+        colrcv_xyz_to_lab_soa, x, y, z, l, a, b, count
+    );
+}
+
+void colrcv_xyzf_to_rgbf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_xyz_to_rgb_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_xyzf_to_hsvf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_xyz_to_hsv_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_xyzf_to_hslf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_xyz_to_hsl_soa,
+        input, input_stride, output, output_stride, count
+    );
+}
+
+void colrcv_xyzf_to_labf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+) {
+    colrcv_batch_convert_float_strided(
+        colrcv_xyz_to_lab_soa,
+        input, input_stride, output, output_stride, count
+    );
 }
 
 #ifdef __cplusplus
@@ -25,6 +25,8 @@
 #define SAXBOPHONE_COLRCV_MODELS_XYZ_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "../colrcv.h"
 #include "types.h"
@@ -49,6 +51,21 @@ struct colrcv_xyz_t {
     double z;
 };
 
+/**
+ * @brief Used to represent an XYZ colour in single precision
+ * @details This has the same channels and ranges as `colrcv_xyz_t`, for
+ * pipelines which store colours as floats.
+ * @since `v0.6.0`
+ */
+struct colrcv_xyzf_t {
+    /** @brief The x component. Should be in range 0 -> 112 */
+    float x;
+    /** @brief The y component. Should be in range 0 -> 100 */
+    float y;
+    /** @brief The z component. Should be in range 0 -> 123 */
+    float z;
+};
+
 /**
  * @details The minimum value that any of the components should have
  * @since `v0.1.0`
@@ -93,7 +110,7 @@ extern const double COLRCV_XYZ_Z_REF_VALUE;
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_xyz_x_is_valid(colrcv_xyz_t xyz);
+COLRCV_SCALAR bool colrcv_xyz_x_is_valid(colrcv_xyz_t xyz);
 
 /**
  * @brief Checks that y component of a given `colrcv_xyz_t` struct is
@@ -102,7 +119,7 @@ bool colrcv_xyz_x_is_valid(colrcv_xyz_t xyz);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_xyz_y_is_valid(colrcv_xyz_t xyz);
+COLRCV_SCALAR bool colrcv_xyz_y_is_valid(colrcv_xyz_t xyz);
 
 /**
  * @brief Checks that z component of a given `colrcv_xyz_t` struct is valid
@@ -110,7 +127,7 @@ bool colrcv_xyz_y_is_valid(colrcv_xyz_t xyz);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_xyz_z_is_valid(colrcv_xyz_t xyz);
+COLRCV_SCALAR bool colrcv_xyz_z_is_valid(colrcv_xyz_t xyz);
 
 /**
  * @brief Checks that the components of a given `colrcv_xyz_t` struct are valid
@@ -118,7 +135,7 @@ bool colrcv_xyz_z_is_valid(colrcv_xyz_t xyz);
  * @returns `false` if it is not valid
  * @since `v0.1.0`
  */
-bool colrcv_xyz_is_valid(colrcv_xyz_t xyz);
+COLRCV_SCALAR bool colrcv_xyz_is_valid(colrcv_xyz_t xyz);
 
 /**
  * @brief Makes all of the channels of a given `colrcv_xyz_t` struct fit within
@@ -127,7 +144,7 @@ bool colrcv_xyz_is_valid(colrcv_xyz_t xyz);
  * range.
  * @since `v0.4.0`
  */
-colrcv_xyz_t colrcv_xyz_clamp(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp(colrcv_xyz_t xyz);
 
 /**
  * @brief Makes the x component of a given `colrcv_xyz_t` struct fit within the
@@ -136,7 +153,7 @@ colrcv_xyz_t colrcv_xyz_clamp(colrcv_xyz_t xyz);
  * be within range.
  * @since `v0.4.0`
  */
-colrcv_xyz_t colrcv_xyz_clamp_x(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp_x(colrcv_xyz_t xyz);
 
 /**
  * @brief Makes the y component of a given `colrcv_xyz_t` struct fit within the
@@ -145,7 +162,7 @@ colrcv_xyz_t colrcv_xyz_clamp_x(colrcv_xyz_t xyz);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_xyz_t colrcv_xyz_clamp_y(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp_y(colrcv_xyz_t xyz);
 
 /**
  * @brief Makes the z component of a given `colrcv_xyz_t` struct fit within the
@@ -154,7 +171,44 @@ colrcv_xyz_t colrcv_xyz_clamp_y(colrcv_xyz_t xyz);
  * within range.
  * @since `v0.4.0`
  */
-colrcv_xyz_t colrcv_xyz_clamp_z(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_xyz_t colrcv_xyz_clamp_z(colrcv_xyz_t xyz);
+
+/**
+ * @brief Checks that the components of an array of XYZ colours are valid
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is checked as by `colrcv_xyz_is_valid()`, but several
+ * colours are checked at once with the SIMD instructions chosen in `simd.h`.
+ * @param x Array of the XYZ x components to be checked
+ * @param y Array of the XYZ y components to be checked
+ * @param z Array of the XYZ z components to be checked
+ * @param[out] invalid Array of `(count + 7) / 8` bytes to set bit `i % 8` of
+ * byte `i / 8` of for each colour `i` which is not valid, clearing the bits of
+ * the others. May be `NULL` if only the number of invalid colours is needed.
+ * @param count The number of colours in each of the arrays
+ * @returns The number of colours which are not valid
+ * @since `v0.6.0`
+ */
+size_t colrcv_xyz_validate_soa(
+    const double* x, const double* y, const double* z,
+    uint8_t* invalid, size_t count
+);
+
+/**
+ * @brief Makes each colour of an array of XYZ colours fit within the
+ * 'standard' range of each channel, in-place
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. Each colour is clamped as by `colrcv_xyz_clamp()`, giving exactly
+ * the same results, but several colours are clamped at once with the SIMD
+ * instructions chosen in `simd.h`.
+ * @param[in,out] x Array of the XYZ x components to be clamped
+ * @param[in,out] y Array of the XYZ y components to be clamped
+ * @param[in,out] z Array of the XYZ z components to be clamped
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_clamp_soa(
+    double* x, double* y, double* z, size_t count
+);
 
 /**
  * @brief Converts an XYZ colour to an RGB colour
@@ -162,7 +216,31 @@ colrcv_xyz_t colrcv_xyz_clamp_z(colrcv_xyz_t xyz);
  * @returns The RGB colour that the XYZ colour was converted to
  * @since `v0.1.0`
  */
-colrcv_rgb_t colrcv_xyz_to_rgb(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_rgb_t colrcv_xyz_to_rgb(colrcv_xyz_t xyz);
+
+/**
+ * @brief Converts an XYZ colour to an 8-bit RGB colour
+ * @details The sRGB encoding is interpolated from a table rather than worked
+ * out with `pow()`. The interpolation error is below 0.02 of an output code,
+ * so the result is always within 0.52 of a code of the exact value found by
+ * `colrcv_xyz_to_rgb()` (scaled to 8 bits).
+ * @param xyz An XYZ colour to be converted
+ * @returns The 8-bit RGB colour that the XYZ colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_rgb8_t colrcv_xyz_to_rgb8(colrcv_xyz_t xyz);
+
+/**
+ * @brief Converts an XYZ colour to a 16-bit RGB colour
+ * @details The sRGB encoding is interpolated from a table rather than worked
+ * out with `pow()`. The interpolation error is below 0.02 of an output code,
+ * so the result is always within 0.52 of a code of the exact value found by
+ * `colrcv_xyz_to_rgb()` (scaled to 16 bits).
+ * @param xyz An XYZ colour to be converted
+ * @returns The 16-bit RGB colour that the XYZ colour was converted to
+ * @since `v0.6.0`
+ */
+colrcv_rgb16_t colrcv_xyz_to_rgb16(colrcv_xyz_t xyz);
 
 /**
  * @brief Converts an XYZ colour to a HSV colour
@@ -170,7 +248,7 @@ colrcv_rgb_t colrcv_xyz_to_rgb(colrcv_xyz_t xyz);
  * @returns The HSV colour that the XYZ colour was converted to
  * @since `v0.2.0`
  */
-colrcv_hsv_t colrcv_xyz_to_hsv(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_hsv_t colrcv_xyz_to_hsv(colrcv_xyz_t xyz);
 
 /**
  * @brief Converts an XYZ colour to a HSL colour
@@ -178,7 +256,7 @@ colrcv_hsv_t colrcv_xyz_to_hsv(colrcv_xyz_t xyz);
  * @returns The HSL colour that the XYZ colour was converted to
  * @since `v0.2.0`
  */
-colrcv_hsl_t colrcv_xyz_to_hsl(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_hsl_t colrcv_xyz_to_hsl(colrcv_xyz_t xyz);
 
 /**
  * @brief Converts an XYZ colour to a LAB colour
@@ -186,11 +264,414 @@ colrcv_hsl_t colrcv_xyz_to_hsl(colrcv_xyz_t xyz);
  * @returns The LAB colour that the XYZ colour was converted to
  * @since `v0.1.0`
  */
-colrcv_lab_t colrcv_xyz_to_lab(colrcv_xyz_t xyz);
+COLRCV_SCALAR colrcv_lab_t colrcv_xyz_to_lab(colrcv_xyz_t xyz);
+
+/**
+ * @brief Converts an array of XYZ colours to RGB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_rgb_soa(
+    const double* x, const double* y, const double* z,
+    double* r, double* g, double* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to HSV colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] h Array to write the converted HSV hue components to
+ * @param[out] s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_hsv_soa(
+    const double* x, const double* y, const double* z,
+    double* h, double* s, double* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to HSL colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] h Array to write the converted HSL hue components to
+ * @param[out] s Array to write the converted HSL saturation components to
+ * @param[out] l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_hsl_soa(
+    const double* x, const double* y, const double* z,
+    double* h, double* s, double* l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to LAB colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_lab_soa(
+    const double* x, const double* y, const double* z,
+    double* l, double* a, double* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to RGB colours
+ * @details The colours may be stored in arrays of `colrcv_xyz_t` and
+ * `colrcv_rgb_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyz_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_rgb_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_rgb_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to HSV colours
+ * @details The colours may be stored in arrays of `colrcv_xyz_t` and
+ * `colrcv_hsv_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyz_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_hsv_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_hsv_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to HSL colours
+ * @details The colours may be stored in arrays of `colrcv_xyz_t` and
+ * `colrcv_hsl_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyz_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_hsl_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_hsl_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to LAB colours
+ * @details The colours may be stored in arrays of `colrcv_xyz_t` and
+ * `colrcv_lab_t` structs, or be fields of larger structs, by giving the
+ * distance in bytes between each colour. The conversion may be done in-place
+ * by giving the same address and stride for input and output.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyz_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_lab_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_lab_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to 8-bit RGB colours
+ * @details Gives the same results as `colrcv_xyz_to_rgb8()`, to within
+ * rounding error. The colours may be fields of larger structs, by giving the
+ * distance in bytes between each colour.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyz_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_rgb8_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_rgb8_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of XYZ colours to 16-bit RGB colours
+ * @details Gives the same results as `colrcv_xyz_to_rgb16()`, to within
+ * rounding error. The colours may be fields of larger structs, by giving the
+ * distance in bytes between each colour.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyz_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyz_to_rgb16_strided(
+    const colrcv_xyz_t* input, size_t input_stride,
+    colrcv_rgb16_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts a single-precision XYZ colour to an RGB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_xyz_to_rgb()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param xyz A single-precision XYZ colour to be converted
+ * @returns The single-precision RGB colour that the XYZ colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_rgbf_t colrcv_xyzf_to_rgbf(colrcv_xyzf_t xyz);
+
+/**
+ * @brief Converts a single-precision XYZ colour to a HSV colour
+ * @details The conversion is done in double precision by
+ * `colrcv_xyz_to_hsv()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param xyz A single-precision XYZ colour to be converted
+ * @returns The single-precision HSV colour that the XYZ colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hsvf_t colrcv_xyzf_to_hsvf(colrcv_xyzf_t xyz);
+
+/**
+ * @brief Converts a single-precision XYZ colour to a HSL colour
+ * @details The conversion is done in double precision by
+ * `colrcv_xyz_to_hsl()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param xyz A single-precision XYZ colour to be converted
+ * @returns The single-precision HSL colour that the XYZ colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_hslf_t colrcv_xyzf_to_hslf(colrcv_xyzf_t xyz);
+
+/**
+ * @brief Converts a single-precision XYZ colour to a LAB colour
+ * @details The conversion is done in double precision by
+ * `colrcv_xyz_to_lab()`, then each channel of the result is rounded to the
+ * nearest float.
+ * @param xyz A single-precision XYZ colour to be converted
+ * @returns The single-precision LAB colour that the XYZ colour was converted to
+ * @since `v0.6.0`
+ */
+COLRCV_SCALAR colrcv_labf_t colrcv_xyzf_to_labf(colrcv_xyzf_t xyz);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to RGB colours
+ * @details As `colrcv_xyz_to_rgb_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] r Array to write the converted RGB red components to
+ * @param[out] g Array to write the converted RGB green components to
+ * @param[out] b Array to write the converted RGB blue components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_rgbf_soa(
+    const float* x, const float* y, const float* z,
+    float* r, float* g, float* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to HSV colours
+ * @details As `colrcv_xyz_to_hsv_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] h Array to write the converted HSV hue components to
+ * @param[out] s Array to write the converted HSV saturation components to
+ * @param[out] v Array to write the converted HSV value components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_hsvf_soa(
+    const float* x, const float* y, const float* z,
+    float* h, float* s, float* v,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to HSL colours
+ * @details As `colrcv_xyz_to_hsl_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] h Array to write the converted HSL hue components to
+ * @param[out] s Array to write the converted HSL saturation components to
+ * @param[out] l Array to write the converted HSL lightness components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_hslf_soa(
+    const float* x, const float* y, const float* z,
+    float* h, float* s, float* l,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to LAB colours
+ * @details As `colrcv_xyz_to_lab_soa()`, but for arrays of floats. The
+ * conversion is done in double precision, so each result is that of the
+ * double-precision function rounded to the nearest float.
+ * @param x Array of the XYZ x components to be converted
+ * @param y Array of the XYZ y components to be converted
+ * @param z Array of the XYZ z components to be converted
+ * @param[out] l Array to write the converted LAB lightness components to
+ * @param[out] a Array to write the converted LAB a components to
+ * @param[out] b Array to write the converted LAB b components to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_labf_soa(
+    const float* x, const float* y, const float* z,
+    float* l, float* a, float* b,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to RGB colours
+ * @details As `colrcv_xyz_to_rgb_strided()`, but for `colrcv_xyzf_t` and
+ * `colrcv_rgbf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_xyz_to_rgb()` rounded to the nearest float.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyzf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted RGB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_rgbf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_rgbf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to HSV colours
+ * @details As `colrcv_xyz_to_hsv_strided()`, but for `colrcv_xyzf_t` and
+ * `colrcv_hsvf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_xyz_to_hsv()` rounded to the nearest float.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyzf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSV colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_hsvf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_hsvf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to HSL colours
+ * @details As `colrcv_xyz_to_hsl_strided()`, but for `colrcv_xyzf_t` and
+ * `colrcv_hslf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_xyz_to_hsl()` rounded to the nearest float.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyzf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted HSL colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_hslf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_hslf_t* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of single-precision XYZ colours to LAB colours
+ * @details As `colrcv_xyz_to_lab_strided()`, but for `colrcv_xyzf_t` and
+ * `colrcv_labf_t` structs. The conversion is done in double precision, so each
+ * result is that of `colrcv_xyz_to_lab()` rounded to the nearest float.
+ * @param input Pointer to the first XYZ colour to be converted
+ * @param input_stride Distance in bytes between each input colour (e.g.
+ * `sizeof(colrcv_xyzf_t)` for a plain array of them)
+ * @param[out] output Pointer to write the first converted LAB colour to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_xyzf_to_labf_strided(
+    const colrcv_xyzf_t* input, size_t input_stride,
+    colrcv_labf_t* output, size_t output_stride,
+    size_t count
+);
 
 #ifdef __cplusplus
 } // extern "C"
 #endif
 
+// the definitions of the scalar functions, when they are to be inlined
+#ifdef COLRCV_INLINE
+#include "../internal/inline.h"
+#endif
+
 // end of header file
 #endif
@@ -0,0 +1,416 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads and fseeko() when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "netpbm.h"
+#include "pool.h"
+#include "models/rgb.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the longest line of a PAM header, or token of a PPM header, that is read
+#define HEADER_LINE_SIZE 256
+
+/* BEGIN header parsing */
+
+// parses a whole decimal number from 1 to `max`, returning 0 if it isn't one
+static unsigned long parse_number(const char* text, unsigned long max) {
+    if(!isdigit((unsigned char)text[0])) {
+        return 0;
+    }
+    char* end;
+    const unsigned long value = strtoul(text, &end, 10);
+    return (*end != '\0' || value > max) ? 0 : value;
+}
+
+/*
+ * reads the next whitespace-separated token of a PPM header into `token`,
+ * skipping comments, and consumes the single whitespace character after it.
+ * returns false if there is no token or it is too long
+ */
+static bool read_ppm_token(FILE* input, char token[HEADER_LINE_SIZE]) {
+    int c = fgetc(input);
+    while(c != EOF && (isspace(c) || c == '#')) {
+        if(c == '#') {
+            while(c != EOF && c != '\n') {
+                c = fgetc(input);
+            }
+        }
+        c = fgetc(input);
+    }
+    size_t length = 0;
+    while(c != EOF && !isspace(c)) {
+        if(length == HEADER_LINE_SIZE - 1) {
+            return false;
+        }
+        token[length++] = (char)c;
+        c = fgetc(input);
+    }
+    token[length] = '\0';
+    return length > 0 && c != EOF;
+}
+
+static colrcv_netpbm_status_t read_ppm_header(
+    FILE* input, colrcv_netpbm_info_t* info
+) {
+    char token[HEADER_LINE_SIZE];
+    unsigned long values[3];
+    for(size_t i = 0; i < 3; i++) {
+        if(!read_ppm_token(input, token)) {
+            return COLRCV_NETPBM_BAD_HEADER;
+        }
+        values[i] = parse_number(token, (i == 2) ? 65535 : SIZE_MAX);
+        if(values[i] == 0) {
+            return COLRCV_NETPBM_BAD_HEADER;
+        }
+    }
+    *info = (colrcv_netpbm_info_t){
+        .width = values[0], .height = values[1],
+        .depth = 3, .maxval = (unsigned int)values[2],
+    };
+    return COLRCV_NETPBM_OK;
+}
+
+static colrcv_netpbm_status_t read_pam_header(
+    FILE* input, colrcv_netpbm_info_t* info
+) {
+    char line[HEADER_LINE_SIZE];
+    unsigned long width = 0, height = 0, depth = 0, maxval = 0;
+    while(true) {
+        if(fgets(line, sizeof(line), input) == NULL) {
+            return COLRCV_NETPBM_BAD_HEADER;
+        }
+        // split the line into its keyword and the rest
+        char* keyword = line;
+        while(isspace((unsigned char)*keyword)) {
+            keyword++;
+        }
+        char* value = keyword;
+        while(*value != '\0' && !isspace((unsigned char)*value)) {
+            value++;
+        }
+        if(*value != '\0') {
+            *value++ = '\0';
+        }
+        while(isspace((unsigned char)*value)) {
+            value++;
+        }
+        // trim trailing whitespace, including the newline
+        size_t length = strlen(value);
+        while(length > 0 && isspace((unsigned char)value[length - 1])) {
+            value[--length] = '\0';
+        }
+        if(strcmp(keyword, "ENDHDR") == 0) {
+            break;
+        } else if(strcmp(keyword, "WIDTH") == 0) {
+            width = parse_number(value, SIZE_MAX);
+        } else if(strcmp(keyword, "HEIGHT") == 0) {
+            height = parse_number(value, SIZE_MAX);
+        } else if(strcmp(keyword, "DEPTH") == 0) {
+            depth = parse_number(value, SIZE_MAX);
+        } else if(strcmp(keyword, "MAXVAL") == 0) {
+            maxval = parse_number(value, 65535);
+        }
+        // TUPLTYPE, comments and blank lines are not needed
+    }
+    if(width == 0 || height == 0 || depth == 0 || maxval == 0) {
+        return COLRCV_NETPBM_BAD_HEADER;
+    }
+    if(depth > 4) {
+        return COLRCV_NETPBM_UNSUPPORTED;
+    }
+    *info = (colrcv_netpbm_info_t){
+        .width = width, .height = height,
+        .depth = depth, .maxval = (unsigned int)maxval,
+    };
+    return COLRCV_NETPBM_OK;
+}
+
+/* END header parsing */
+
+// a block of rows, as read from the image and as converted
+typedef struct netpbm_block_t {
+    // the channels of each pixel of the rows, as stored in the image
+    uint8_t* raw;
+    // one plane of converted channels for each channel of the model
+    float* planes[3];
+    // the first row of the image in the block, and the number of rows
+    size_t first_row;
+    size_t rows;
+} netpbm_block_t;
+
+// everything needed to read and write blocks
+typedef struct netpbm_stream_t {
+    FILE* input;
+    FILE* output;
+    colrcv_netpbm_info_t info;
+    // the number of bytes in each channel of a pixel, and in each row
+    size_t sample_size;
+    size_t row_size;
+    size_t block_rows;
+} netpbm_stream_t;
+
+// reading and writing blocks, done on a second thread where possible
+typedef struct netpbm_io_t {
+    const netpbm_stream_t* stream;
+    // the block to write the planes of, or NULL
+    const netpbm_block_t* write;
+    // the block to read the rows from `read_row` onwards into, or NULL
+    netpbm_block_t* read;
+    size_t read_row;
+    colrcv_netpbm_status_t status;
+} netpbm_io_t;
+
+// reads the rows of a block, which must have `first_row` set
+static bool read_block(const netpbm_stream_t* stream, netpbm_block_t* block) {
+    const size_t remaining = stream->info.height - block->first_row;
+    block->rows = (remaining < stream->block_rows)
+        ? remaining
+        : stream->block_rows;
+    const size_t size = block->rows * stream->row_size;
+    return fread(block->raw, 1, size, stream->input) == size;
+}
+
+// writes each plane of a block to where its rows go in the output
+static bool write_block(
+    const netpbm_stream_t* stream, const netpbm_block_t* block
+) {
+    const size_t pixels = block->rows * stream->info.width;
+    for(size_t ch = 0; ch < 3; ch++) {
+        const off_t offset = (off_t)(
+            (ch * stream->info.height + block->first_row) * stream->info.width
+        ) * (off_t)sizeof(float);
+        if(
+            fseeko(stream->output, offset, SEEK_SET) != 0 ||
+            fwrite(
+                block->planes[ch], sizeof(float), pixels, stream->output
+            ) != pixels
+        ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void* run_io(void* argument) {
+    netpbm_io_t* io = argument;
+    io->status = COLRCV_NETPBM_OK;
+    if(io->write != NULL && !write_block(io->stream, io->write)) {
+        io->status = COLRCV_NETPBM_WRITE_ERROR;
+    } else if(io->read != NULL) {
+        io->read->first_row = io->read_row;
+        if(!read_block(io->stream, io->read)) {
+            io->status = COLRCV_NETPBM_READ_ERROR;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * converts the rows of a block to planes, with `r`, `g` and `b` as space for
+ * a block of each channel
+ */
+static void convert_block(
+    const netpbm_stream_t* stream, colrcv_soa_conversion_t conversion,
+    colrcv_pool_t* pool, netpbm_block_t* block,
+    double* r, double* g, double* b
+) {
+    const size_t pixels = block->rows * stream->info.width;
+    const size_t depth = stream->info.depth;
+    const double maxval = stream->info.maxval;
+    // greyscale images have one channel, repeated for red, green and blue
+    const size_t green = (depth < 3) ? 0 : 1;
+    const size_t blue = (depth < 3) ? 0 : 2;
+    for(size_t i = 0; i < pixels; i++) {
+        double samples[3];
+        for(size_t ch = 0; ch < 3 && ch < depth; ch++) {
+            const size_t index = i * depth + ch;
+            const unsigned int sample = (stream->sample_size == 1)
+                ? block->raw[index]
+                : (unsigned int)(
+                    block->raw[2 * index] << 8 | block->raw[2 * index + 1]
+                );
+            samples[ch] = sample * COLRCV_RGB_MAX_VALUE / maxval;
+        }
+        r[i] = samples[0];
+        g[i] = samples[green];
+        b[i] = samples[blue];
+    }
+    if(conversion != NULL) {
+        colrcv_pool_convert_soa(pool, conversion, r, g, b, r, g, b, pixels);
+    }
+    for(size_t i = 0; i < pixels; i++) {
+        block->planes[0][i] = (float)r[i];
+        block->planes[1][i] = (float)g[i];
+        block->planes[2][i] = (float)b[i];
+    }
+}
+
+// allocates the buffers of a block, returning false if it couldn't
+static bool allocate_block(
+    const netpbm_stream_t* stream, netpbm_block_t* block
+) {
+    const size_t pixels = stream->block_rows * stream->info.width;
+    block->raw = malloc(stream->block_rows * stream->row_size);
+    bool success = block->raw != NULL;
+    for(size_t ch = 0; ch < 3; ch++) {
+        block->planes[ch] = malloc(pixels * sizeof(float));
+        success = success && block->planes[ch] != NULL;
+    }
+    return success;
+}
+
+static void free_block(netpbm_block_t* block) {
+    free(block->raw);
+    for(size_t ch = 0; ch < 3; ch++) {
+        free(block->planes[ch]);
+    }
+}
+
+/*
+ * converts every block of the image, reading the next block and writing the
+ * last one on a second thread while converting the current one, so the
+ * two blocks are used in turn
+ */
+static colrcv_netpbm_status_t convert_blocks(
+    const netpbm_stream_t* stream, colrcv_soa_conversion_t conversion,
+    colrcv_pool_t* pool, netpbm_block_t blocks[2],
+    double* r, double* g, double* b
+) {
+    const size_t block_count = (
+        stream->info.height + stream->block_rows - 1
+    ) / stream->block_rows;
+    blocks[0].first_row = 0;
+    if(!read_block(stream, &blocks[0])) {
+        return COLRCV_NETPBM_READ_ERROR;
+    }
+    for(size_t k = 0; k < block_count; k++) {
+        netpbm_block_t* current = &blocks[k % 2];
+        netpbm_block_t* other = &blocks[(k + 1) % 2];
+        // the other block's planes are written before its rows are reused
+        netpbm_io_t io = {
+            .stream = stream,
+            .write = (k > 0) ? other : NULL,
+            .read = (k + 1 < block_count) ? other : NULL,
+            .read_row = (k + 1) * stream->block_rows,
+        };
+        pthread_t thread;
+        const bool threaded = pthread_create(&thread, NULL, run_io, &io) == 0;
+        convert_block(stream, conversion, pool, current, r, g, b);
+        if(threaded) {
+            pthread_join(thread, NULL);
+        } else {
+            run_io(&io);
+        }
+        if(io.status != COLRCV_NETPBM_OK) {
+            return io.status;
+        }
+    }
+    if(!write_block(stream, &blocks[(block_count - 1) % 2])) {
+        return COLRCV_NETPBM_WRITE_ERROR;
+    }
+    return (fflush(stream->output) == 0)
+        ? COLRCV_NETPBM_OK
+        : COLRCV_NETPBM_WRITE_ERROR;
+}
+
+colrcv_netpbm_status_t colrcv_netpbm_read_header(
+    FILE* input, colrcv_netpbm_info_t* info
+) {
+    char magic[3];
+    if(fread(magic, 1, 3, input) != 3 || magic[0] != 'P') {
+        return COLRCV_NETPBM_BAD_HEADER;
+    }
+    if(magic[1] == '6' && isspace((unsigned char)magic[2])) {
+        return read_ppm_header(input, info);
+    } else if(magic[1] == '7' && magic[2] == '\n') {
+        return read_pam_header(input, info);
+    }
+    return COLRCV_NETPBM_BAD_HEADER;
+}
+
+colrcv_netpbm_status_t colrcv_netpbm_convert(
+    FILE* input, FILE* output, colrcv_model_t to,
+    size_t block_rows, colrcv_pool_t* pool, colrcv_netpbm_info_t* info
+) {
+    if(!colrcv_model_is_valid(to)) {
+        return COLRCV_NETPBM_BAD_MODEL;
+    }
+    netpbm_stream_t stream = { .input = input, .output = output, };
+    colrcv_netpbm_status_t status = colrcv_netpbm_read_header(
+        input, &stream.info
+    );
+    if(status != COLRCV_NETPBM_OK) {
+        return status;
+    }
+    if(info != NULL) {
+        *info = stream.info;
+    }
+    stream.sample_size = (stream.info.maxval > 255) ? 2 : 1;
+    stream.block_rows = (block_rows == 0)
+        ? COLRCV_NETPBM_DEFAULT_BLOCK_ROWS
+        : block_rows;
+    if(stream.block_rows > stream.info.height) {
+        stream.block_rows = stream.info.height;
+    }
+    // the largest buffer is a block of rows of four 16-bit channels
+    if(stream.info.width > SIZE_MAX / stream.block_rows / 8) {
+        return COLRCV_NETPBM_OUT_OF_MEMORY;
+    }
+    stream.row_size = stream.info.width * stream.info.depth *
+        stream.sample_size;
+    // NULL when converting to RGB, as the image is already RGB
+    const colrcv_soa_conversion_t conversion = colrcv_get_soa_conversion(
+        COLRCV_MODEL_RGB, to
+    );
+    const size_t pixels = stream.block_rows * stream.info.width;
+    netpbm_block_t blocks[2] = { { .raw = NULL, }, { .raw = NULL, }, };
+    double* r = malloc(pixels * sizeof(double));
+    double* g = malloc(pixels * sizeof(double));
+    double* b = malloc(pixels * sizeof(double));
+    if(
+        allocate_block(&stream, &blocks[0]) &&
+        allocate_block(&stream, &blocks[1]) &&
+        r != NULL && g != NULL && b != NULL
+    ) {
+        status = convert_blocks(
+            &stream, conversion, pool, blocks, r, g, b
+        );
+    } else {
+        status = COLRCV_NETPBM_OUT_OF_MEMORY;
+    }
+    free_block(&blocks[0]);
+    free_block(&blocks[1]);
+    free(r);
+    free(g);
+    free(b);
+    return status;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,135 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares functions for converting PPM and PAM
+ * images of any size to planes of colours, a few rows at a time.
+ * @details Binary PPM (`P6`) images and PAM (`P7`) images with a depth of 1
+ * to 4 are supported, with a maxval of up to 65535. A depth of 1 or 2 is read
+ * as greyscale, and the last channel of a depth of 2 or 4 is alpha, which is
+ * ignored.
+ *
+ * Images are converted in blocks of rows, reading the next block and writing
+ * the last one on a second thread while the current one is converted, so the
+ * memory used depends only on the width of the image and the number of rows
+ * in a block.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_NETPBM_H
+#define SAXBOPHONE_COLRCV_NETPBM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "convert.h"
+#include "pool.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief The size and format of a PPM or PAM image
+ * @since `v0.6.0`
+ */
+typedef struct colrcv_netpbm_info_t {
+    /** @brief The number of pixels in each row */
+    size_t width;
+    /** @brief The number of rows */
+    size_t height;
+    /** @brief The number of channels in each pixel, 3 for a PPM image */
+    size_t depth;
+    /** @brief The largest value of each channel, from 1 to 65535 */
+    unsigned int maxval;
+} colrcv_netpbm_info_t;
+
+/**
+ * @brief The results of converting a PPM or PAM image
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_netpbm_status_t {
+    /** @brief The image was converted */
+    COLRCV_NETPBM_OK = 0,
+    /** @brief The header of the image is not that of a PPM or PAM image */
+    COLRCV_NETPBM_BAD_HEADER,
+    /** @brief The image is a kind of PAM image which is not supported */
+    COLRCV_NETPBM_UNSUPPORTED,
+    /** @brief The model to convert to is not valid */
+    COLRCV_NETPBM_BAD_MODEL,
+    /** @brief The image ended early or could not be read */
+    COLRCV_NETPBM_READ_ERROR,
+    /** @brief The output could not be written */
+    COLRCV_NETPBM_WRITE_ERROR,
+    /** @brief Memory could not be allocated */
+    COLRCV_NETPBM_OUT_OF_MEMORY,
+} colrcv_netpbm_status_t;
+
+/**
+ * @brief The number of rows converted at a time by
+ * `colrcv_netpbm_convert()` if a block size of `0` is given
+ * @since `v0.6.0`
+ */
+#define COLRCV_NETPBM_DEFAULT_BLOCK_ROWS 16
+
+/**
+ * @brief Reads the header of a PPM or PAM image
+ * @details Afterwards, the file is positioned at the start of the pixels.
+ * @param input The file to read from
+ * @param[out] info The size and format of the image
+ * @returns `COLRCV_NETPBM_OK` if the header was read
+ * @returns `COLRCV_NETPBM_BAD_HEADER` or `COLRCV_NETPBM_UNSUPPORTED` if not
+ * @since `v0.6.0`
+ */
+colrcv_netpbm_status_t colrcv_netpbm_read_header(
+    FILE* input, colrcv_netpbm_info_t* info
+);
+
+/**
+ * @brief Converts a PPM or PAM image to planes of colours of a colour model
+ * @details The output is three planes of `width * height` native-endian
+ * `float`s, one for each channel of the model converted to, with the first
+ * pixel of the top row first in each plane. The output is written out of
+ * order, so must be a file which can be seeked in. The batch conversion
+ * functions are used, so this follows the current accuracy mode.
+ * @param input The image to read, positioned at the start of its header
+ * @param output The file to write the planes to, positioned at its start
+ * @param to The colour model to convert to. `COLRCV_MODEL_RGB` gives the
+ * channels of the image scaled to the range of RGB
+ * @param block_rows The number of rows converted at a time, or `0` for
+ * `COLRCV_NETPBM_DEFAULT_BLOCK_ROWS`
+ * @param pool The pool to convert each block with, or `NULL` to convert on
+ * the calling thread
+ * @param[out] info Written with the size and format of the image, if not
+ * `NULL`
+ * @returns `COLRCV_NETPBM_OK` if the image was converted, or one of the other
+ * values of `colrcv_netpbm_status_t` if not
+ * @since `v0.6.0`
+ */
+colrcv_netpbm_status_t colrcv_netpbm_convert(
+    FILE* input, FILE* output, colrcv_model_t to,
+    size_t block_rows, colrcv_pool_t* pool, colrcv_netpbm_info_t* info
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,388 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "pixel.h"
+#include "models/rgb.h"
+#include "internal/batch.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// where each of the red, green, blue and alpha channels are in a pixel
+typedef struct pixel_layout_t {
+    // the number of bytes in each pixel
+    size_t size;
+    // whether each channel is a whole byte, rather than bits of a word
+    bool bytes;
+    // the byte offset of each channel, or its lowest bit within the word
+    unsigned int position[4];
+    // the number of bits in each channel, 0 for alpha if there is none
+    unsigned int bits[4];
+} pixel_layout_t;
+
+static const pixel_layout_t LAYOUTS[COLRCV_PIXEL_FORMAT_COUNT] = {
+    [COLRCV_PIXEL_RGBA8888] = {
+        .size = 4, .bytes = true,
+        .position = { 0, 1, 2, 3, }, .bits = { 8, 8, 8, 8, },
+    },
+    [COLRCV_PIXEL_BGRA8888] = {
+        .size = 4, .bytes = true,
+        .position = { 2, 1, 0, 3, }, .bits = { 8, 8, 8, 8, },
+    },
+    [COLRCV_PIXEL_RGB565] = {
+        .size = 2, .bytes = false,
+        .position = { 11, 5, 0, 0, }, .bits = { 5, 6, 5, 0, },
+    },
+    [COLRCV_PIXEL_RGB10A2] = {
+        .size = 4, .bytes = false,
+        .position = { 0, 10, 20, 30, }, .bits = { 10, 10, 10, 2, },
+    },
+};
+
+// where the converted colours are read from or written to
+typedef struct colour_arrays_t {
+    // channel arrays, used if `structs` is NULL
+    double* channels[3];
+    // colour structs `stride` bytes apart
+    char* structs;
+    size_t stride;
+} colour_arrays_t;
+
+static bool format_is_valid(colrcv_pixel_format_t format) {
+    return ((int)format >= 0) && ((int)format < COLRCV_PIXEL_FORMAT_COUNT);
+}
+
+static bool alpha_mode_is_valid(colrcv_alpha_mode_t alpha_mode) {
+    return (
+        alpha_mode == COLRCV_ALPHA_STRAIGHT ||
+        alpha_mode == COLRCV_ALPHA_PREMULTIPLIED
+    );
+}
+
+// the largest value a channel of the given number of bits can hold
+static uint32_t get_channel_max(unsigned int bits) {
+    return ((uint32_t)1 << bits) - 1;
+}
+
+// reads the raw value of each channel of a pixel into codes
+static void read_pixel(
+    const pixel_layout_t* layout, const uint8_t* pixel, uint32_t codes[4]
+) {
+    if(layout->bytes) {
+        for(size_t ch = 0; ch < 4; ch++) {
+            codes[ch] = pixel[layout->position[ch]];
+        }
+        return;
+    }
+    uint32_t word;
+    if(layout->size == 2) {
+        uint16_t half;
+        memcpy(&half, pixel, sizeof(half));
+        word = half;
+    } else {
+        memcpy(&word, pixel, sizeof(word));
+    }
+    for(size_t ch = 0; ch < 4; ch++) {
+        codes[ch] = (
+            (word >> layout->position[ch]) & get_channel_max(layout->bits[ch])
+        );
+    }
+}
+
+// writes the raw value of each channel of a pixel from codes
+static void write_pixel(
+    const pixel_layout_t* layout, const uint32_t codes[4], uint8_t* pixel
+) {
+    if(layout->bytes) {
+        for(size_t ch = 0; ch < 4; ch++) {
+            pixel[layout->position[ch]] = (uint8_t)codes[ch];
+        }
+        return;
+    }
+    uint32_t word = 0;
+    for(size_t ch = 0; ch < 4; ch++) {
+        word |= codes[ch] << layout->position[ch];
+    }
+    if(layout->size == 2) {
+        const uint16_t half = (uint16_t)word;
+        memcpy(pixel, &half, sizeof(half));
+    } else {
+        memcpy(pixel, &word, sizeof(word));
+    }
+}
+
+/*
+ * unpacks a tile of pixels to RGB channel arrays and an alpha array, dividing
+ * premultiplied colour by alpha
+ */
+static void unpack_tile(
+    const pixel_layout_t* layout, colrcv_alpha_mode_t alpha_mode,
+    const uint8_t* pixels, double* r, double* g, double* b, double* alpha,
+    size_t tile
+) {
+    /*
+     * the range of RGB or alpha and the largest raw value of each channel.
+     * raw values are divided rather than multiplied by a reciprocal, so that
+     * the largest one gives exactly the top of the range
+     */
+    double range[4], max[4];
+    for(size_t ch = 0; ch < 4; ch++) {
+        range[ch] = (ch == 3) ? 1.0 : COLRCV_RGB_MAX_VALUE;
+        max[ch] = get_channel_max(layout->bits[ch]);
+    }
+    const bool opaque = layout->bits[3] == 0;
+    for(size_t i = 0; i < tile; i++) {
+        uint32_t codes[4];
+        read_pixel(layout, pixels + i * layout->size, codes);
+        r[i] = codes[0] * range[0] / max[0];
+        g[i] = codes[1] * range[1] / max[1];
+        b[i] = codes[2] * range[2] / max[2];
+        alpha[i] = opaque ? 1.0 : codes[3] * range[3] / max[3];
+    }
+    if(alpha_mode == COLRCV_ALPHA_PREMULTIPLIED) {
+        for(size_t i = 0; i < tile; i++) {
+            if(alpha[i] > 0.0) {
+                r[i] = colrcv_min(r[i] / alpha[i], COLRCV_RGB_MAX_VALUE);
+                g[i] = colrcv_min(g[i] / alpha[i], COLRCV_RGB_MAX_VALUE);
+                b[i] = colrcv_min(b[i] / alpha[i], COLRCV_RGB_MAX_VALUE);
+            } else {
+                r[i] = g[i] = b[i] = 0.0;
+            }
+        }
+    }
+}
+
+// rounds a value in range 0 -> `range` to a raw channel value of `max`
+static uint32_t encode_channel(double value, double range, uint32_t max) {
+    // NaN gets past colrcv_clamp(), so is mapped to 0 before the cast
+    const double clamped = (value >= 0.0) ? colrcv_min(value, range) : 0.0;
+    return (uint32_t)(clamped * max / range + 0.5);
+}
+
+/*
+ * packs a tile of RGB channel arrays and an optional alpha array into pixels,
+ * multiplying colour by alpha if it is to be premultiplied
+ */
+static void pack_tile(
+    const double* r, const double* g, const double* b, const double* alpha,
+    const pixel_layout_t* layout, colrcv_alpha_mode_t alpha_mode,
+    uint8_t* pixels, size_t tile
+) {
+    uint32_t max[4];
+    for(size_t ch = 0; ch < 4; ch++) {
+        max[ch] = get_channel_max(layout->bits[ch]);
+    }
+    for(size_t i = 0; i < tile; i++) {
+        const double opacity = (alpha == NULL)
+            ? 1.0
+            : colrcv_clamp(alpha[i], 0.0, 1.0);
+        double channels[3] = { r[i], g[i], b[i], };
+        uint32_t codes[4];
+        for(size_t ch = 0; ch < 3; ch++) {
+            if(alpha_mode == COLRCV_ALPHA_PREMULTIPLIED) {
+                channels[ch] = colrcv_clamp(
+                    channels[ch], 0.0, COLRCV_RGB_MAX_VALUE
+                ) * opacity;
+            }
+            codes[ch] = encode_channel(
+                channels[ch], COLRCV_RGB_MAX_VALUE, max[ch]
+            );
+        }
+        codes[3] = encode_channel(opacity, 1.0, max[3]);
+        write_pixel(layout, codes, pixels + i * layout->size);
+    }
+}
+
+// checks the arguments shared by all of the conversions
+static bool arguments_are_valid(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    colrcv_model_t model
+) {
+    return (
+        format_is_valid(format) && alpha_mode_is_valid(alpha_mode) &&
+        colrcv_model_is_valid(model)
+    );
+}
+
+static void convert_from_pixels(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    colour_arrays_t output, double* alpha,
+    size_t count
+) {
+    const pixel_layout_t* layout = &LAYOUTS[format];
+    // NULL when converting to RGB, as the pixels are already RGB
+    const colrcv_soa_conversion_t conversion = colrcv_get_soa_conversion(
+        COLRCV_MODEL_RGB, to
+    );
+    // one array per channel, colours are converted in-place within these
+    double r[COLRCV_BATCH_TILE_SIZE];
+    double g[COLRCV_BATCH_TILE_SIZE];
+    double b[COLRCV_BATCH_TILE_SIZE];
+    double tile_alpha[COLRCV_BATCH_TILE_SIZE];
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t remaining = count - start;
+        const size_t tile = (remaining < COLRCV_BATCH_TILE_SIZE)
+            ? remaining
+            : COLRCV_BATCH_TILE_SIZE;
+        unpack_tile(
+            layout, alpha_mode,
+            (const uint8_t*)pixels + start * layout->size,
+            r, g, b, tile_alpha, tile
+        );
+        if(conversion != NULL) {
+            conversion(r, g, b, r, g, b, tile);
+        }
+        if(output.structs == NULL) {
+            memcpy(output.channels[0] + start, r, tile * sizeof(double));
+            memcpy(output.channels[1] + start, g, tile * sizeof(double));
+            memcpy(output.channels[2] + start, b, tile * sizeof(double));
+        } else {
+            for(size_t i = 0; i < tile; i++) {
+                double* colour = (double*)(
+                    output.structs + (start + i) * output.stride
+                );
+                colour[0] = r[i];
+                colour[1] = g[i];
+                colour[2] = b[i];
+            }
+        }
+        if(alpha != NULL) {
+            memcpy(alpha + start, tile_alpha, tile * sizeof(double));
+        }
+    }
+}
+
+static void convert_to_pixels(
+    colrcv_model_t from, colour_arrays_t input, const double* alpha,
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    void* pixels, size_t count
+) {
+    const pixel_layout_t* layout = &LAYOUTS[format];
+    // NULL when converting from RGB, as the pixels are RGB
+    const colrcv_soa_conversion_t conversion = colrcv_get_soa_conversion(
+        from, COLRCV_MODEL_RGB
+    );
+    double r[COLRCV_BATCH_TILE_SIZE];
+    double g[COLRCV_BATCH_TILE_SIZE];
+    double b[COLRCV_BATCH_TILE_SIZE];
+    for(size_t start = 0; start < count; start += COLRCV_BATCH_TILE_SIZE) {
+        const size_t remaining = count - start;
+        const size_t tile = (remaining < COLRCV_BATCH_TILE_SIZE)
+            ? remaining
+            : COLRCV_BATCH_TILE_SIZE;
+        if(input.structs == NULL) {
+            memcpy(r, input.channels[0] + start, tile * sizeof(double));
+            memcpy(g, input.channels[1] + start, tile * sizeof(double));
+            memcpy(b, input.channels[2] + start, tile * sizeof(double));
+        } else {
+            for(size_t i = 0; i < tile; i++) {
+                const double* colour = (const double*)(
+                    input.structs + (start + i) * input.stride
+                );
+                r[i] = colour[0];
+                g[i] = colour[1];
+                b[i] = colour[2];
+            }
+        }
+        if(conversion != NULL) {
+            conversion(r, g, b, r, g, b, tile);
+        }
+        pack_tile(
+            r, g, b, (alpha == NULL) ? NULL : alpha + start,
+            layout, alpha_mode, (uint8_t*)pixels + start * layout->size, tile
+        );
+    }
+}
+
+size_t colrcv_pixel_format_size(colrcv_pixel_format_t format) {
+    return format_is_valid(format) ? LAYOUTS[format].size : 0;
+}
+
+bool colrcv_pixels_to_soa(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    double* a, double* b, double* c, double* alpha,
+    size_t count
+) {
+    if(!arguments_are_valid(format, alpha_mode, to)) {
+        return false;
+    }
+    const colour_arrays_t output = {
+        .channels = { a, b, c, }, .structs = NULL, .stride = 0,
+    };
+    convert_from_pixels(format, alpha_mode, pixels, to, output, alpha, count);
+    return true;
+}
+
+bool colrcv_pixels_to_strided(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    void* output, size_t output_stride, double* alpha,
+    size_t count
+) {
+    if(!arguments_are_valid(format, alpha_mode, to)) {
+        return false;
+    }
+    const colour_arrays_t arrays = {
+        .channels = { NULL, NULL, NULL, },
+        .structs = (char*)output, .stride = output_stride,
+    };
+    convert_from_pixels(format, alpha_mode, pixels, to, arrays, alpha, count);
+    return true;
+}
+
+bool colrcv_soa_to_pixels(
+    colrcv_model_t from,
+    const double* a, const double* b, const double* c, const double* alpha,
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    void* pixels, size_t count
+) {
+    if(!arguments_are_valid(format, alpha_mode, from)) {
+        return false;
+    }
+    // the input is only read, but shares a struct with the output arrays
+    const colour_arrays_t input = {
+        .channels = { (double*)a, (double*)b, (double*)c, },
+        .structs = NULL, .stride = 0,
+    };
+    convert_to_pixels(from, input, alpha, format, alpha_mode, pixels, count);
+    return true;
+}
+
+bool colrcv_strided_to_pixels(
+    colrcv_model_t from,
+    const void* input, size_t input_stride, const double* alpha,
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    void* pixels, size_t count
+) {
+    if(!arguments_are_valid(format, alpha_mode, from)) {
+        return false;
+    }
+    const colour_arrays_t arrays = {
+        .channels = { NULL, NULL, NULL, },
+        .structs = (char*)input, .stride = input_stride,
+    };
+    convert_to_pixels(from, arrays, alpha, format, alpha_mode, pixels, count);
+    return true;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
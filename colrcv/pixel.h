@@ -0,0 +1,212 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares functions for converting packed pixels,
+ * such as those of a frame buffer, to and from any of the colour models.
+ * @details Pixels are unpacked a tile at a time inside the batch conversion
+ * loop, so there is no need to unpack a whole image into `colrcv_rgb_t`
+ * structs first. Each channel of a pixel is scaled to the range of RGB
+ * (`COLRCV_RGB_MIN_VALUE` to `COLRCV_RGB_MAX_VALUE`), and alpha to `0.0` to
+ * `1.0`.
+ *
+ * Formats made of 16-bit or 32-bit words are read and written in the native
+ * byte order of the machine. Formats made of 8-bit channels are listed in the
+ * order of their bytes in memory.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_PIXEL_H
+#define SAXBOPHONE_COLRCV_PIXEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "convert.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief The packed pixel formats supported by colrcv
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_pixel_format_t {
+    /** @brief 8-bit red, green, blue and alpha bytes, in that order */
+    COLRCV_PIXEL_RGBA8888 = 0,
+    /** @brief 8-bit blue, green, red and alpha bytes, in that order */
+    COLRCV_PIXEL_BGRA8888,
+    /**
+     * @brief A 16-bit word of 5-bit red in the top bits, 6-bit green and then
+     * 5-bit blue in the bottom bits
+     * @details There is no alpha channel, so pixels are read as opaque.
+     */
+    COLRCV_PIXEL_RGB565,
+    /**
+     * @brief A 32-bit word of 10-bit red in the bottom bits, 10-bit green,
+     * 10-bit blue and then 2-bit alpha in the top bits
+     */
+    COLRCV_PIXEL_RGB10A2,
+} colrcv_pixel_format_t;
+
+/**
+ * @brief The number of pixel formats in `colrcv_pixel_format_t`
+ * @since `v0.6.0`
+ */
+#define COLRCV_PIXEL_FORMAT_COUNT 4
+
+/**
+ * @brief The ways that the colour of a pixel can be stored with its alpha
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_alpha_mode_t {
+    /**
+     * @brief Colour is stored as it is, alpha is passed through untouched
+     */
+    COLRCV_ALPHA_STRAIGHT = 0,
+    /**
+     * @brief Colour is stored multiplied by alpha
+     * @details It is divided by alpha when pixels are read and multiplied by
+     * it again when pixels are written. Fully transparent pixels are read as
+     * black.
+     */
+    COLRCV_ALPHA_PREMULTIPLIED,
+} colrcv_alpha_mode_t;
+
+/**
+ * @brief Gets the number of bytes in each pixel of a pixel format
+ * @returns The size of a pixel in bytes
+ * @returns `0` if the format is not valid
+ * @since `v0.6.0`
+ */
+size_t colrcv_pixel_format_size(colrcv_pixel_format_t format);
+
+/**
+ * @brief Converts an array of packed pixels to an array of colours
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. The batch conversion functions are used, so this follows the
+ * current accuracy mode (see `colrcv_set_accuracy()`).
+ * @param format The pixel format of the pixels
+ * @param alpha_mode The way that colour is stored with alpha in the pixels
+ * @param pixels Pointer to the first pixel to be converted, which must be
+ * suitably aligned for the 16-bit or 32-bit word formats
+ * @param to The colour model to convert to
+ * @param[out] a Array to write the first channels of the colours to
+ * @param[out] b Array to write the second channels of the colours to
+ * @param[out] c Array to write the third channels of the colours to
+ * @param[out] alpha Array to write the alpha of each pixel to, in range
+ * `0.0` to `1.0`. May be `NULL` if alpha is not wanted
+ * @param count The number of pixels to convert
+ * @returns `true` if the pixels were converted
+ * @returns `false` if the format, alpha mode or model is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_pixels_to_soa(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    double* a, double* b, double* c, double* alpha,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of packed pixels to an array of colour structs
+ * @details The colours may be stored in arrays of colour structs of the model
+ * converted to, such as `colrcv_lab_t`, or be fields of larger structs, by
+ * giving the distance in bytes between each colour. Otherwise, this is the
+ * same as `colrcv_pixels_to_soa()`.
+ * @param format The pixel format of the pixels
+ * @param alpha_mode The way that colour is stored with alpha in the pixels
+ * @param pixels Pointer to the first pixel to be converted
+ * @param to The colour model to convert to
+ * @param[out] output Pointer to write the first colour struct to
+ * @param output_stride Distance in bytes between each output colour
+ * @param[out] alpha Array to write the alpha of each pixel to, in range
+ * `0.0` to `1.0`. May be `NULL` if alpha is not wanted
+ * @param count The number of pixels to convert
+ * @returns `true` if the pixels were converted
+ * @returns `false` if the format, alpha mode or model is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_pixels_to_strided(
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    const void* pixels, colrcv_model_t to,
+    void* output, size_t output_stride, double* alpha,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of colours to an array of packed pixels
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. They are clamped to the range of RGB and rounded to the nearest
+ * value that the pixel format can hold. The batch conversion functions are
+ * used, so this follows the current accuracy mode.
+ * @param from The colour model to convert from
+ * @param a Array of the first channels of the colours to be converted
+ * @param b Array of the second channels of the colours to be converted
+ * @param c Array of the third channels of the colours to be converted
+ * @param alpha Array of the alpha of each colour, in range `0.0` to `1.0`.
+ * May be `NULL`, in which case every pixel is written as opaque
+ * @param format The pixel format to write
+ * @param alpha_mode The way to store colour with alpha in the pixels
+ * @param[out] pixels Pointer to write the first pixel to, which must be
+ * suitably aligned for the 16-bit or 32-bit word formats
+ * @param count The number of colours to convert
+ * @returns `true` if the colours were converted
+ * @returns `false` if the format, alpha mode or model is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_soa_to_pixels(
+    colrcv_model_t from,
+    const double* a, const double* b, const double* c, const double* alpha,
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    void* pixels, size_t count
+);
+
+/**
+ * @brief Converts an array of colour structs to an array of packed pixels
+ * @details The colours may be stored in arrays of colour structs of the model
+ * converted from, such as `colrcv_lab_t`, or be fields of larger structs, by
+ * giving the distance in bytes between each colour. Otherwise, this is the
+ * same as `colrcv_soa_to_pixels()`.
+ * @param from The colour model to convert from
+ * @param input Pointer to the first colour struct to be converted
+ * @param input_stride Distance in bytes between each input colour
+ * @param alpha Array of the alpha of each colour, in range `0.0` to `1.0`.
+ * May be `NULL`, in which case every pixel is written as opaque
+ * @param format The pixel format to write
+ * @param alpha_mode The way to store colour with alpha in the pixels
+ * @param[out] pixels Pointer to write the first pixel to
+ * @param count The number of colours to convert
+ * @returns `true` if the colours were converted
+ * @returns `false` if the format, alpha mode or model is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_strided_to_pixels(
+    colrcv_model_t from,
+    const void* input, size_t input_stride, const double* alpha,
+    colrcv_pixel_format_t format, colrcv_alpha_mode_t alpha_mode,
+    void* pixels, size_t count
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
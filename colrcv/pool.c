@@ -0,0 +1,570 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads and sysconf() when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+#ifdef __APPLE__
+// macOS hides _SC_NPROCESSORS_ONLN when _POSIX_C_SOURCE is defined
+#define _DARWIN_C_SOURCE
+#endif
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "pool.h"
+#include "internal/batch.h"
+#include "internal/stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * the number of tiles that a thread converts at a time from its own deque.
+ * big enough that taking tiles from the deque costs little next to converting
+ * them, small enough that a thread never holds on to much more work than it
+ * can do before the others run out
+ */
+#define CHUNK_TILES 4
+
+// a conversion to be split across the threads of a pool
+typedef struct pool_job_t {
+    // converts the colours from `start` up to but not including `end`
+    void (* run)(const struct pool_job_t* job, size_t start, size_t end);
+    colrcv_soa_conversion_t conversion;
+    // Structure-of-Arrays channels, used by convert_soa_range()
+    const double* a;
+    const double* b;
+    const double* c;
+    double* x;
+    double* y;
+    double* z;
+    // colour structs, used by convert_strided_range()
+    const void* input;
+    size_t input_stride;
+    void* output;
+    size_t output_stride;
+    // any function and what it is called with, used by run_function_range()
+    colrcv_pool_function_t function;
+    void* context;
+    // the total number of colours to convert
+    size_t count;
+    // the number of tiles not yet converted, guarded by the pool's lock
+    size_t remaining;
+} pool_job_t;
+
+// a run of tiles of a job, from tile `begin` up to but not including `end`
+typedef struct pool_task_t {
+    pool_job_t* job;
+    size_t begin;
+    size_t end;
+} pool_task_t;
+
+/*
+ * a double-ended queue of tasks owned by one worker thread. the owner takes
+ * tiles from the front, other threads steal from the back.
+ * it is guarded by a mutex rather than being lock-free to keep it simple and
+ * portable: a lock-free deque needs atomics with careful memory ordering, which
+ * C99 only offers through compiler builtins such as GCC's. each operation moves
+ * a whole range of tiles, so the lock is taken rarely compared with the work
+ */
+typedef struct pool_deque_t {
+    pthread_mutex_t lock;
+    // ring buffer of `capacity` tasks, `size` of them in use from `front`
+    pool_task_t* tasks;
+    size_t capacity;
+    size_t front;
+    size_t size;
+} pool_deque_t;
+
+// what each worker thread is started with
+typedef struct pool_worker_t {
+    colrcv_pool_t* pool;
+    // the index of this thread's deque
+    size_t index;
+} pool_worker_t;
+
+struct colrcv_pool_t {
+    // the number of threads converting, including the caller
+    size_t thread_count;
+    /*
+     * the thread_count - 1 worker threads, what they were started with and
+     * the deque of each one
+     */
+    pthread_t* threads;
+    pool_worker_t* workers;
+    pool_deque_t* deques;
+    // guards everything below and the `remaining` field of each job
+    pthread_mutex_t lock;
+    // signalled when there are new tasks, or the pool is stopping
+    pthread_cond_t work_ready;
+    // signalled when the last tile of any job has been converted
+    pthread_cond_t job_done;
+    // incremented whenever tasks are added, so idle workers know to look
+    unsigned long generation;
+    bool stopping;
+};
+
+static void convert_soa_range(
+    const pool_job_t* job, size_t start, size_t end
+) {
+    // counted once for the whole job, by the thread which started it
+    const bool begun = colrcv_stats_part_begin();
+    job->conversion(
+        job->a + start, job->b + start, job->c + start,
+        job->x + start, job->y + start, job->z + start,
+        end - start
+    );
+    colrcv_stats_batch_end(begun);
+}
+
+static void convert_strided_range(
+    const pool_job_t* job, size_t start, size_t end
+) {
+    const bool begun = colrcv_stats_part_begin();
+    colrcv_batch_convert_strided(
+        job->conversion,
+        (const char*)job->input + start * job->input_stride,
+        job->input_stride,
+        (char*)job->output + start * job->output_stride,
+        job->output_stride,
+        end - start
+    );
+    colrcv_stats_batch_end(begun);
+}
+
+static void run_function_range(
+    const pool_job_t* job, size_t start, size_t end
+) {
+    job->function(job->context, start, end);
+}
+
+// gets the number of tiles needed to hold `count` colours
+static size_t get_tile_count(size_t count) {
+    return (count + COLRCV_BATCH_TILE_SIZE - 1) / COLRCV_BATCH_TILE_SIZE;
+}
+
+/*
+ * converts the tiles of a task and counts them as done. tasks are whole tiles,
+ * so every colour goes through the same tile boundaries as it would if one
+ * thread converted them all, and the results are the same
+ */
+static void run_task(colrcv_pool_t* pool, pool_task_t task) {
+    const size_t start = task.begin * COLRCV_BATCH_TILE_SIZE;
+    size_t end = task.end * COLRCV_BATCH_TILE_SIZE;
+    if(end > task.job->count) {
+        end = task.job->count;
+    }
+    task.job->run(task.job, start, end);
+    pthread_mutex_lock(&pool->lock);
+    task.job->remaining -= task.end - task.begin;
+    if(task.job->remaining == 0) {
+        // several callers may be waiting, each for its own job
+        pthread_cond_broadcast(&pool->job_done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* BEGIN deque */
+
+static bool deque_init(pool_deque_t* deque) {
+    deque->capacity = 4;
+    deque->tasks = malloc(deque->capacity * sizeof(pool_task_t));
+    deque->front = 0;
+    deque->size = 0;
+    if(deque->tasks == NULL) {
+        return false;
+    }
+    pthread_mutex_init(&deque->lock, NULL);
+    return true;
+}
+
+static void deque_destroy(pool_deque_t* deque) {
+    pthread_mutex_destroy(&deque->lock);
+    free(deque->tasks);
+}
+
+// gets the task `i` places from the front of a deque, which must be locked
+static pool_task_t* deque_at(pool_deque_t* deque, size_t i) {
+    return &deque->tasks[(deque->front + i) % deque->capacity];
+}
+
+/*
+ * adds a task to the back of a deque.
+ * returns false if there is no room and no more memory could be allocated
+ */
+static bool deque_push(pool_deque_t* deque, pool_task_t task) {
+    pthread_mutex_lock(&deque->lock);
+    if(deque->size == deque->capacity) {
+        // double the capacity, moving the tasks to the start of the buffer
+        pool_task_t* tasks = malloc(2 * deque->capacity * sizeof(pool_task_t));
+        if(tasks == NULL) {
+            pthread_mutex_unlock(&deque->lock);
+            return false;
+        }
+        for(size_t i = 0; i < deque->size; i++) {
+            tasks[i] = *deque_at(deque, i);
+        }
+        free(deque->tasks);
+        deque->tasks = tasks;
+        deque->capacity *= 2;
+        deque->front = 0;
+    }
+    *deque_at(deque, deque->size) = task;
+    deque->size++;
+    pthread_mutex_unlock(&deque->lock);
+    return true;
+}
+
+/*
+ * takes up to `CHUNK_TILES` tiles off the front of a deque, for its owner.
+ * returns false if the deque is empty
+ */
+static bool deque_take(pool_deque_t* deque, pool_task_t* task) {
+    pthread_mutex_lock(&deque->lock);
+    const bool found = deque->size > 0;
+    if(found) {
+        pool_task_t* front = deque_at(deque, 0);
+        *task = *front;
+        if(front->end - front->begin > CHUNK_TILES) {
+            task->end = front->begin + CHUNK_TILES;
+            front->begin = task->end;
+        } else {
+            deque->front = (deque->front + 1) % deque->capacity;
+            deque->size--;
+        }
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+/*
+ * steals tiles off the back of a deque, for another thread. at most
+ * `most` tiles are taken, but no more than half of the back task if it is big
+ * enough to split, so that its owner keeps the tiles it is about to reach.
+ * returns false if the deque is empty
+ */
+static bool deque_steal(pool_deque_t* deque, size_t most, pool_task_t* task) {
+    pthread_mutex_lock(&deque->lock);
+    const bool found = deque->size > 0;
+    if(found) {
+        pool_task_t* back = deque_at(deque, deque->size - 1);
+        const size_t tiles = back->end - back->begin;
+        size_t stolen = (tiles > CHUNK_TILES) ? tiles / 2 : tiles;
+        if(stolen > most) {
+            stolen = most;
+        }
+        *task = *back;
+        task->begin = back->end - stolen;
+        back->end = task->begin;
+        if(back->begin == back->end) {
+            deque->size--;
+        }
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+/* END deque */
+
+// tells idle workers that there are new tasks to look for
+static void announce_work(colrcv_pool_t* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/*
+ * steals up to `most` tiles from the deque of any worker other than `self`,
+ * trying each in turn after it. returns false if every deque is empty
+ */
+static bool steal_any(
+    colrcv_pool_t* pool, size_t self, size_t most, pool_task_t* task
+) {
+    const size_t worker_count = pool->thread_count - 1;
+    for(size_t i = 1; i <= worker_count; i++) {
+        const size_t victim = (self + i) % worker_count;
+        if(victim != self && deque_steal(&pool->deques[victim], most, task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * finds a task for a worker, from its own deque or else from another's.
+ * stolen tiles beyond the first chunk go on the worker's own deque, where they
+ * can be stolen again by any thread that runs out before this one does.
+ * returns false if there are no tasks anywhere
+ */
+static bool find_task(colrcv_pool_t* pool, size_t self, pool_task_t* task) {
+    pool_deque_t* own = &pool->deques[self];
+    if(deque_take(own, task)) {
+        return true;
+    }
+    if(!steal_any(pool, self, SIZE_MAX, task)) {
+        return false;
+    }
+    if(task->end - task->begin > CHUNK_TILES) {
+        pool_task_t rest = *task;
+        rest.begin = task->begin + CHUNK_TILES;
+        if(deque_push(own, rest)) {
+            task->end = rest.begin;
+            announce_work(pool);
+        }
+    }
+    return true;
+}
+
+static void* run_worker(void* argument) {
+    const pool_worker_t* worker = argument;
+    colrcv_pool_t* pool = worker->pool;
+    unsigned long seen = 0;
+    while(true) {
+        pool_task_t task;
+        while(find_task(pool, worker->index, &task)) {
+            run_task(pool, task);
+        }
+        // sleep until there might be new tasks
+        pthread_mutex_lock(&pool->lock);
+        while(!pool->stopping && pool->generation == seen) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        seen = pool->generation;
+        const bool stopping = pool->stopping;
+        pthread_mutex_unlock(&pool->lock);
+        if(stopping) {
+            return NULL;
+        }
+    }
+}
+
+// stops and joins the first `started` worker threads of a pool
+static void stop_workers(colrcv_pool_t* pool, size_t started) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+    for(size_t i = 0; i < started; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+}
+
+// gets the number of online processor cores, at least 1
+static size_t get_core_count(void) {
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cores < 1) ? 1 : (size_t)cores;
+}
+
+// runs a job on the threads of a pool, or on the calling thread if it's NULL
+static void run_job(colrcv_pool_t* pool, pool_job_t* job) {
+    // jobs of no more than one tile are not worth waking the workers for
+    if(
+        pool == NULL || pool->thread_count == 1 ||
+        job->count <= COLRCV_BATCH_TILE_SIZE
+    ) {
+        if(job->count > 0) {
+            job->run(job, 0, job->count);
+        }
+        return;
+    }
+    const size_t tiles = get_tile_count(job->count);
+    const size_t worker_count = pool->thread_count - 1;
+    job->remaining = tiles;
+    /*
+     * give each worker a contiguous share of the tiles to start with, which
+     * is all the balancing needed if every tile costs the same. the caller
+     * keeps none, it steals like any other thread that runs out
+     */
+    for(size_t i = 0; i < worker_count; i++) {
+        const pool_task_t task = {
+            .job = job,
+            .begin = tiles * i / worker_count,
+            .end = tiles * (i + 1) / worker_count,
+        };
+        if(task.begin < task.end && !deque_push(&pool->deques[i], task)) {
+            // out of memory, so convert this share here instead
+            run_task(pool, task);
+        }
+    }
+    announce_work(pool);
+    /*
+     * help out a chunk at a time until there is nothing left to steal. tiles
+     * of other jobs may be taken too, which is just as useful
+     */
+    pool_task_t task;
+    while(steal_any(pool, worker_count, CHUNK_TILES, &task)) {
+        run_task(pool, task);
+    }
+    // wait for the workers to finish the tiles of this job that they took
+    pthread_mutex_lock(&pool->lock);
+    while(job->remaining > 0) {
+        pthread_cond_wait(&pool->job_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+colrcv_pool_t* colrcv_pool_create(size_t thread_count) {
+    if(thread_count == 0) {
+        thread_count = get_core_count();
+    }
+    colrcv_pool_t* pool = malloc(sizeof(colrcv_pool_t));
+    if(pool == NULL) {
+        return NULL;
+    }
+    const size_t worker_count = thread_count - 1;
+    // room for one more worker than needed, so as never to allocate 0 bytes
+    *pool = (colrcv_pool_t){
+        .thread_count = thread_count,
+        .threads = malloc(thread_count * sizeof(pthread_t)),
+        .workers = malloc(thread_count * sizeof(pool_worker_t)),
+        .deques = malloc(thread_count * sizeof(pool_deque_t)),
+        .generation = 0, .stopping = false,
+    };
+    if(
+        pool->threads == NULL || pool->workers == NULL || pool->deques == NULL
+    ) {
+        free(pool->threads);
+        free(pool->workers);
+        free(pool->deques);
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->job_done, NULL);
+    size_t deque_count = 0;
+    while(
+        deque_count < worker_count && deque_init(&pool->deques[deque_count])
+    ) {
+        deque_count++;
+    }
+    size_t started = 0;
+    while(deque_count == worker_count && started < worker_count) {
+        pool->workers[started] = (pool_worker_t){
+            .pool = pool, .index = started,
+        };
+        if(
+            pthread_create(
+                &pool->threads[started], NULL,
+                run_worker, &pool->workers[started]
+            ) != 0
+        ) {
+            break;
+        }
+        started++;
+    }
+    if(started < worker_count) {
+        // undo everything done so far
+        stop_workers(pool, started);
+        for(size_t i = 0; i < deque_count; i++) {
+            deque_destroy(&pool->deques[i]);
+        }
+        pool->thread_count = 1;
+        colrcv_pool_free(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void colrcv_pool_free(colrcv_pool_t* pool) {
+    if(pool == NULL) {
+        return;
+    }
+    const size_t worker_count = pool->thread_count - 1;
+    stop_workers(pool, worker_count);
+    for(size_t i = 0; i < worker_count; i++) {
+        deque_destroy(&pool->deques[i]);
+    }
+    pthread_cond_destroy(&pool->job_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->deques);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+}
+
+size_t colrcv_pool_get_thread_count(const colrcv_pool_t* pool) {
+    return pool->thread_count;
+}
+
+void colrcv_pool_convert_soa(
+    colrcv_pool_t* pool, colrcv_soa_conversion_t conversion,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    pool_job_t job = {
+        .run = convert_soa_range, .conversion = conversion,
+        .a = a, .b = b, .c = c, .x = x, .y = y, .z = z,
+        .count = count,
+    };
+    const bool begun = colrcv_stats_batch_begin(conversion, count);
+    run_job(pool, &job);
+    colrcv_stats_batch_end(begun);
+}
+
+void colrcv_pool_convert_strided(
+    colrcv_pool_t* pool, colrcv_soa_conversion_t conversion,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+) {
+    pool_job_t job = {
+        .run = convert_strided_range, .conversion = conversion,
+        .input = input, .input_stride = input_stride,
+        .output = output, .output_stride = output_stride,
+        .count = count,
+    };
+    const bool begun = colrcv_stats_batch_begin(conversion, count);
+    run_job(pool, &job);
+    colrcv_stats_batch_end(begun);
+}
+
+void colrcv_pool_for(
+    colrcv_pool_t* pool, colrcv_pool_function_t function, void* context,
+    size_t count
+) {
+    pool_job_t job = {
+        .run = run_function_range,
+        .function = function, .context = context,
+        .count = count,
+    };
+    run_job(pool, &job);
+}
+
+bool colrcv_pool_convert(
+    colrcv_pool_t* pool, colrcv_model_t from, colrcv_model_t to,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const colrcv_soa_conversion_t conversion = colrcv_get_soa_conversion(
+        from, to
+    );
+    if(conversion == NULL) {
+        return false;
+    }
+    colrcv_pool_convert_soa(pool, conversion, a, b, c, x, y, z, count);
+    return true;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,185 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares a reusable pool of threads for splitting
+ * batch conversions across processor cores.
+ * @details The threads of a pool are started once by `colrcv_pool_create()`
+ * and wait for work between conversions, so no threads are started by each
+ * conversion. Colours are handed out to threads in whole tiles of the size
+ * used by the batch conversion functions, and each colour is converted by the
+ * same code whichever thread it goes to, so the results are exactly the same
+ * for any number of threads.
+ *
+ * Each thread has its own queue of tiles, starting with an even share of each
+ * conversion. A thread that runs out steals tiles from the back of another
+ * thread's queue, so conversions whose colours cost different amounts, and
+ * cheap and expensive conversions submitted from different threads at the
+ * same time, are balanced across the threads as they run.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_POOL_H
+#define SAXBOPHONE_COLRCV_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "colrcv.h"
+#include "convert.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief An opaque pool of threads, made by `colrcv_pool_create()` and freed
+ * by `colrcv_pool_free()`
+ * @since `v0.6.0`
+ */
+typedef struct colrcv_pool_t colrcv_pool_t;
+
+/**
+ * @brief Creates a pool of threads for batch conversions
+ * @param thread_count The number of threads to convert with, including the
+ * thread calling the conversion functions, which does its share of the work.
+ * `0` uses one thread for each online processor core.
+ * @returns A new pool, which should be freed with `colrcv_pool_free()`
+ * @returns `NULL` if memory could not be allocated or threads started
+ * @since `v0.6.0`
+ */
+colrcv_pool_t* colrcv_pool_create(size_t thread_count);
+
+/**
+ * @brief Stops the threads of a pool and frees it
+ * @details This must not be called while a conversion is using the pool.
+ * @param pool The pool to free. Does nothing if this is `NULL`
+ * @since `v0.6.0`
+ */
+void colrcv_pool_free(colrcv_pool_t* pool);
+
+/**
+ * @brief Gets the number of threads that a pool converts with, including the
+ * calling thread
+ * @since `v0.6.0`
+ */
+size_t colrcv_pool_get_thread_count(const colrcv_pool_t* pool);
+
+/**
+ * @brief Converts an array of colours with a Structure-of-Arrays conversion
+ * function, split across the threads of a pool
+ * @details Colours are stored as Structure-of-Arrays, with one array per
+ * channel. An output array may be the same array as an input array, for
+ * in-place conversion, but the arrays must not otherwise overlap. Returns
+ * once all of the colours have been converted, which the calling thread helps
+ * with. Conversions may be submitted to the same pool from several threads at
+ * once.
+ * @param pool The pool to convert with. If this is `NULL`, the conversion is
+ * done on the calling thread alone
+ * @param conversion The conversion function, such as `colrcv_rgb_to_lab_soa`
+ * @param a Array of the first channels of the colours to be converted
+ * @param b Array of the second channels of the colours to be converted
+ * @param c Array of the third channels of the colours to be converted
+ * @param[out] x Array to write the first channels of the converted colours to
+ * @param[out] y Array to write the second channels of the converted colours to
+ * @param[out] z Array to write the third channels of the converted colours to
+ * @param count The number of colours in each of the arrays
+ * @since `v0.6.0`
+ */
+void colrcv_pool_convert_soa(
+    colrcv_pool_t* pool, colrcv_soa_conversion_t conversion,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of colour structs with a Structure-of-Arrays
+ * conversion function, split across the threads of a pool
+ * @details The colours may be stored in arrays of colour structs, such as
+ * `colrcv_rgb_t` and `colrcv_lab_t`, or be fields of larger structs, by giving
+ * the distance in bytes between each colour. The conversion may be done
+ * in-place by giving the same address and stride for input and output.
+ * @param pool The pool to convert with. If this is `NULL`, the conversion is
+ * done on the calling thread alone
+ * @param conversion The conversion function, such as `colrcv_rgb_to_lab_soa`
+ * @param input Pointer to the first colour struct to be converted
+ * @param input_stride Distance in bytes between each input colour
+ * @param[out] output Pointer to write the first converted colour struct to
+ * @param output_stride Distance in bytes between each output colour
+ * @param count The number of colours to convert
+ * @since `v0.6.0`
+ */
+void colrcv_pool_convert_strided(
+    colrcv_pool_t* pool, colrcv_soa_conversion_t conversion,
+    const void* input, size_t input_stride,
+    void* output, size_t output_stride,
+    size_t count
+);
+
+/**
+ * @brief The type of the functions run by `colrcv_pool_for()`
+ * @details The first argument is the context given to `colrcv_pool_for()`,
+ * the second and third are the first index to do and the index after the last
+ * one to do.
+ * @since `v0.6.0`
+ */
+typedef void (* colrcv_pool_function_t)(void*, size_t, size_t);
+
+/**
+ * @brief Runs a function over a range of indices, split across the threads of
+ * a pool
+ * @details This is for batch work that the other pool functions don't cover,
+ * such as converting colours stored in other ways. The range is split into
+ * runs of whole tiles, as with the conversions, and the function is called
+ * with each run. Calls may be made at the same time on different threads, so
+ * the function must only write to what belongs to its own run.
+ * @param pool The pool to run the function with. If this is `NULL`, the
+ * function is called once on the calling thread, for the whole range
+ * @param function The function to run
+ * @param context Passed to each call of the function
+ * @param count The number of indices in the range, from `0` to `count - 1`
+ * @since `v0.6.0`
+ */
+void colrcv_pool_for(
+    colrcv_pool_t* pool, colrcv_pool_function_t function, void* context,
+    size_t count
+);
+
+/**
+ * @brief Converts an array of colours between two colour models, split across
+ * the threads of a pool
+ * @details This is the same as `colrcv_pool_convert_soa()` with the
+ * conversion function given by `colrcv_get_soa_conversion()`.
+ * @returns `true` if the colours were converted
+ * @returns `false` if the models are the same or either is not valid
+ * @since `v0.6.0`
+ */
+bool colrcv_pool_convert(
+    colrcv_pool_t* pool, colrcv_model_t from, colrcv_model_t to,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,903 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "colrcv.h"
+#include "simd.h"
+#include "internal/fastmath.h"
+#include "internal/simd.h"
+
+#ifdef COLRCV_SIMD_X86
+#include <immintrin.h>
+#endif
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// whether the level has been chosen with colrcv_simd_set_level()
+static bool level_chosen = false;
+// the level chosen with colrcv_simd_set_level()
+static colrcv_simd_level_t chosen_level = COLRCV_SIMD_NONE;
+
+colrcv_simd_level_t colrcv_simd_detect_level(void) {
+    #ifdef COLRCV_SIMD_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) {
+        return COLRCV_SIMD_AVX512;
+    }
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return COLRCV_SIMD_AVX2;
+    }
+    if(__builtin_cpu_supports("sse4.1")) {
+        return COLRCV_SIMD_SSE4_1;
+    }
+    #endif
+    return COLRCV_SIMD_NONE;
+}
+
+colrcv_simd_level_t colrcv_simd_get_level(void) {
+    return level_chosen ? chosen_level : colrcv_simd_detect_level();
+}
+
+bool colrcv_simd_set_level(colrcv_simd_level_t level) {
+    // each level's CPUs also support all of the levels below it
+    if(level > colrcv_simd_detect_level()) {
+        return false;
+    }
+    chosen_level = level;
+    level_chosen = true;
+    return true;
+}
+
+/* BEGIN matrix multiply kernels */
+
+/*
+ * the scalar kernel uses the same order of operations as the single-colour
+ * conversion functions, so gives bit-identical results to them
+ */
+static void multiply_matrix_scalar(
+    const double matrix[9], double divisor,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    for(size_t i = 0; i < count; i++) {
+        // read all inputs before writing any outputs, to allow in-place use
+        const double ai = a[i] / divisor;
+        const double bi = b[i] / divisor;
+        const double ci = c[i] / divisor;
+        x[i] = ai * matrix[0] + bi * matrix[1] + ci * matrix[2];
+        y[i] = ai * matrix[3] + bi * matrix[4] + ci * matrix[5];
+        z[i] = ai * matrix[6] + bi * matrix[7] + ci * matrix[8];
+    }
+}
+
+#ifdef COLRCV_SIMD_X86
+
+// SSE4.1 does not use FMA, so is also bit-identical to the scalar kernel
+__attribute__((target("sse4.1")))
+static size_t multiply_matrix_sse4_1(
+    const double matrix[9], double divisor,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const __m128d d = _mm_set1_pd(divisor);
+    __m128d m[9];
+    for(size_t j = 0; j < 9; j++) {
+        m[j] = _mm_set1_pd(matrix[j]);
+    }
+    size_t i = 0;
+    for(; i + 2 <= count; i += 2) {
+        const __m128d ai = _mm_div_pd(_mm_loadu_pd(a + i), d);
+        const __m128d bi = _mm_div_pd(_mm_loadu_pd(b + i), d);
+        const __m128d ci = _mm_div_pd(_mm_loadu_pd(c + i), d);
+        _mm_storeu_pd(x + i, _mm_add_pd(_mm_add_pd(
+            _mm_mul_pd(ai, m[0]), _mm_mul_pd(bi, m[1])), _mm_mul_pd(ci, m[2])
+        ));
+        _mm_storeu_pd(y + i, _mm_add_pd(_mm_add_pd(
+            _mm_mul_pd(ai, m[3]), _mm_mul_pd(bi, m[4])), _mm_mul_pd(ci, m[5])
+        ));
+        _mm_storeu_pd(z + i, _mm_add_pd(_mm_add_pd(
+            _mm_mul_pd(ai, m[6]), _mm_mul_pd(bi, m[7])), _mm_mul_pd(ci, m[8])
+        ));
+    }
+    // return the number of colours done so the caller can finish the rest
+    return i;
+}
+
+__attribute__((target("avx2,fma")))
+static size_t multiply_matrix_avx2(
+    const double matrix[9], double divisor,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const __m256d d = _mm256_set1_pd(divisor);
+    __m256d m[9];
+    for(size_t j = 0; j < 9; j++) {
+        m[j] = _mm256_set1_pd(matrix[j]);
+    }
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m256d ai = _mm256_div_pd(_mm256_loadu_pd(a + i), d);
+        const __m256d bi = _mm256_div_pd(_mm256_loadu_pd(b + i), d);
+        const __m256d ci = _mm256_div_pd(_mm256_loadu_pd(c + i), d);
+        _mm256_storeu_pd(x + i, _mm256_fmadd_pd(ci, m[2], _mm256_fmadd_pd(
+            bi, m[1], _mm256_mul_pd(ai, m[0])
+        )));
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(ci, m[5], _mm256_fmadd_pd(
+            bi, m[4], _mm256_mul_pd(ai, m[3])
+        )));
+        _mm256_storeu_pd(z + i, _mm256_fmadd_pd(ci, m[8], _mm256_fmadd_pd(
+            bi, m[7], _mm256_mul_pd(ai, m[6])
+        )));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t multiply_matrix_avx512(
+    const double matrix[9], double divisor,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    const __m512d d = _mm512_set1_pd(divisor);
+    __m512d m[9];
+    for(size_t j = 0; j < 9; j++) {
+        m[j] = _mm512_set1_pd(matrix[j]);
+    }
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m512d ai = _mm512_div_pd(_mm512_loadu_pd(a + i), d);
+        const __m512d bi = _mm512_div_pd(_mm512_loadu_pd(b + i), d);
+        const __m512d ci = _mm512_div_pd(_mm512_loadu_pd(c + i), d);
+        _mm512_storeu_pd(x + i, _mm512_fmadd_pd(ci, m[2], _mm512_fmadd_pd(
+            bi, m[1], _mm512_mul_pd(ai, m[0])
+        )));
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(ci, m[5], _mm512_fmadd_pd(
+            bi, m[4], _mm512_mul_pd(ai, m[3])
+        )));
+        _mm512_storeu_pd(z + i, _mm512_fmadd_pd(ci, m[8], _mm512_fmadd_pd(
+            bi, m[7], _mm512_mul_pd(ai, m[6])
+        )));
+    }
+    return i;
+}
+
+#endif
+
+void colrcv_simd_multiply_matrix(
+    const double matrix[9], double divisor,
+    const double* a, const double* b, const double* c,
+    double* x, double* y, double* z,
+    size_t count
+) {
+    // number of colours done by the vector kernel
+    size_t done = 0;
+    #ifdef COLRCV_SIMD_X86
+    switch(colrcv_simd_get_level()) {
+        case COLRCV_SIMD_AVX512:
+            done = multiply_matrix_avx512(
+                matrix, divisor, a, b, c, x, y, z, count
+            );
+            break;
+        case COLRCV_SIMD_AVX2:
+            done = multiply_matrix_avx2(
+                matrix, divisor, a, b, c, x, y, z, count
+            );
+            break;
+        case COLRCV_SIMD_SSE4_1:
+            done = multiply_matrix_sse4_1(
+                matrix, divisor, a, b, c, x, y, z, count
+            );
+            break;
+        case COLRCV_SIMD_NONE:
+            break;
+    }
+    #endif
+    // the scalar kernel does whatever is left over
+    multiply_matrix_scalar(
+        matrix, divisor,
+        a + done, b + done, c + done, x + done, y + done, z + done,
+        count - done
+    );
+}
+
+/* END matrix multiply kernels */
+
+/* BEGIN transfer function kernels */
+
+#ifdef COLRCV_SIMD_X86
+
+// vector version of fastmath_log2()
+__attribute__((target("avx2,fma")))
+static inline __m256d log2_avx2(__m256d x) {
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d two_pow_52 = _mm256_set1_pd(FASTMATH_TWO_POW_52);
+    const __m256i bits = _mm256_castpd_si256(x);
+    __m256d e = _mm256_sub_pd(_mm256_sub_pd(_mm256_castsi256_pd(
+        _mm256_or_si256(
+            _mm256_srli_epi64(bits, 52), _mm256_castpd_si256(two_pow_52)
+        )
+    ), two_pow_52), _mm256_set1_pd(1023.0));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffffLL)),
+        _mm256_set1_epi64x(0x3ff0000000000000LL)
+    ));
+    const __m256d halve = _mm256_and_pd(
+        _mm256_cmp_pd(m, _mm256_set1_pd(FASTMATH_SQRT_2), _CMP_GT_OQ), one
+    );
+    m = _mm256_mul_pd(m, _mm256_fnmadd_pd(_mm256_set1_pd(0.5), halve, one));
+    e = _mm256_add_pd(e, halve);
+    const __m256d t = _mm256_div_pd(
+        _mm256_sub_pd(m, one), _mm256_add_pd(m, one)
+    );
+    const __m256d t2 = _mm256_mul_pd(t, t);
+    __m256d series = _mm256_set1_pd(1.0 / 9);
+    series = _mm256_fmadd_pd(series, t2, _mm256_set1_pd(1.0 / 7));
+    series = _mm256_fmadd_pd(series, t2, _mm256_set1_pd(1.0 / 5));
+    series = _mm256_fmadd_pd(series, t2, _mm256_set1_pd(1.0 / 3));
+    series = _mm256_fmadd_pd(series, t2, one);
+    return _mm256_fmadd_pd(
+        _mm256_mul_pd(_mm256_set1_pd(2.0), t), _mm256_mul_pd(
+            series, _mm256_set1_pd(FASTMATH_LOG2_E)
+        ), e
+    );
+}
+
+// vector version of fastmath_exp2()
+__attribute__((target("avx2,fma")))
+static inline __m256d exp2_avx2(__m256d y) {
+    const __m256d rounding = _mm256_set1_pd(FASTMATH_ROUNDING);
+    y = _mm256_max_pd(y, _mm256_set1_pd(-1022.0));
+    y = _mm256_min_pd(y, _mm256_set1_pd(1023.0));
+    const __m256d n = _mm256_sub_pd(_mm256_add_pd(y, rounding), rounding);
+    const __m256d f = _mm256_mul_pd(
+        _mm256_sub_pd(y, n), _mm256_set1_pd(FASTMATH_LN_2)
+    );
+    __m256d p = _mm256_set1_pd(1.0 / 5040);
+    p = _mm256_fmadd_pd(p, f, _mm256_set1_pd(1.0 / 720));
+    p = _mm256_fmadd_pd(p, f, _mm256_set1_pd(1.0 / 120));
+    p = _mm256_fmadd_pd(p, f, _mm256_set1_pd(1.0 / 24));
+    p = _mm256_fmadd_pd(p, f, _mm256_set1_pd(1.0 / 6));
+    p = _mm256_fmadd_pd(p, f, _mm256_set1_pd(1.0 / 2));
+    p = _mm256_fmadd_pd(p, f, _mm256_set1_pd(1.0));
+    p = _mm256_fmadd_pd(p, f, _mm256_set1_pd(1.0));
+    const __m256i scale = _mm256_slli_epi64(_mm256_castpd_si256(
+        _mm256_add_pd(_mm256_add_pd(n, _mm256_set1_pd(1023.0)), rounding)
+    ), 52);
+    return _mm256_mul_pd(p, _mm256_castsi256_pd(scale));
+}
+
+__attribute__((target("avx2,fma")))
+static size_t srgb_to_linear_avx2(double* channel, size_t count) {
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m256d c = _mm256_loadu_pd(channel + i);
+        const __m256d curve = exp2_avx2(_mm256_mul_pd(
+            _mm256_set1_pd(2.4), log2_avx2(_mm256_div_pd(
+                _mm256_add_pd(c, _mm256_set1_pd(0.055)), _mm256_set1_pd(1.055)
+            ))
+        ));
+        const __m256d line = _mm256_div_pd(c, _mm256_set1_pd(12.92));
+        const __m256d is_curve = _mm256_cmp_pd(
+            c, _mm256_set1_pd(0.04045), _CMP_GT_OQ
+        );
+        _mm256_storeu_pd(channel + i, _mm256_blendv_pd(line, curve, is_curve));
+    }
+    return i;
+}
+
+__attribute__((target("avx2,fma")))
+static size_t linear_to_srgb_avx2(double* channel, size_t count) {
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m256d c = _mm256_loadu_pd(channel + i);
+        const __m256d curve = _mm256_fmsub_pd(
+            _mm256_set1_pd(1.055), exp2_avx2(_mm256_mul_pd(
+                _mm256_set1_pd(1.0 / 2.4), log2_avx2(c)
+            )), _mm256_set1_pd(0.055)
+        );
+        const __m256d line = _mm256_mul_pd(_mm256_set1_pd(12.92), c);
+        const __m256d is_curve = _mm256_cmp_pd(
+            c, _mm256_set1_pd(0.0031308), _CMP_GT_OQ
+        );
+        _mm256_storeu_pd(channel + i, _mm256_blendv_pd(line, curve, is_curve));
+    }
+    return i;
+}
+
+// vector version of fastmath_third_of_bits()
+__attribute__((target("avx2,fma")))
+static inline __m256i third_of_bits_avx2(__m256i bits) {
+    __m256i third = _mm256_srli_epi64(bits, 2);
+    third = _mm256_add_epi64(third, _mm256_srli_epi64(third, 2));
+    third = _mm256_add_epi64(third, _mm256_srli_epi64(third, 4));
+    third = _mm256_add_epi64(third, _mm256_srli_epi64(third, 8));
+    third = _mm256_add_epi64(third, _mm256_srli_epi64(third, 16));
+    third = _mm256_add_epi64(third, _mm256_srli_epi64(third, 32));
+    return third;
+}
+
+__attribute__((target("avx2,fma")))
+static size_t xyz_for_lab_avx2(double* channel, size_t count) {
+    const __m256d two_thirds = _mm256_set1_pd(2.0 / 3);
+    const __m256d three = _mm256_set1_pd(3.0);
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m256d c = _mm256_loadu_pd(channel + i);
+        __m256d curve = _mm256_castsi256_pd(_mm256_add_epi64(
+            third_of_bits_avx2(_mm256_castpd_si256(c)),
+            _mm256_set1_epi64x((long long)FASTMATH_CBRT_MAGIC)
+        ));
+        for(int step = 0; step < 3; step++) {
+            curve = _mm256_fmadd_pd(curve, two_thirds, _mm256_div_pd(
+                c, _mm256_mul_pd(three, _mm256_mul_pd(curve, curve))
+            ));
+        }
+        const __m256d line = _mm256_fmadd_pd(
+            _mm256_set1_pd(7.787), c, _mm256_set1_pd(16.0 / 116)
+        );
+        const __m256d is_curve = _mm256_cmp_pd(
+            c, _mm256_set1_pd(0.008856), _CMP_GT_OQ
+        );
+        _mm256_storeu_pd(channel + i, _mm256_blendv_pd(line, curve, is_curve));
+    }
+    return i;
+}
+
+// vector version of fastmath_log2()
+__attribute__((target("avx512f")))
+static inline __m512d log2_avx512(__m512d x) {
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d two_pow_52 = _mm512_set1_pd(FASTMATH_TWO_POW_52);
+    const __m512i bits = _mm512_castpd_si512(x);
+    __m512d e = _mm512_sub_pd(_mm512_sub_pd(_mm512_castsi512_pd(
+        _mm512_or_si512(
+            _mm512_srli_epi64(bits, 52), _mm512_castpd_si512(two_pow_52)
+        )
+    ), two_pow_52), _mm512_set1_pd(1023.0));
+    __m512d m = _mm512_castsi512_pd(_mm512_or_si512(
+        _mm512_and_si512(bits, _mm512_set1_epi64(0x000fffffffffffffLL)),
+        _mm512_set1_epi64(0x3ff0000000000000LL)
+    ));
+    const __mmask8 halve = _mm512_cmp_pd_mask(
+        m, _mm512_set1_pd(FASTMATH_SQRT_2), _CMP_GT_OQ
+    );
+    m = _mm512_mask_mul_pd(m, halve, m, _mm512_set1_pd(0.5));
+    e = _mm512_mask_add_pd(e, halve, e, one);
+    const __m512d t = _mm512_div_pd(
+        _mm512_sub_pd(m, one), _mm512_add_pd(m, one)
+    );
+    const __m512d t2 = _mm512_mul_pd(t, t);
+    __m512d series = _mm512_set1_pd(1.0 / 9);
+    series = _mm512_fmadd_pd(series, t2, _mm512_set1_pd(1.0 / 7));
+    series = _mm512_fmadd_pd(series, t2, _mm512_set1_pd(1.0 / 5));
+    series = _mm512_fmadd_pd(series, t2, _mm512_set1_pd(1.0 / 3));
+    series = _mm512_fmadd_pd(series, t2, one);
+    return _mm512_fmadd_pd(
+        _mm512_mul_pd(_mm512_set1_pd(2.0), t), _mm512_mul_pd(
+            series, _mm512_set1_pd(FASTMATH_LOG2_E)
+        ), e
+    );
+}
+
+// vector version of fastmath_exp2()
+__attribute__((target("avx512f")))
+static inline __m512d exp2_avx512(__m512d y) {
+    const __m512d rounding = _mm512_set1_pd(FASTMATH_ROUNDING);
+    y = _mm512_max_pd(y, _mm512_set1_pd(-1022.0));
+    y = _mm512_min_pd(y, _mm512_set1_pd(1023.0));
+    const __m512d n = _mm512_sub_pd(_mm512_add_pd(y, rounding), rounding);
+    const __m512d f = _mm512_mul_pd(
+        _mm512_sub_pd(y, n), _mm512_set1_pd(FASTMATH_LN_2)
+    );
+    __m512d p = _mm512_set1_pd(1.0 / 5040);
+    p = _mm512_fmadd_pd(p, f, _mm512_set1_pd(1.0 / 720));
+    p = _mm512_fmadd_pd(p, f, _mm512_set1_pd(1.0 / 120));
+    p = _mm512_fmadd_pd(p, f, _mm512_set1_pd(1.0 / 24));
+    p = _mm512_fmadd_pd(p, f, _mm512_set1_pd(1.0 / 6));
+    p = _mm512_fmadd_pd(p, f, _mm512_set1_pd(1.0 / 2));
+    p = _mm512_fmadd_pd(p, f, _mm512_set1_pd(1.0));
+    p = _mm512_fmadd_pd(p, f, _mm512_set1_pd(1.0));
+    const __m512i scale = _mm512_slli_epi64(_mm512_castpd_si512(
+        _mm512_add_pd(_mm512_add_pd(n, _mm512_set1_pd(1023.0)), rounding)
+    ), 52);
+    return _mm512_mul_pd(p, _mm512_castsi512_pd(scale));
+}
+
+__attribute__((target("avx512f")))
+static size_t srgb_to_linear_avx512(double* channel, size_t count) {
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m512d c = _mm512_loadu_pd(channel + i);
+        const __m512d curve = exp2_avx512(_mm512_mul_pd(
+            _mm512_set1_pd(2.4), log2_avx512(_mm512_div_pd(
+                _mm512_add_pd(c, _mm512_set1_pd(0.055)), _mm512_set1_pd(1.055)
+            ))
+        ));
+        const __m512d line = _mm512_div_pd(c, _mm512_set1_pd(12.92));
+        const __mmask8 is_curve = _mm512_cmp_pd_mask(
+            c, _mm512_set1_pd(0.04045), _CMP_GT_OQ
+        );
+        _mm512_storeu_pd(
+            channel + i, _mm512_mask_blend_pd(is_curve, line, curve)
+        );
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t linear_to_srgb_avx512(double* channel, size_t count) {
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m512d c = _mm512_loadu_pd(channel + i);
+        const __m512d curve = _mm512_fmsub_pd(
+            _mm512_set1_pd(1.055), exp2_avx512(_mm512_mul_pd(
+                _mm512_set1_pd(1.0 / 2.4), log2_avx512(c)
+            )), _mm512_set1_pd(0.055)
+        );
+        const __m512d line = _mm512_mul_pd(_mm512_set1_pd(12.92), c);
+        const __mmask8 is_curve = _mm512_cmp_pd_mask(
+            c, _mm512_set1_pd(0.0031308), _CMP_GT_OQ
+        );
+        _mm512_storeu_pd(
+            channel + i, _mm512_mask_blend_pd(is_curve, line, curve)
+        );
+    }
+    return i;
+}
+
+// vector version of fastmath_third_of_bits()
+__attribute__((target("avx512f")))
+static inline __m512i third_of_bits_avx512(__m512i bits) {
+    __m512i third = _mm512_srli_epi64(bits, 2);
+    third = _mm512_add_epi64(third, _mm512_srli_epi64(third, 2));
+    third = _mm512_add_epi64(third, _mm512_srli_epi64(third, 4));
+    third = _mm512_add_epi64(third, _mm512_srli_epi64(third, 8));
+    third = _mm512_add_epi64(third, _mm512_srli_epi64(third, 16));
+    third = _mm512_add_epi64(third, _mm512_srli_epi64(third, 32));
+    return third;
+}
+
+__attribute__((target("avx512f")))
+static size_t xyz_for_lab_avx512(double* channel, size_t count) {
+    const __m512d two_thirds = _mm512_set1_pd(2.0 / 3);
+    const __m512d three = _mm512_set1_pd(3.0);
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m512d c = _mm512_loadu_pd(channel + i);
+        __m512d curve = _mm512_castsi512_pd(_mm512_add_epi64(
+            third_of_bits_avx512(_mm512_castpd_si512(c)),
+            _mm512_set1_epi64((long long)FASTMATH_CBRT_MAGIC)
+        ));
+        for(int step = 0; step < 3; step++) {
+            curve = _mm512_fmadd_pd(curve, two_thirds, _mm512_div_pd(
+                c, _mm512_mul_pd(three, _mm512_mul_pd(curve, curve))
+            ));
+        }
+        const __m512d line = _mm512_fmadd_pd(
+            _mm512_set1_pd(7.787), c, _mm512_set1_pd(16.0 / 116)
+        );
+        const __mmask8 is_curve = _mm512_cmp_pd_mask(
+            c, _mm512_set1_pd(0.008856), _CMP_GT_OQ
+        );
+        _mm512_storeu_pd(
+            channel + i, _mm512_mask_blend_pd(is_curve, line, curve)
+        );
+    }
+    return i;
+}
+
+#endif
+
+void colrcv_simd_srgb_to_linear(double* channel, size_t count) {
+    // number of values done by the vector kernel
+    size_t done = 0;
+    #ifdef COLRCV_SIMD_X86
+    switch(colrcv_simd_get_level()) {
+        case COLRCV_SIMD_AVX512:
+            done = srgb_to_linear_avx512(channel, count);
+            break;
+        case COLRCV_SIMD_AVX2:
+            done = srgb_to_linear_avx2(channel, count);
+            break;
+        case COLRCV_SIMD_SSE4_1:
+        case COLRCV_SIMD_NONE:
+            break;
+    }
+    #endif
+    // the scalar version does whatever is left over
+    for(size_t i = done; i < count; i++) {
+        channel[i] = fastmath_srgb_to_linear(channel[i]);
+    }
+}
+
+void colrcv_simd_linear_to_srgb(double* channel, size_t count) {
+    // number of values done by the vector kernel
+    size_t done = 0;
+    #ifdef COLRCV_SIMD_X86
+    switch(colrcv_simd_get_level()) {
+        case COLRCV_SIMD_AVX512:
+            done = linear_to_srgb_avx512(channel, count);
+            break;
+        case COLRCV_SIMD_AVX2:
+            done = linear_to_srgb_avx2(channel, count);
+            break;
+        case COLRCV_SIMD_SSE4_1:
+        case COLRCV_SIMD_NONE:
+            break;
+    }
+    #endif
+    // the scalar version does whatever is left over
+    for(size_t i = done; i < count; i++) {
+        channel[i] = fastmath_linear_to_srgb(channel[i]);
+    }
+}
+
+void colrcv_simd_xyz_for_lab(double* channel, size_t count) {
+    // number of values done by the vector kernel
+    size_t done = 0;
+    #ifdef COLRCV_SIMD_X86
+    switch(colrcv_simd_get_level()) {
+        case COLRCV_SIMD_AVX512:
+            done = xyz_for_lab_avx512(channel, count);
+            break;
+        case COLRCV_SIMD_AVX2:
+            done = xyz_for_lab_avx2(channel, count);
+            break;
+        case COLRCV_SIMD_SSE4_1:
+        case COLRCV_SIMD_NONE:
+            break;
+    }
+    #endif
+    // the scalar version does whatever is left over
+    for(size_t i = done; i < count; i++) {
+        channel[i] = fastmath_xyz_for_lab(channel[i]);
+    }
+}
+
+/* END transfer function kernels */
+
+/* BEGIN range kernels */
+
+#ifdef COLRCV_SIMD_X86
+
+/*
+ * each vector kernel does whole groups of 8 colours, so that each fills one
+ * byte of `invalid`, and gives the number of colours done. the comparisons
+ * are ordered, so are false for NaNs as in colrcv_range_valid()
+ */
+
+__attribute__((target("sse4.1")))
+static size_t find_out_of_range_sse4_1(
+    const double* const channels[3], const double min[3], const double max[3],
+    uint8_t* invalid, size_t count, size_t* found
+) {
+    __m128d lo[3], hi[3];
+    for(size_t ch = 0; ch < 3; ch++) {
+        lo[ch] = _mm_set1_pd(min[ch]);
+        hi[ch] = _mm_set1_pd(max[ch]);
+    }
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        unsigned int valid = 0;
+        for(size_t j = 0; j < 8; j += 2) {
+            __m128d in_range = _mm_castsi128_pd(_mm_set1_epi32(-1));
+            for(size_t ch = 0; ch < 3; ch++) {
+                const __m128d v = _mm_loadu_pd(channels[ch] + i + j);
+                in_range = _mm_and_pd(in_range, _mm_and_pd(
+                    _mm_cmpge_pd(v, lo[ch]), _mm_cmple_pd(v, hi[ch])
+                ));
+            }
+            valid |= (unsigned int)_mm_movemask_pd(in_range) << j;
+        }
+        const unsigned int bits = ~valid & 0xFFu;
+        if(invalid != NULL) {
+            invalid[i / 8] = (uint8_t)bits;
+        }
+        *found += (size_t)__builtin_popcount(bits);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t find_out_of_range_avx2(
+    const double* const channels[3], const double min[3], const double max[3],
+    uint8_t* invalid, size_t count, size_t* found
+) {
+    __m256d lo[3], hi[3];
+    for(size_t ch = 0; ch < 3; ch++) {
+        lo[ch] = _mm256_set1_pd(min[ch]);
+        hi[ch] = _mm256_set1_pd(max[ch]);
+    }
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        unsigned int valid = 0;
+        for(size_t j = 0; j < 8; j += 4) {
+            __m256d in_range = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+            for(size_t ch = 0; ch < 3; ch++) {
+                const __m256d v = _mm256_loadu_pd(channels[ch] + i + j);
+                in_range = _mm256_and_pd(in_range, _mm256_and_pd(
+                    _mm256_cmp_pd(v, lo[ch], _CMP_GE_OQ),
+                    _mm256_cmp_pd(v, hi[ch], _CMP_LE_OQ)
+                ));
+            }
+            valid |= (unsigned int)_mm256_movemask_pd(in_range) << j;
+        }
+        const unsigned int bits = ~valid & 0xFFu;
+        if(invalid != NULL) {
+            invalid[i / 8] = (uint8_t)bits;
+        }
+        *found += (size_t)__builtin_popcount(bits);
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t find_out_of_range_avx512(
+    const double* const channels[3], const double min[3], const double max[3],
+    uint8_t* invalid, size_t count, size_t* found
+) {
+    __m512d lo[3], hi[3];
+    for(size_t ch = 0; ch < 3; ch++) {
+        lo[ch] = _mm512_set1_pd(min[ch]);
+        hi[ch] = _mm512_set1_pd(max[ch]);
+    }
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        // each comparison only sets the bits of colours still in range
+        __mmask8 valid = 0xFF;
+        for(size_t ch = 0; ch < 3; ch++) {
+            const __m512d v = _mm512_loadu_pd(channels[ch] + i);
+            valid = _mm512_mask_cmp_pd_mask(valid, v, lo[ch], _CMP_GE_OQ);
+            valid = _mm512_mask_cmp_pd_mask(valid, v, hi[ch], _CMP_LE_OQ);
+        }
+        const unsigned int bits = ~(unsigned int)valid & 0xFFu;
+        if(invalid != NULL) {
+            invalid[i / 8] = (uint8_t)bits;
+        }
+        *found += (size_t)__builtin_popcount(bits);
+    }
+    return i;
+}
+
+#endif
+
+size_t colrcv_simd_find_out_of_range(
+    const double* a, const double* b, const double* c,
+    const double min[3], const double max[3],
+    uint8_t* invalid, size_t count
+) {
+    const double* const channels[3] = { a, b, c, };
+    size_t found = 0;
+    // number of colours done by the vector kernel, always a multiple of 8
+    size_t done = 0;
+    #ifdef COLRCV_SIMD_X86
+    switch(colrcv_simd_get_level()) {
+        case COLRCV_SIMD_AVX512:
+            done = find_out_of_range_avx512(
+                channels, min, max, invalid, count, &found
+            );
+            break;
+        case COLRCV_SIMD_AVX2:
+            done = find_out_of_range_avx2(
+                channels, min, max, invalid, count, &found
+            );
+            break;
+        case COLRCV_SIMD_SSE4_1:
+            done = find_out_of_range_sse4_1(
+                channels, min, max, invalid, count, &found
+            );
+            break;
+        case COLRCV_SIMD_NONE:
+            break;
+    }
+    #endif
+    // the scalar version does whatever is left over
+    for(size_t i = done; i < count; i++) {
+        if(invalid != NULL && i % 8 == 0) {
+            invalid[i / 8] = 0;
+        }
+        bool valid = true;
+        for(size_t ch = 0; ch < 3; ch++) {
+            valid = valid && min[ch] <= channels[ch][i];
+            valid = valid && channels[ch][i] <= max[ch];
+        }
+        if(!valid) {
+            found++;
+            if(invalid != NULL) {
+                invalid[i / 8] |= (uint8_t)(1u << (i % 8));
+            }
+        }
+    }
+    return found;
+}
+
+/*
+ * the vector kernels take the maximum and then the minimum in the same way as
+ * colrcv_clamp(), with the bound as the first operand so that, as with it,
+ * NaNs are left as they are
+ */
+
+#ifdef COLRCV_SIMD_X86
+
+__attribute__((target("sse4.1")))
+static size_t clamp_sse4_1(
+    double* channel, double min, double max, size_t count
+) {
+    const __m128d lo = _mm_set1_pd(min);
+    const __m128d hi = _mm_set1_pd(max);
+    size_t i = 0;
+    for(; i + 2 <= count; i += 2) {
+        const __m128d v = _mm_loadu_pd(channel + i);
+        _mm_storeu_pd(channel + i, _mm_min_pd(hi, _mm_max_pd(lo, v)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t clamp_avx2(
+    double* channel, double min, double max, size_t count
+) {
+    const __m256d lo = _mm256_set1_pd(min);
+    const __m256d hi = _mm256_set1_pd(max);
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m256d v = _mm256_loadu_pd(channel + i);
+        _mm256_storeu_pd(
+            channel + i, _mm256_min_pd(hi, _mm256_max_pd(lo, v))
+        );
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t clamp_avx512(
+    double* channel, double min, double max, size_t count
+) {
+    const __m512d lo = _mm512_set1_pd(min);
+    const __m512d hi = _mm512_set1_pd(max);
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m512d v = _mm512_loadu_pd(channel + i);
+        _mm512_storeu_pd(
+            channel + i, _mm512_min_pd(hi, _mm512_max_pd(lo, v))
+        );
+    }
+    return i;
+}
+
+#endif
+
+void colrcv_simd_clamp(double* channel, double min, double max, size_t count) {
+    // number of values done by the vector kernel
+    size_t done = 0;
+    #ifdef COLRCV_SIMD_X86
+    switch(colrcv_simd_get_level()) {
+        case COLRCV_SIMD_AVX512:
+            done = clamp_avx512(channel, min, max, count);
+            break;
+        case COLRCV_SIMD_AVX2:
+            done = clamp_avx2(channel, min, max, count);
+            break;
+        case COLRCV_SIMD_SSE4_1:
+            done = clamp_sse4_1(channel, min, max, count);
+            break;
+        case COLRCV_SIMD_NONE:
+            break;
+    }
+    #endif
+    // the scalar version does whatever is left over
+    for(size_t i = done; i < count; i++) {
+        channel[i] = colrcv_clamp(channel[i], min, max);
+    }
+}
+
+/* END range kernels */
+
+/* BEGIN hash kernels */
+
+// 2^32 divided by the golden ratio, which spreads out keys that differ a little
+#define HASH_MULTIPLIER 0x9E3779B1u
+
+#ifdef COLRCV_SIMD_X86
+
+__attribute__((target("sse4.1")))
+static size_t hash_keys_sse4_1(
+    const uint32_t* keys, uint32_t* hashes, unsigned int bits, size_t count
+) {
+    const __m128i multiplier = _mm_set1_epi32((int)HASH_MULTIPLIER);
+    const __m128i shift = _mm_cvtsi32_si128((int)(32 - bits));
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128i k = _mm_loadu_si128((const __m128i*)(keys + i));
+        _mm_storeu_si128(
+            (__m128i*)(hashes + i),
+            _mm_srl_epi32(_mm_mullo_epi32(k, multiplier), shift)
+        );
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t hash_keys_avx2(
+    const uint32_t* keys, uint32_t* hashes, unsigned int bits, size_t count
+) {
+    const __m256i multiplier = _mm256_set1_epi32((int)HASH_MULTIPLIER);
+    const __m128i shift = _mm_cvtsi32_si128((int)(32 - bits));
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i k = _mm256_loadu_si256((const __m256i*)(keys + i));
+        _mm256_storeu_si256(
+            (__m256i*)(hashes + i),
+            _mm256_srl_epi32(_mm256_mullo_epi32(k, multiplier), shift)
+        );
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t hash_keys_avx512(
+    const uint32_t* keys, uint32_t* hashes, unsigned int bits, size_t count
+) {
+    const __m512i multiplier = _mm512_set1_epi32((int)HASH_MULTIPLIER);
+    const __m128i shift = _mm_cvtsi32_si128((int)(32 - bits));
+    size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+        const __m512i k = _mm512_loadu_si512(keys + i);
+        _mm512_storeu_si512(
+            hashes + i,
+            _mm512_srl_epi32(_mm512_mullo_epi32(k, multiplier), shift)
+        );
+    }
+    return i;
+}
+
+#endif
+
+void colrcv_simd_hash_keys(
+    const uint32_t* keys, uint32_t* hashes, unsigned int bits, size_t count
+) {
+    // number of keys done by the vector kernel
+    size_t done = 0;
+    #ifdef COLRCV_SIMD_X86
+    switch(colrcv_simd_get_level()) {
+        case COLRCV_SIMD_AVX512:
+            done = hash_keys_avx512(keys, hashes, bits, count);
+            break;
+        case COLRCV_SIMD_AVX2:
+            done = hash_keys_avx2(keys, hashes, bits, count);
+            break;
+        case COLRCV_SIMD_SSE4_1:
+            done = hash_keys_sse4_1(keys, hashes, bits, count);
+            break;
+        case COLRCV_SIMD_NONE:
+            break;
+    }
+    #endif
+    // the scalar version does whatever is left over
+    for(size_t i = done; i < count; i++) {
+        hashes[i] = (uint32_t)(keys[i] * HASH_MULTIPLIER) >> (32 - bits);
+    }
+}
+
+/* END hash kernels */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
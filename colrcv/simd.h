@@ -0,0 +1,89 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares functions for querying and choosing the
+ * SIMD instruction set used by the batch conversion functions.
+ * @details By default, the best instruction set supported by the CPU that the
+ * program is running on is detected and used at runtime, so one binary runs at
+ * full speed on any CPU. All instruction sets give results within `0.001` of
+ * those of the single-colour conversion functions.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_SIMD_H
+#define SAXBOPHONE_COLRCV_SIMD_H
+
+#include <stdbool.h>
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief The SIMD instruction sets which the batch conversion functions can
+ * use, in order of increasing vector width
+ * @since `v0.6.0`
+ */
+typedef enum colrcv_simd_level_t {
+    /** @brief Plain scalar code, available on every CPU */
+    COLRCV_SIMD_NONE = 0,
+    /** @brief x86 SSE4.1, 2 doubles per vector */
+    COLRCV_SIMD_SSE4_1,
+    /** @brief x86 AVX2 with FMA, 4 doubles per vector */
+    COLRCV_SIMD_AVX2,
+    /** @brief x86 AVX-512 Foundation, 8 doubles per vector */
+    COLRCV_SIMD_AVX512,
+} colrcv_simd_level_t;
+
+/**
+ * @brief Detects the best SIMD instruction set supported by the current CPU
+ * @returns `COLRCV_SIMD_NONE` when not running on x86 or when the library was
+ * built with a compiler that does not support runtime CPU dispatch
+ * @since `v0.6.0`
+ */
+colrcv_simd_level_t colrcv_simd_detect_level(void);
+
+/**
+ * @brief Gets the SIMD instruction set currently used by the batch conversion
+ * functions
+ * @returns The level set with `colrcv_simd_set_level()` if any, otherwise the
+ * detected level
+ * @since `v0.6.0`
+ */
+colrcv_simd_level_t colrcv_simd_get_level(void);
+
+/**
+ * @brief Sets the SIMD instruction set used by the batch conversion functions,
+ * for example to compare them or to reproduce results from another CPU
+ * @remarks This must not be called while batch conversions are in progress on
+ * other threads.
+ * @param level The instruction set to use
+ * @returns `true` if the level was set
+ * @returns `false` if the level is not supported by the current CPU, in which
+ * case the level in use is not changed
+ * @since `v0.6.0`
+ */
+bool colrcv_simd_set_level(colrcv_simd_level_t level);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
@@ -0,0 +1,233 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "colrcv.h"
+#include "convert.h"
+#include "stats.h"
+#include "internal/stats.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the number of counters in colrcv_stats_t, which is made of nothing else
+#define COUNTER_COUNT (sizeof(colrcv_stats_t) / sizeof(uint64_t))
+
+bool colrcv_stats_enabled = false;
+
+// the counters of one thread, which only that thread adds to
+typedef struct stats_thread_t {
+    colrcv_stats_t counts;
+    // how many batch conversions the thread is inside of
+    size_t depth;
+    // the other threads' counters, in the list of all of them
+    struct stats_thread_t* previous;
+    struct stats_thread_t* next;
+} stats_thread_t;
+
+// guards the list of threads' counters and the counts of finished threads
+static pthread_mutex_t threads_lock = PTHREAD_MUTEX_INITIALIZER;
+static stats_thread_t* threads = NULL;
+static colrcv_stats_t finished;
+
+// gets to each thread's counters
+static pthread_once_t key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_key;
+static bool key_created = false;
+
+// adds to a counter of this thread
+static void add_count(uint64_t* counter, uint64_t count) {
+    // no other thread adds to it, so the load and store needn't be one
+    COLRCV_STATS_STORE(counter, COLRCV_STATS_LOAD(counter) + count);
+}
+
+/*
+ * called when a thread which has counted something finishes, keeping its
+ * counts and dropping its counters from the list
+ */
+static void finish_thread(void* data) {
+    stats_thread_t* thread = data;
+    uint64_t* from = (uint64_t*)&thread->counts;
+    uint64_t* to = (uint64_t*)&finished;
+    pthread_mutex_lock(&threads_lock);
+    for(size_t i = 0; i < COUNTER_COUNT; i++) {
+        to[i] += COLRCV_STATS_LOAD(&from[i]);
+    }
+    if(thread->previous != NULL) {
+        thread->previous->next = thread->next;
+    } else {
+        threads = thread->next;
+    }
+    if(thread->next != NULL) {
+        thread->next->previous = thread->previous;
+    }
+    pthread_mutex_unlock(&threads_lock);
+    free(thread);
+}
+
+static void create_key(void) {
+    key_created = pthread_key_create(&thread_key, finish_thread) == 0;
+}
+
+/*
+ * gets the counters of this thread, making them the first time.
+ * returns NULL if they couldn't be made, in which case nothing is counted
+ */
+static stats_thread_t* get_thread(void) {
+    pthread_once(&key_once, create_key);
+    if(!key_created) {
+        return NULL;
+    }
+    stats_thread_t* thread = pthread_getspecific(thread_key);
+    if(thread != NULL) {
+        return thread;
+    }
+    thread = calloc(1, sizeof(stats_thread_t));
+    if(thread == NULL) {
+        return NULL;
+    }
+    if(pthread_setspecific(thread_key, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+    pthread_mutex_lock(&threads_lock);
+    thread->next = threads;
+    if(threads != NULL) {
+        threads->previous = thread;
+    }
+    threads = thread;
+    pthread_mutex_unlock(&threads_lock);
+    return thread;
+}
+
+void colrcv_stats_add_conversion(colrcv_model_t from, colrcv_model_t to) {
+    stats_thread_t* thread = get_thread();
+    if(thread != NULL && thread->depth == 0) {
+        add_count(&thread->counts.calls[from][to], 1);
+        add_count(&thread->counts.colours[from][to], 1);
+    }
+}
+
+bool colrcv_stats_enter_batch(
+    colrcv_soa_conversion_t conversion, size_t count
+) {
+    stats_thread_t* thread = get_thread();
+    if(thread == NULL) {
+        return false;
+    }
+    if(thread->depth == 0 && conversion != NULL) {
+        // find which conversion it is, if it's one of the public ones
+        for(size_t from = 0; from < COLRCV_MODEL_COUNT; from++) {
+            for(size_t to = 0; to < COLRCV_MODEL_COUNT; to++) {
+                if(
+                    from != to && colrcv_get_soa_conversion(
+                        (colrcv_model_t)from, (colrcv_model_t)to
+                    ) == conversion
+                ) {
+                    add_count(&thread->counts.calls[from][to], 1);
+                    add_count(&thread->counts.colours[from][to], count);
+                }
+            }
+        }
+    }
+    thread->depth++;
+    return true;
+}
+
+void colrcv_stats_leave_batch(void) {
+    stats_thread_t* thread = get_thread();
+    if(thread != NULL) {
+        thread->depth--;
+    }
+}
+
+void colrcv_stats_add_gamut_clips(
+    const double* r, const double* g, const double* b, size_t count,
+    double max
+) {
+    stats_thread_t* thread = get_thread();
+    if(thread == NULL) {
+        return;
+    }
+    const double* channels[3] = { r, g, b, };
+    for(size_t ch = 0; ch < 3; ch++) {
+        uint64_t clipped = 0;
+        for(size_t i = 0; i < count; i++) {
+            clipped += !colrcv_range_valid(0.0, channels[ch][i], max);
+        }
+        add_count(&thread->counts.gamut_clipped[ch], clipped);
+    }
+}
+
+void colrcv_stats_add_clamp(
+    colrcv_model_t model, size_t channel, uint64_t count
+) {
+    stats_thread_t* thread = get_thread();
+    if(thread != NULL) {
+        add_count(&thread->counts.clamped[model][channel], count);
+    }
+}
+
+void colrcv_stats_add_invalid(colrcv_model_t model, uint64_t count) {
+    stats_thread_t* thread = get_thread();
+    if(thread != NULL) {
+        add_count(&thread->counts.invalid[model], count);
+    }
+}
+
+void colrcv_stats_set_enabled(bool enabled) {
+    COLRCV_STATS_STORE(&colrcv_stats_enabled, enabled);
+}
+
+bool colrcv_stats_is_enabled(void) {
+    return COLRCV_STATS_LOAD(&colrcv_stats_enabled);
+}
+
+colrcv_stats_t colrcv_stats_get_snapshot(void) {
+    colrcv_stats_t snapshot;
+    uint64_t* to = (uint64_t*)&snapshot;
+    pthread_mutex_lock(&threads_lock);
+    memcpy(&snapshot, &finished, sizeof(snapshot));
+    for(stats_thread_t* thread = threads; thread; thread = thread->next) {
+        const uint64_t* from = (const uint64_t*)&thread->counts;
+        for(size_t i = 0; i < COUNTER_COUNT; i++) {
+            to[i] += COLRCV_STATS_LOAD(&from[i]);
+        }
+    }
+    pthread_mutex_unlock(&threads_lock);
+    return snapshot;
+}
+
+void colrcv_stats_reset(void) {
+    pthread_mutex_lock(&threads_lock);
+    memset(&finished, 0, sizeof(finished));
+    for(stats_thread_t* thread = threads; thread; thread = thread->next) {
+        uint64_t* counters = (uint64_t*)&thread->counts;
+        for(size_t i = 0; i < COUNTER_COUNT; i++) {
+            COLRCV_STATS_STORE(&counters[i], 0);
+        }
+    }
+    pthread_mutex_unlock(&threads_lock);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,134 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ */
+
+/**
+ * @file
+ *
+ * @brief This header file declares statistics that colrcv can keep about the
+ * conversions, clamping and validation it does.
+ * @details Statistics are off by default. Once turned on with
+ * `colrcv_stats_set_enabled()`, colrcv counts the calls made to each
+ * conversion and the colours they convert, the RGB channels clipped to the
+ * RGB gamut while converting from XYZ or LAB, the channels brought into range
+ * by the clamping functions and the colours found invalid by the validation
+ * functions. This shows which conversions are hot and how often gamut
+ * clipping changes colours, without a profiler.
+ *
+ * Each thread counts into counters of its own, which are only added together
+ * when a snapshot is taken with `colrcv_stats_get_snapshot()`, so threads
+ * converting at the same time don't slow each other down. While statistics
+ * are off, each function counted costs one extra check of a flag.
+ *
+ * @author Joshua Saxby `<joshua.a.saxby+TNOPLuc8vM==@gmail.com>`
+ * @date 2018
+ *
+ * @copyright Copyright (C) Joshua Saxby 2017, 2018
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @since `v0.6.0`
+ */
+#ifndef SAXBOPHONE_COLRCV_STATS_H
+#define SAXBOPHONE_COLRCV_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "convert.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief The counts kept by colrcv while statistics are on
+ * @details Arrays indexed by channel are in the order of the channels of the
+ * model's colour struct, such as `r`, `g` and `b` for `colrcv_rgb_t`.
+ * @since `v0.6.0`
+ */
+typedef struct colrcv_stats_t {
+    /**
+     * @brief The number of calls made to the conversion functions, indexed
+     * by the model converted from and then the model converted to
+     * @details Both the single-colour functions, such as
+     * `colrcv_lab_to_rgb()`, and the batch functions, such as
+     * `colrcv_lab_to_rgb_soa()`, are counted, as are their single-precision
+     * versions. Conversions made by the library while doing another
+     * conversion are not counted separately. Conversions to 8-bit and 16-bit
+     * RGB are not counted. A conversion split between the threads of a
+     * `colrcv_pool_t` is counted once, by the thread which asked for it.
+     */
+    uint64_t calls[COLRCV_MODEL_COUNT][COLRCV_MODEL_COUNT];
+    /**
+     * @brief The number of colours converted by the calls in `calls`,
+     * indexed in the same way
+     */
+    uint64_t colours[COLRCV_MODEL_COUNT][COLRCV_MODEL_COUNT];
+    /**
+     * @brief The number of RGB channels outside of the RGB gamut which were
+     * clipped to it while converting from XYZ or LAB, indexed by channel
+     * @details These are counted by every conversion from XYZ or LAB to RGB,
+     * HSV or HSL, including those to 8-bit and 16-bit RGB.
+     */
+    uint64_t gamut_clipped[3];
+    /**
+     * @brief The number of channels out of range which were given to the
+     * clamping functions, such as `colrcv_lab_clamp()`, indexed by model and
+     * then channel
+     */
+    uint64_t clamped[COLRCV_MODEL_COUNT][3];
+    /**
+     * @brief The number of colours found invalid by the validation
+     * functions, such as `colrcv_lab_is_valid()`, indexed by model
+     */
+    uint64_t invalid[COLRCV_MODEL_COUNT];
+} colrcv_stats_t;
+
+/**
+ * @brief Turns the counting of statistics on or off
+ * @details Counts are kept while statistics are off, so they can be turned on
+ * and off around the code of interest. This may be called while other threads
+ * are converting, but their conversions which are running at the time may or
+ * may not be counted.
+ * @param enabled `true` to count statistics, `false` to stop counting them
+ * @since `v0.6.0`
+ */
+void colrcv_stats_set_enabled(bool enabled);
+
+/**
+ * @brief Gets whether statistics are being counted
+ * @returns `true` if statistics are on
+ * @returns `false` if they are off, which is the default
+ * @since `v0.6.0`
+ */
+bool colrcv_stats_is_enabled(void);
+
+/**
+ * @brief Gets the statistics counted by every thread since they were last
+ * reset, including those of threads which have finished
+ * @details This may be called while other threads are converting, in which
+ * case some of their latest counts may be missed.
+ * @since `v0.6.0`
+ */
+colrcv_stats_t colrcv_stats_get_snapshot(void);
+
+/**
+ * @brief Sets all statistics back to zero
+ * @details Conversions running in other threads at the time may be counted
+ * either before or after the reset, or lost.
+ * @since `v0.6.0`
+ */
+void colrcv_stats_reset(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
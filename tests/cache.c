@@ -0,0 +1,221 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the conversion cache unit (cache.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../unit_test_harness/harness.h"
+
+#include "../colrcv/cache.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/lab.h"
+#include "../colrcv/models/hsv.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the number of different colours converted by the threads of the tests
+#define COLOUR_COUNT 50
+
+// gets one of the colours used by the tests
+static colrcv_rgb_t get_test_colour(size_t i) {
+    return (colrcv_rgb_t){
+        .r = (double)(i * 37 % 256),
+        .g = (double)(i * 101 % 256),
+        .b = (double)(i * 59 % 256),
+    };
+}
+
+// checks that two LAB colours are exactly the same
+static bool lab_equal(colrcv_lab_t x, colrcv_lab_t y) {
+    return x.l == y.l && x.a == y.a && x.b == y.b;
+}
+
+/*
+ * Test the function colrcv_cache_convert
+ * Converting a colour twice should miss and then hit, giving exactly the same
+ * results as the single-colour conversion functions both times
+ */
+static colrcv_test_result_t test_colrcv_cache_convert_hit(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_cache_t* cache = colrcv_cache_create(1000);
+    const colrcv_rgb_t rgb = get_test_colour(7);
+    const colrcv_lab_t expected = colrcv_rgb_to_lab(rgb);
+    colrcv_lab_t first, second;
+    colrcv_hsv_t hsv;
+    bool success = cache != NULL && colrcv_cache_get_capacity(cache) >= 1000;
+    success = success && colrcv_cache_convert(
+        cache, COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, &rgb, &first
+    ) && colrcv_cache_convert(
+        cache, COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, &rgb, &second
+    ) && lab_equal(first, expected) && lab_equal(second, expected);
+    // the same colour converted to another model is a different entry
+    success = success && colrcv_cache_convert(
+        cache, COLRCV_MODEL_RGB, COLRCV_MODEL_HSV, &rgb, &hsv
+    ) && hsv.h == colrcv_rgb_to_hsv(rgb).h;
+    if(success) {
+        colrcv_cache_stats_t stats = colrcv_cache_get_stats(cache);
+        success = stats.hits == 1 && stats.misses == 2;
+        colrcv_cache_clear(cache);
+        stats = colrcv_cache_get_stats(cache);
+        success = success && stats.hits == 0 && stats.misses == 0;
+    }
+    colrcv_cache_free(cache);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_cache_convert
+ * A cache should hold no more than its capacity, forgetting the colours used
+ * least recently
+ */
+static colrcv_test_result_t test_colrcv_cache_convert_bounded(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_cache_t* cache = colrcv_cache_create(1);
+    bool success = cache != NULL;
+    const size_t capacity = success ? colrcv_cache_get_capacity(cache) : 0;
+    colrcv_lab_t lab;
+    // many more colours than fit, each converted once
+    for(size_t i = 0; success && i < capacity * 20; i++) {
+        const colrcv_lab_t colour = { .l = (double)i, .a = 0.0, .b = 0.0, };
+        success = colrcv_cache_convert(
+            cache, COLRCV_MODEL_LAB, COLRCV_MODEL_RGB, &colour, &lab
+        );
+    }
+    // the first of them should have been forgotten
+    const colrcv_lab_t first = { .l = 0.0, .a = 0.0, .b = 0.0, };
+    success = success && colrcv_cache_convert(
+        cache, COLRCV_MODEL_LAB, COLRCV_MODEL_RGB, &first, &lab
+    );
+    if(success) {
+        const colrcv_cache_stats_t stats = colrcv_cache_get_stats(cache);
+        success = stats.hits == 0 && stats.misses == capacity * 20 + 1;
+    }
+    colrcv_cache_free(cache);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+// converts the test colours over and over, checking each result
+static void* convert_colours(void* argument) {
+    colrcv_cache_t* cache = argument;
+    bool* success = malloc(sizeof(bool));
+    if(success == NULL) {
+        return NULL;
+    }
+    *success = true;
+    for(size_t i = 0; *success && i < COLOUR_COUNT * 200; i++) {
+        const colrcv_rgb_t rgb = get_test_colour(i % COLOUR_COUNT);
+        colrcv_lab_t lab;
+        *success = colrcv_cache_convert(
+            cache, COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, &rgb, &lab
+        ) && lab_equal(lab, colrcv_rgb_to_lab(rgb));
+    }
+    return success;
+}
+
+/*
+ * Test the function colrcv_cache_convert
+ * Several threads sharing a cache should all get the right results, with
+ * nearly every lookup a hit
+ */
+static colrcv_test_result_t test_colrcv_cache_convert_threads(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_cache_t* cache = colrcv_cache_create(1000);
+    bool success = cache != NULL;
+    pthread_t threads[4];
+    size_t started = 0;
+    for(; success && started < 4; started++) {
+        success = pthread_create(
+            &threads[started], NULL, convert_colours, cache
+        ) == 0;
+    }
+    for(size_t j = 0; j < started; j++) {
+        void* result = NULL;
+        pthread_join(threads[j], &result);
+        success = success && result != NULL && *(bool*)result;
+        free(result);
+    }
+    if(success) {
+        const colrcv_cache_stats_t stats = colrcv_cache_get_stats(cache);
+        // each colour is missed at most once by each thread
+        success = (
+            stats.hits + stats.misses == 4 * COLOUR_COUNT * 200 &&
+            stats.misses <= 4 * COLOUR_COUNT
+        );
+    }
+    colrcv_cache_free(cache);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_cache_convert
+ * Converting without a cache should still work, and invalid or identical
+ * models should be rejected
+ */
+static colrcv_test_result_t test_colrcv_cache_convert_no_cache(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_rgb_t rgb = get_test_colour(3);
+    colrcv_lab_t lab;
+
+    test.result = (
+        colrcv_cache_convert(
+            NULL, COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, &rgb, &lab
+        ) && lab_equal(lab, colrcv_rgb_to_lab(rgb)) &&
+        !colrcv_cache_convert(
+            NULL, COLRCV_MODEL_RGB, COLRCV_MODEL_RGB, &rgb, &lab
+        ) &&
+        !colrcv_cache_convert(
+            NULL, (colrcv_model_t)COLRCV_MODEL_COUNT, COLRCV_MODEL_LAB,
+            &rgb, &lab
+        )
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_cache_convert_hit, &suite);
+    colrcv_add_test_case(test_colrcv_cache_convert_bounded, &suite);
+    colrcv_add_test_case(test_colrcv_cache_convert_threads, &suite);
+    colrcv_add_test_case(test_colrcv_cache_convert_no_cache, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -189,6 +189,25 @@ static colrcv_test_result_t test_colrcv_clamp_greater_than_range(void) {
     return test;
 }
 
+/*
+ * Test the functions colrcv_set_accuracy and colrcv_get_accuracy
+ * The accuracy should start as COLRCV_ACCURACY_EXACT and then be whatever was
+ * last set
+ */
+static colrcv_test_result_t test_colrcv_set_accuracy(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    bool success = colrcv_get_accuracy() == COLRCV_ACCURACY_EXACT;
+    colrcv_set_accuracy(COLRCV_ACCURACY_FAST);
+    success = success && (colrcv_get_accuracy() == COLRCV_ACCURACY_FAST);
+    colrcv_set_accuracy(COLRCV_ACCURACY_EXACT);
+    success = success && (colrcv_get_accuracy() == COLRCV_ACCURACY_EXACT);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
 int main(void) {
     // initialise test suite
     colrcv_test_suite_t suite = colrcv_init_test_suite();
@@ -203,6 +222,7 @@ int main(void) {
     colrcv_add_test_case(test_colrcv_clamp_within_range, &suite);
     colrcv_add_test_case(test_colrcv_clamp_less_than_range, &suite);
     colrcv_add_test_case(test_colrcv_clamp_greater_than_range, &suite);
+    colrcv_add_test_case(test_colrcv_set_accuracy, &suite);
     // run test suite
     colrcv_run_test_suite(&suite);
     // free test suite
@@ -0,0 +1,269 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the runtime conversion selection unit (convert.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+
+#include "../colrcv/convert.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/hsv.h"
+#include "../colrcv/models/hsl.h"
+#include "../colrcv/models/lab.h"
+#include "../colrcv/models/xyz.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Test the function colrcv_get_soa_conversion
+ * Function should return the batch conversion function between the models
+ */
+static colrcv_test_result_t test_colrcv_get_soa_conversion(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    test.result = (
+        colrcv_get_soa_conversion(
+            COLRCV_MODEL_RGB, COLRCV_MODEL_LAB
+        ) == colrcv_rgb_to_lab_soa &&
+        colrcv_get_soa_conversion(
+            COLRCV_MODEL_XYZ, COLRCV_MODEL_RGB
+        ) == colrcv_xyz_to_rgb_soa
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+/*
+ * Test the function colrcv_get_soa_conversion
+ * Function should return a conversion for every pair of different models, and
+ * NULL for the same model twice
+ */
+static colrcv_test_result_t test_colrcv_get_soa_conversion_all(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(int from = 0; from < COLRCV_MODEL_COUNT; from++) {
+        for(int to = 0; to < COLRCV_MODEL_COUNT; to++) {
+            colrcv_soa_conversion_t conversion = colrcv_get_soa_conversion(
+                (colrcv_model_t)from, (colrcv_model_t)to
+            );
+            success = success && ((from == to) == (conversion == NULL));
+        }
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_get_soa_conversion
+ * Function should return NULL for models that are not valid
+ */
+static colrcv_test_result_t test_colrcv_get_soa_conversion_invalid(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    test.result = (
+        colrcv_get_soa_conversion(
+            (colrcv_model_t)COLRCV_MODEL_COUNT, COLRCV_MODEL_RGB
+        ) == NULL &&
+        colrcv_get_soa_conversion(
+            COLRCV_MODEL_RGB, (colrcv_model_t)-1
+        ) == NULL
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+/*
+ * Test the function colrcv_get_model_range
+ * Function should give the same ranges as the model's constants
+ */
+static colrcv_test_result_t test_colrcv_get_model_range(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double min[3], max[3];
+
+    bool success = colrcv_get_model_range(COLRCV_MODEL_LAB, min, max);
+    success = success && (
+        min[0] == COLRCV_LAB_L_MIN_VALUE &&
+        min[1] == COLRCV_LAB_A_MIN_VALUE &&
+        min[2] == COLRCV_LAB_B_MIN_VALUE &&
+        max[0] == COLRCV_LAB_MAX_VALUE &&
+        max[1] == COLRCV_LAB_MAX_VALUE &&
+        max[2] == COLRCV_LAB_MAX_VALUE
+    );
+    success = success && !colrcv_get_model_range(
+        (colrcv_model_t)COLRCV_MODEL_COUNT, min, max
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+// the number of colours used by the batch validation and clamping test
+#define RANGE_COUNT 21
+
+/*
+ * the batch validation and clamping functions of a model, and its
+ * single-colour ones taking its channels as an array, to compare them with
+ */
+typedef struct model_range_functions_t {
+    size_t (* validate_soa)(
+        const double*, const double*, const double*, uint8_t*, size_t
+    );
+    void (* clamp_soa)(double*, double*, double*, size_t);
+    bool (* is_valid)(const double channels[3]);
+    void (* clamp)(double channels[3]);
+} model_range_functions_t;
+
+// defines is_valid and clamp functions on channel arrays for a model
+#define DEFINE_RANGE_FUNCTIONS(model, c0, c1, c2) \
+    static bool model##_is_valid(const double channels[3]) { \
+        return colrcv_##model##_is_valid((colrcv_##model##_t){ \
+            .c0 = channels[0], .c1 = channels[1], .c2 = channels[2], \
+        }); \
+    } \
+    static void model##_clamp(double channels[3]) { \
+        const colrcv_##model##_t colour = colrcv_##model##_clamp( \
+            (colrcv_##model##_t){ \
+                .c0 = channels[0], .c1 = channels[1], .c2 = channels[2], \
+            } \
+        ); \
+        channels[0] = colour.c0; \
+        channels[1] = colour.c1; \
+        channels[2] = colour.c2; \
+    }
+
+DEFINE_RANGE_FUNCTIONS(rgb, r, g, b)
+DEFINE_RANGE_FUNCTIONS(hsv, h, s, v)
+DEFINE_RANGE_FUNCTIONS(hsl, h, s, l)
+DEFINE_RANGE_FUNCTIONS(lab, l, a, b)
+DEFINE_RANGE_FUNCTIONS(xyz, x, y, z)
+
+static const model_range_functions_t MODEL_RANGE_FUNCTIONS[
+    COLRCV_MODEL_COUNT
+] = {
+    [COLRCV_MODEL_RGB] = {
+        colrcv_rgb_validate_soa, colrcv_rgb_clamp_soa, rgb_is_valid, rgb_clamp,
+    },
+    [COLRCV_MODEL_HSV] = {
+        colrcv_hsv_validate_soa, colrcv_hsv_clamp_soa, hsv_is_valid, hsv_clamp,
+    },
+    [COLRCV_MODEL_HSL] = {
+        colrcv_hsl_validate_soa, colrcv_hsl_clamp_soa, hsl_is_valid, hsl_clamp,
+    },
+    [COLRCV_MODEL_LAB] = {
+        colrcv_lab_validate_soa, colrcv_lab_clamp_soa, lab_is_valid, lab_clamp,
+    },
+    [COLRCV_MODEL_XYZ] = {
+        colrcv_xyz_validate_soa, colrcv_xyz_clamp_soa, xyz_is_valid, xyz_clamp,
+    },
+};
+
+/*
+ * Test the functions colrcv_rgb_validate_soa, colrcv_rgb_clamp_soa and their
+ * equivalents for every other model
+ * They should find the same colours invalid as the model's is_valid function
+ * and clamp each colour to exactly the same values as its clamp function,
+ * NaNs and negative zeros included
+ */
+static colrcv_test_result_t test_colrcv_validate_and_clamp_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    bool success = true;
+    for(size_t model = 0; model < COLRCV_MODEL_COUNT; model++) {
+        const model_range_functions_t* functions = (
+            &MODEL_RANGE_FUNCTIONS[model]
+        );
+        double min[3], max[3];
+        colrcv_get_model_range((colrcv_model_t)model, min, max);
+        // more than 8 colours, so that the scalar remainder is also used
+        double channels[3][RANGE_COUNT];
+        double colours[RANGE_COUNT][3];
+        uint8_t invalid[(RANGE_COUNT + 7) / 8];
+        // sweep each channel from below its range to above it
+        for(size_t i = 0; i < RANGE_COUNT; i++) {
+            for(size_t ch = 0; ch < 3; ch++) {
+                const double step = (double)((i * (3 + 2 * ch)) % 13) - 2.0;
+                channels[ch][i] = min[ch] + (max[ch] - min[ch]) * step / 8.0;
+            }
+        }
+        // both in range of every model, but not bit-identical to 0.0
+        channels[0][3] = -0.0;
+        channels[2][9] = -0.0;
+        channels[1][5] = NAN;
+        size_t expected = 0;
+        for(size_t i = 0; i < RANGE_COUNT; i++) {
+            for(size_t ch = 0; ch < 3; ch++) {
+                colours[i][ch] = channels[ch][i];
+            }
+            expected += !functions->is_valid(colours[i]);
+        }
+        success = success && functions->validate_soa(
+            channels[0], channels[1], channels[2], invalid, RANGE_COUNT
+        ) == expected && expected > 0;
+        // without the bitmask, only the count is given
+        success = success && functions->validate_soa(
+            channels[0], channels[1], channels[2], NULL, RANGE_COUNT
+        ) == expected;
+        for(size_t i = 0; i < RANGE_COUNT; i++) {
+            const bool bit = (invalid[i / 8] >> (i % 8)) & 1;
+            success = success && bit == !functions->is_valid(colours[i]);
+        }
+        functions->clamp_soa(
+            channels[0], channels[1], channels[2], RANGE_COUNT
+        );
+        for(size_t i = 0; i < RANGE_COUNT; i++) {
+            functions->clamp(colours[i]);
+            for(size_t ch = 0; ch < 3; ch++) {
+                success = success && memcmp(
+                    &channels[ch][i], &colours[i][ch], sizeof(double)
+                ) == 0;
+            }
+        }
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_get_soa_conversion, &suite);
+    colrcv_add_test_case(test_colrcv_get_soa_conversion_all, &suite);
+    colrcv_add_test_case(test_colrcv_get_soa_conversion_invalid, &suite);
+    colrcv_add_test_case(test_colrcv_get_model_range, &suite);
+    colrcv_add_test_case(test_colrcv_validate_and_clamp_soa, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,253 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the distinct pixel conversion unit (dedup.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+#include "support.h"
+
+#include "../colrcv/dedup.h"
+#include "../colrcv/pixel.h"
+#include "../colrcv/models/lab.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// number of pixels in each test image, many blocks' worth
+#define PIXEL_COUNT 100000
+
+/*
+ * relative tolerance of a result against converting directly, to within the
+ * last bit or so
+ */
+#define DEDUP_TOLERANCE 1e-9
+
+// the arrays converted to by each test, directly and without duplicates
+typedef struct test_output_t {
+    double* buffer;
+    double* direct[4];
+    double* dedup[4];
+} test_output_t;
+
+static bool create_output(test_output_t* output) {
+    output->buffer = malloc(PIXEL_COUNT * 8 * sizeof(double));
+    for(size_t i = 0; i < 4; i++) {
+        output->direct[i] = output->buffer + PIXEL_COUNT * i;
+        output->dedup[i] = output->buffer + PIXEL_COUNT * (i + 4);
+    }
+    return output->buffer != NULL;
+}
+
+// checks the first `count` values of each array converted to by a test
+static bool outputs_match(const test_output_t* output, size_t count) {
+    bool success = true;
+    for(size_t ch = 0; success && ch < 4; ch++) {
+        for(size_t i = 0; success && i < count; i++) {
+            success = relatively_close(
+                output->dedup[ch][i], output->direct[ch][i], DEDUP_TOLERANCE
+            );
+        }
+    }
+    return success;
+}
+
+/*
+ * converts 32-bit pixels to LAB both directly and with
+ * colrcv_dedup_pixels_to_soa, checking they match and giving the number of
+ * colours converted by the latter, or 0 if they don't match
+ */
+static size_t convert_both(const uint32_t* pixels) {
+    test_output_t output;
+    size_t converted = 0;
+    bool success = create_output(&output) && colrcv_pixels_to_soa(
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_PREMULTIPLIED, pixels,
+        COLRCV_MODEL_LAB, output.direct[0], output.direct[1],
+        output.direct[2], output.direct[3], PIXEL_COUNT
+    ) && colrcv_dedup_pixels_to_soa(
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_PREMULTIPLIED, pixels,
+        COLRCV_MODEL_LAB, output.dedup[0], output.dedup[1],
+        output.dedup[2], output.dedup[3], PIXEL_COUNT, &converted
+    ) && outputs_match(&output, PIXEL_COUNT);
+    free(output.buffer);
+    return success ? converted : 0;
+}
+
+/*
+ * Test the function colrcv_dedup_pixels_to_soa
+ * An image of a few hundred colours, in runs and scattered, should only have
+ * those colours converted, giving the same results as converting directly
+ */
+static colrcv_test_result_t test_colrcv_dedup_pixels_to_soa_palette(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint32_t palette[300];
+    for(size_t i = 0; i < 300; i++) {
+        palette[i] = (uint32_t)(i * 2654435761u);
+    }
+    uint32_t* pixels = malloc(PIXEL_COUNT * sizeof(uint32_t));
+    bool success = pixels != NULL;
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        // runs of 16 in the first half, then every pixel different
+        pixels[i] = palette[
+            ((i < PIXEL_COUNT / 2) ? i / 16 : i * 7) % 300
+        ];
+    }
+    success = success && convert_both(pixels) == 300;
+    free(pixels);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_dedup_pixels_to_soa
+ * When every pixel is different, all of them should be converted and still
+ * give the same results as converting directly
+ */
+static colrcv_test_result_t test_colrcv_dedup_pixels_to_soa_distinct(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint32_t* pixels = malloc(PIXEL_COUNT * sizeof(uint32_t));
+    bool success = pixels != NULL;
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        pixels[i] = (uint32_t)(i * 2654435761u);
+    }
+    success = success && convert_both(pixels) == PIXEL_COUNT;
+    free(pixels);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_dedup_pixels_to_soa
+ * When more distinct colours than the table can hold turn up part-way through
+ * an image, the rest of it should be converted directly
+ */
+static colrcv_test_result_t test_colrcv_dedup_pixels_to_soa_overflow(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint32_t* pixels = malloc(PIXEL_COUNT * sizeof(uint32_t));
+    bool success = pixels != NULL;
+    /*
+     * 10 colours, then every other pixel distinct for the last half of the
+     * image, which is too few new pixels to give up on the table early
+     */
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        const bool distinct = (i >= PIXEL_COUNT / 2) && (i % 2 == 1);
+        pixels[i] = (uint32_t)((distinct ? i : i % 10) * 2654435761u);
+    }
+    const size_t converted = success ? convert_both(pixels) : 0;
+    // more than the distinct colours are converted, but not every pixel
+    success = (
+        converted > PIXEL_COUNT / 4 + 10 && converted < PIXEL_COUNT
+    );
+    free(pixels);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_dedup_pixels_to_strided
+ * RGB565 pixels of a few colours should convert to the same colour structs as
+ * converting them directly
+ */
+static colrcv_test_result_t test_colrcv_dedup_pixels_to_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint16_t* pixels = malloc(PIXEL_COUNT * sizeof(uint16_t));
+    colrcv_lab_t* direct = malloc(PIXEL_COUNT * sizeof(colrcv_lab_t));
+    colrcv_lab_t* dedup = malloc(PIXEL_COUNT * sizeof(colrcv_lab_t));
+    size_t converted = 0;
+    bool success = pixels != NULL && direct != NULL && dedup != NULL;
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        pixels[i] = (uint16_t)((i / 100) * 40503u);
+    }
+    success = success && colrcv_pixels_to_strided(
+        COLRCV_PIXEL_RGB565, COLRCV_ALPHA_STRAIGHT, pixels, COLRCV_MODEL_LAB,
+        direct, sizeof(colrcv_lab_t), NULL, PIXEL_COUNT
+    ) && colrcv_dedup_pixels_to_strided(
+        COLRCV_PIXEL_RGB565, COLRCV_ALPHA_STRAIGHT, pixels, COLRCV_MODEL_LAB,
+        dedup, sizeof(colrcv_lab_t), NULL, PIXEL_COUNT, &converted
+    ) && converted == PIXEL_COUNT / 100;
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        success = (
+            relatively_close(dedup[i].l, direct[i].l, DEDUP_TOLERANCE) &&
+            relatively_close(dedup[i].a, direct[i].a, DEDUP_TOLERANCE) &&
+            relatively_close(dedup[i].b, direct[i].b, DEDUP_TOLERANCE)
+        );
+    }
+    free(dedup);
+    free(direct);
+    free(pixels);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_dedup_pixels_to_soa
+ * Invalid formats, alpha modes and models should be rejected
+ */
+static colrcv_test_result_t test_colrcv_dedup_pixels_invalid(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint8_t pixel[4] = { 0, 0, 0, 0, };
+    double a[1], b[1], c[1];
+
+    test.result = (
+        !colrcv_dedup_pixels_to_soa(
+            (colrcv_pixel_format_t)COLRCV_PIXEL_FORMAT_COUNT,
+            COLRCV_ALPHA_STRAIGHT, pixel, COLRCV_MODEL_LAB,
+            a, b, c, NULL, 1, NULL
+        ) &&
+        !colrcv_dedup_pixels_to_soa(
+            COLRCV_PIXEL_RGBA8888, (colrcv_alpha_mode_t)2,
+            pixel, COLRCV_MODEL_LAB, a, b, c, NULL, 1, NULL
+        ) &&
+        !colrcv_dedup_pixels_to_strided(
+            COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_STRAIGHT, pixel,
+            (colrcv_model_t)COLRCV_MODEL_COUNT, a, sizeof(double), NULL,
+            1, NULL
+        )
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_dedup_pixels_to_soa_palette, &suite);
+    colrcv_add_test_case(test_colrcv_dedup_pixels_to_soa_distinct, &suite);
+    colrcv_add_test_case(test_colrcv_dedup_pixels_to_soa_overflow, &suite);
+    colrcv_add_test_case(test_colrcv_dedup_pixels_to_strided, &suite);
+    colrcv_add_test_case(test_colrcv_dedup_pixels_invalid, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
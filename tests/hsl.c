@@ -564,6 +564,40 @@ struct hsl_to_lab_pair_t {
     colrcv_lab_t output;
 };
 
+/*
+ * Test the function colrcv_hsl_to_hsv
+ * Function should give the same results as converting to RGB and then to HSV,
+ * including for a hue of 360
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_hsv_matches_rgb(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(uint16_t h = 0; h <= 360; h += 24) {
+        for(uint8_t s = 0; s <= 100; s += 20) {
+            for(uint8_t l = 0; l <= 100; l += 10) {
+                colrcv_hsl_t hsl = { .h = h, .s = s, .l = l, };
+                colrcv_hsv_t result = colrcv_hsl_to_hsv(hsl);
+                colrcv_hsv_t expected = colrcv_rgb_to_hsv(
+                    colrcv_hsl_to_rgb(hsl)
+                );
+                // the hue of a grey is meaningless, RGB rounding picks one
+                success = success && (
+                    (almost_equal(expected.s, 0) ||
+                    almost_equal(result.h, expected.h)) &&
+                    almost_equal(result.s, expected.s) &&
+                    almost_equal(result.v, expected.v)
+                );
+            }
+        }
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
 /*
  * Test the function colrcv_hsl_to_lab
  * Function should return a correctly calculated LAB colour for the given HSL
@@ -683,6 +717,497 @@ static colrcv_test_result_t test_colrcv_hsl_to_xyz(void) {
     return test;
 }
 
+/*
+ * Sample HSL colours used by the batch conversion tests, which check that each
+ * batch conversion function gives the same results as its single-colour
+ * counterpart
+ */
+#define SAMPLE_COUNT 5
+static const colrcv_hsl_t SAMPLE_COLOURS[SAMPLE_COUNT] = {
+    { .h = 137, .s = 90, .l = 51, },
+    { .h = 6, .s = 84, .l = 46, },
+    { .h = 0, .s = 0, .l = 13, },
+    { .h = 240, .s = 100, .l = 50, },
+    { .h = 300, .s = 40, .l = 70, },
+};
+
+// splits the sample colours into one array per channel
+static void split_sample_colours(double* in_h, double* in_s, double* in_l) {
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        in_h[i] = SAMPLE_COLOURS[i].h;
+        in_s[i] = SAMPLE_COLOURS[i].s;
+        in_l[i] = SAMPLE_COLOURS[i].l;
+    }
+}
+
+/*
+ * Test the function colrcv_hsl_to_rgb_soa
+ * Function should return the same colours as colrcv_hsl_to_rgb does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_rgb_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_h[SAMPLE_COUNT], in_s[SAMPLE_COUNT], in_l[SAMPLE_COUNT];
+    double out_r[SAMPLE_COUNT], out_g[SAMPLE_COUNT], out_b[SAMPLE_COUNT];
+    split_sample_colours(in_h, in_s, in_l);
+    colrcv_hsl_to_rgb_soa(
+        in_h, in_s, in_l, out_r, out_g, out_b, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_rgb_t expected = colrcv_hsl_to_rgb(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_r[i], expected.r) &&
+            almost_equal(out_g[i], expected.g) &&
+            almost_equal(out_b[i], expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl_to_hsv_soa
+ * Function should return the same colours as colrcv_hsl_to_hsv does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_hsv_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_h[SAMPLE_COUNT], in_s[SAMPLE_COUNT], in_l[SAMPLE_COUNT];
+    double out_h[SAMPLE_COUNT], out_s[SAMPLE_COUNT], out_v[SAMPLE_COUNT];
+    split_sample_colours(in_h, in_s, in_l);
+    colrcv_hsl_to_hsv_soa(
+        in_h, in_s, in_l, out_h, out_s, out_v, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsv_t expected = colrcv_hsl_to_hsv(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_h[i], expected.h) &&
+            almost_equal(out_s[i], expected.s) &&
+            almost_equal(out_v[i], expected.v)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl_to_lab_soa
+ * Function should return the same colours as colrcv_hsl_to_lab does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_lab_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_h[SAMPLE_COUNT], in_s[SAMPLE_COUNT], in_l[SAMPLE_COUNT];
+    double out_l[SAMPLE_COUNT], out_a[SAMPLE_COUNT], out_b[SAMPLE_COUNT];
+    split_sample_colours(in_h, in_s, in_l);
+    colrcv_hsl_to_lab_soa(
+        in_h, in_s, in_l, out_l, out_a, out_b, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_hsl_to_lab(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_l[i], expected.l) &&
+            almost_equal(out_a[i], expected.a) &&
+            almost_equal(out_b[i], expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl_to_xyz_soa
+ * Function should return the same colours as colrcv_hsl_to_xyz does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_xyz_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_h[SAMPLE_COUNT], in_s[SAMPLE_COUNT], in_l[SAMPLE_COUNT];
+    double out_x[SAMPLE_COUNT], out_y[SAMPLE_COUNT], out_z[SAMPLE_COUNT];
+    split_sample_colours(in_h, in_s, in_l);
+    colrcv_hsl_to_xyz_soa(
+        in_h, in_s, in_l, out_x, out_y, out_z, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_hsl_to_xyz(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_x[i], expected.x) &&
+            almost_equal(out_y[i], expected.y) &&
+            almost_equal(out_z[i], expected.z)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * A record type with extra fields either side of a colour, used by the strided
+ * batch conversion tests
+ */
+struct sample_record_t {
+    double alpha;
+    colrcv_hsl_t colour;
+    uint32_t id;
+};
+
+// fills the given records with the sample colours
+static void fill_sample_records(struct sample_record_t* records) {
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        records[i].alpha = 1.0;
+        records[i].colour = SAMPLE_COLOURS[i];
+        records[i].id = i;
+    }
+}
+
+/*
+ * Test the function colrcv_hsl_to_rgb_strided
+ * Function should return the same colours as colrcv_hsl_to_rgb does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_rgb_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_rgb_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_hsl_to_rgb_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_rgb_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_rgb_t expected = colrcv_hsl_to_rgb(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].r, expected.r) &&
+            almost_equal(output[i].g, expected.g) &&
+            almost_equal(output[i].b, expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl_to_hsv_strided
+ * Function should return the same colours as colrcv_hsl_to_hsv does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_hsv_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_hsv_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_hsl_to_hsv_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_hsv_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsv_t expected = colrcv_hsl_to_hsv(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].h, expected.h) &&
+            almost_equal(output[i].s, expected.s) &&
+            almost_equal(output[i].v, expected.v)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl_to_lab_strided
+ * Function should return the same colours as colrcv_hsl_to_lab does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_lab_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_lab_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_hsl_to_lab_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_lab_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_hsl_to_lab(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].l, expected.l) &&
+            almost_equal(output[i].a, expected.a) &&
+            almost_equal(output[i].b, expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl_to_xyz_strided
+ * Function should return the same colours as colrcv_hsl_to_xyz does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_hsl_to_xyz_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_xyz_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_hsl_to_xyz_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_xyz_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_hsl_to_xyz(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].x, expected.x) &&
+            almost_equal(output[i].y, expected.y) &&
+            almost_equal(output[i].z, expected.z)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the single-precision conversion functions from HSL
+ * Each should return the double-precision result rounded to float
+ */
+static colrcv_test_result_t test_colrcv_hslf_conversions(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    /*
+     * rounded to single precision in a loop of their own, as GCC 12 drops
+     * the rounding when it is done in the same loop as widening them again
+     */
+    colrcv_hslf_t colours[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colours[i] = (colrcv_hslf_t){
+            .h = (float)SAMPLE_COLOURS[i].h,
+            .s = (float)SAMPLE_COLOURS[i].s,
+            .l = (float)SAMPLE_COLOURS[i].l,
+        };
+    }
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hslf_t colour = colours[i];
+        colrcv_hsl_t widened = { .h = colour.h, .s = colour.s, .l = colour.l, };
+        colrcv_rgb_t rgb = colrcv_hsl_to_rgb(widened);
+        colrcv_rgbf_t rgbf = colrcv_hslf_to_rgbf(colour);
+        success = success && (
+            rgbf.r == (float)rgb.r &&
+            rgbf.g == (float)rgb.g &&
+            rgbf.b == (float)rgb.b
+        );
+        colrcv_hsv_t hsv = colrcv_hsl_to_hsv(widened);
+        colrcv_hsvf_t hsvf = colrcv_hslf_to_hsvf(colour);
+        success = success && (
+            hsvf.h == (float)hsv.h &&
+            hsvf.s == (float)hsv.s &&
+            hsvf.v == (float)hsv.v
+        );
+        colrcv_lab_t lab = colrcv_hsl_to_lab(widened);
+        colrcv_labf_t labf = colrcv_hslf_to_labf(colour);
+        success = success && (
+            labf.l == (float)lab.l &&
+            labf.a == (float)lab.a &&
+            labf.b == (float)lab.b
+        );
+        colrcv_xyz_t xyz = colrcv_hsl_to_xyz(widened);
+        colrcv_xyzf_t xyzf = colrcv_hslf_to_xyzf(colour);
+        success = success && (
+            xyzf.x == (float)xyz.x &&
+            xyzf.y == (float)xyz.y &&
+            xyzf.z == (float)xyz.z
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_hslf_to_labf_soa and colrcv_hslf_to_labf_strided
+ * Functions should return the same colours as colrcv_hslf_to_labf does
+ */
+static colrcv_test_result_t test_colrcv_hslf_to_labf_batch(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_hslf_t samples[SAMPLE_COUNT];
+    colrcv_labf_t output[SAMPLE_COUNT];
+    float in_h[SAMPLE_COUNT], in_s[SAMPLE_COUNT], in_l[SAMPLE_COUNT];
+    float out_l[SAMPLE_COUNT], out_a[SAMPLE_COUNT], out_b[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        samples[i] = (colrcv_hslf_t){
+            .h = (float)SAMPLE_COLOURS[i].h,
+            .s = (float)SAMPLE_COLOURS[i].s,
+            .l = (float)SAMPLE_COLOURS[i].l,
+        };
+        in_h[i] = samples[i].h;
+        in_s[i] = samples[i].s;
+        in_l[i] = samples[i].l;
+    }
+    colrcv_hslf_to_labf_soa(
+        in_h, in_s, in_l, out_l, out_a, out_b, SAMPLE_COUNT
+    );
+    colrcv_hslf_to_labf_strided(
+        samples, sizeof(colrcv_hslf_t), output, sizeof(colrcv_labf_t),
+        SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_labf_t expected = colrcv_hslf_to_labf(samples[i]);
+        success = success && (
+            almost_equal(out_l[i], expected.l) &&
+            almost_equal(output[i].l, expected.l) &&
+            almost_equal(out_a[i], expected.a) &&
+            almost_equal(output[i].a, expected.a) &&
+            almost_equal(out_b[i], expected.b) &&
+            almost_equal(output[i].b, expected.b)
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl8_to_rgb8
+ * Function should give results within 1 of colrcv_hsl_to_rgb, rounded
+ */
+static colrcv_test_result_t test_colrcv_hsl8_to_rgb8(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(uint32_t h = 0; h < 65536; h += 1111) {
+        for(int s = 0; s < 256; s += 3) {
+            for(int l = 0; l < 256; l += 5) {
+                colrcv_hsl8_t hsl8 = {
+                    .h = (uint16_t)h, .s = (uint8_t)s, .l = (uint8_t)l,
+                };
+                colrcv_rgb8_t result = colrcv_hsl8_to_rgb8(hsl8);
+                colrcv_rgb_t expected = colrcv_hsl_to_rgb(
+                    (colrcv_hsl_t){
+                        .h = h * 360.0 / 65536, .s = s / 2.55, .l = l / 2.55,
+                    }
+                );
+                success = success && (
+                    within(result.r, round(expected.r), 1) &&
+                    within(result.g, round(expected.g), 1) &&
+                    within(result.b, round(expected.b), 1)
+                );
+            }
+        }
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_hsl8_to_rgb8_strided
+ * Function should give the same results as colrcv_hsl8_to_rgb8
+ */
+static colrcv_test_result_t test_colrcv_hsl8_to_rgb8_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_hsl8_t input[1000];
+    colrcv_rgb8_t output[1000];
+    for(size_t i = 0; i < 1000; i++) {
+        input[i] = (colrcv_hsl8_t){
+            .h = (uint16_t)(i * 97), .s = (uint8_t)(i * 3), .l = (uint8_t)i,
+        };
+    }
+    colrcv_hsl8_to_rgb8_strided(
+        input, sizeof(colrcv_hsl8_t), output, sizeof(colrcv_rgb8_t), 1000
+    );
+    // flag to keep track of result
+    bool success = true;
+    for(size_t i = 0; i < 1000; i++) {
+        colrcv_rgb8_t expected = colrcv_hsl8_to_rgb8(input[i]);
+        success = success && (
+            output[i].r == expected.r &&
+            output[i].g == expected.g &&
+            output[i].b == expected.b
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
 int main(void) {
     // initialise test suite
     colrcv_test_suite_t suite = colrcv_init_test_suite();
@@ -705,8 +1230,21 @@ int main(void) {
     colrcv_add_test_case(test_colrcv_hsl_clamp_l_outside_range, &suite);
     colrcv_add_test_case(test_colrcv_hsl_to_rgb, &suite);
     colrcv_add_test_case(test_colrcv_hsl_to_hsv, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_hsv_matches_rgb, &suite);
     colrcv_add_test_case(test_colrcv_hsl_to_lab, &suite);
     colrcv_add_test_case(test_colrcv_hsl_to_xyz, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_rgb_soa, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_hsv_soa, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_lab_soa, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_xyz_soa, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_rgb_strided, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_hsv_strided, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_lab_strided, &suite);
+    colrcv_add_test_case(test_colrcv_hsl_to_xyz_strided, &suite);
+    colrcv_add_test_case(test_colrcv_hslf_conversions, &suite);
+    colrcv_add_test_case(test_colrcv_hslf_to_labf_batch, &suite);
+    colrcv_add_test_case(test_colrcv_hsl8_to_rgb8, &suite);
+    colrcv_add_test_case(test_colrcv_hsl8_to_rgb8_strided, &suite);
     // run test suite
     colrcv_run_test_suite(&suite);
     // free test suite
@@ -0,0 +1,199 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the scalar functions when inlined with COLRCV_INLINE
+ * (colrcv.h), against the batch functions compiled into the library
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// must be defined before any colrcv header is included
+#define COLRCV_INLINE
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+#include "support.h"
+
+// a model header first, to check that it brings in everything it needs
+#include "../colrcv/models/lab.h"
+#include "../colrcv/colrcv.h"
+#include "../colrcv/stats.h"
+#include "../colrcv/models/xyz.h"
+#include "../colrcv/models/rgb.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the number of colours of each test, spread from below to above the range
+#define INLINE_COUNT 33
+
+/*
+ * Test the functions colrcv_range_valid, colrcv_min, colrcv_max and
+ * colrcv_clamp
+ * The inlined helpers should behave in the same way as those in the library
+ */
+static colrcv_test_result_t test_colrcv_inline_helpers(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const bool success = (
+        colrcv_range_valid(0.0, 0.0, 1.0) &&
+        !colrcv_range_valid(0.0, 2.0, 1.0) &&
+        colrcv_min(1.0, 2.0) == 1.0 &&
+        colrcv_max(1.0, 2.0) == 2.0 &&
+        colrcv_clamp(-1.0, 0.0, 1.0) == 0.0 &&
+        colrcv_clamp(0.5, 0.0, 1.0) == 0.5 &&
+        colrcv_clamp(2.0, 0.0, 1.0) == 1.0
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_lab_is_valid and colrcv_lab_clamp
+ * The inlined functions should give exactly the same results as the batch
+ * validation and clamping functions of the library
+ */
+static colrcv_test_result_t test_colrcv_inline_validate_and_clamp(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double l[INLINE_COUNT], a[INLINE_COUNT], b[INLINE_COUNT];
+    uint8_t invalid[(INLINE_COUNT + 7) / 8];
+    for(size_t i = 0; i < INLINE_COUNT; i++) {
+        l[i] = -20.0 + 140.0 * (double)i / (INLINE_COUNT - 1);
+        a[i] = 200.0 - 400.0 * (double)i / (INLINE_COUNT - 1);
+        b[i] = (i % 2) ? 50.0 : -150.0;
+    }
+    size_t found = 0;
+    for(size_t i = 0; i < INLINE_COUNT; i++) {
+        found += !colrcv_lab_is_valid(
+            (colrcv_lab_t){ .l = l[i], .a = a[i], .b = b[i], }
+        );
+    }
+    bool success = (
+        colrcv_lab_validate_soa(l, a, b, invalid, INLINE_COUNT) == found
+    );
+    for(size_t i = 0; success && i < INLINE_COUNT; i++) {
+        const colrcv_lab_t lab = { .l = l[i], .a = a[i], .b = b[i], };
+        success = (
+            !colrcv_lab_is_valid(lab) == ((invalid[i / 8] >> (i % 8)) & 1)
+        );
+    }
+    colrcv_lab_t clamped[INLINE_COUNT];
+    for(size_t i = 0; i < INLINE_COUNT; i++) {
+        clamped[i] = colrcv_lab_clamp(
+            (colrcv_lab_t){ .l = l[i], .a = a[i], .b = b[i], }
+        );
+    }
+    colrcv_lab_clamp_soa(l, a, b, INLINE_COUNT);
+    for(size_t i = 0; success && i < INLINE_COUNT; i++) {
+        success = (
+            memcmp(&clamped[i].l, &l[i], sizeof(double)) == 0 &&
+            memcmp(&clamped[i].a, &a[i], sizeof(double)) == 0 &&
+            memcmp(&clamped[i].b, &b[i], sizeof(double)) == 0
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_xyz_to_rgb and colrcv_rgbf_to_labf
+ * The inlined conversions should give the same results as the batch
+ * conversions of the library
+ */
+static colrcv_test_result_t test_colrcv_inline_conversions(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double x[INLINE_COUNT], y[INLINE_COUNT], z[INLINE_COUNT];
+    float r[INLINE_COUNT], g[INLINE_COUNT], b[INLINE_COUNT];
+    colrcv_rgb_t rgb[INLINE_COUNT];
+    colrcv_labf_t lab[INLINE_COUNT];
+    for(size_t i = 0; i < INLINE_COUNT; i++) {
+        x[i] = 95.047 * (double)i / (INLINE_COUNT - 1);
+        y[i] = 100.0 - 100.0 * (double)i / (INLINE_COUNT - 1);
+        z[i] = (i % 3) * 50.0;
+        r[i] = (float)(i * 255 / (INLINE_COUNT - 1));
+        g[i] = (float)((i * 97) % 256);
+        b[i] = 255.0f - r[i];
+        rgb[i] = colrcv_xyz_to_rgb(
+            (colrcv_xyz_t){ .x = x[i], .y = y[i], .z = z[i], }
+        );
+        lab[i] = colrcv_rgbf_to_labf(
+            (colrcv_rgbf_t){ .r = r[i], .g = g[i], .b = b[i], }
+        );
+    }
+    colrcv_xyz_to_rgb_soa(x, y, z, x, y, z, INLINE_COUNT);
+    colrcv_rgbf_to_labf_soa(r, g, b, r, g, b, INLINE_COUNT);
+    bool success = true;
+    for(size_t i = 0; success && i < INLINE_COUNT; i++) {
+        success = (
+            almost_equal(rgb[i].r, x[i]) &&
+            almost_equal(rgb[i].g, y[i]) &&
+            almost_equal(rgb[i].b, z[i]) &&
+            almost_equal(lab[i].l, r[i]) &&
+            almost_equal(lab[i].a, g[i]) &&
+            almost_equal(lab[i].b, b[i])
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * Inlined functions should never be counted, even while statistics are on
+ */
+static colrcv_test_result_t test_colrcv_inline_not_counted(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_lab_t outside = { .l = 150.0, .a = 0.0, .b = -200.0, };
+    colrcv_stats_reset();
+    colrcv_stats_set_enabled(true);
+    colrcv_lab_to_rgb(outside);
+    colrcv_lab_clamp(outside);
+    colrcv_lab_is_valid(outside);
+    colrcv_xyz_to_rgb((colrcv_xyz_t){ .x = 100.0, .y = 0.0, .z = 0.0, });
+    colrcv_stats_set_enabled(false);
+    const colrcv_stats_t stats = colrcv_stats_get_snapshot();
+    const uint64_t* counters = (const uint64_t*)&stats;
+    bool success = true;
+    for(size_t i = 0; i < sizeof(stats) / sizeof(uint64_t); i++) {
+        success = success && counters[i] == 0;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_inline_helpers, &suite);
+    colrcv_add_test_case(test_colrcv_inline_validate_and_clamp, &suite);
+    colrcv_add_test_case(test_colrcv_inline_conversions, &suite);
+    colrcv_add_test_case(test_colrcv_inline_not_counted, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -15,6 +15,7 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "../unit_test_harness/harness.h"
 #include "support.h"
@@ -682,6 +683,566 @@ static colrcv_test_result_t test_colrcv_lab_to_xyz(void) {
     return test;
 }
 
+/*
+ * Sample LAB colours used by the batch conversion tests, which check that each
+ * batch conversion function gives the same results as its single-colour
+ * counterpart
+ */
+#define SAMPLE_COUNT 5
+static const colrcv_lab_t SAMPLE_COLOURS[SAMPLE_COUNT] = {
+    { .l = 84.286, .a = -79.863, .b = 67.304, },
+    { .l = 47.849, .a = 63.975, .b = 55.031, },
+    { .l = 12.740, .a = 0, .b = 0, },
+    { .l = 32.302, .a = 79.196, .b = -107.863, },
+    { .l = 100, .a = 0, .b = 0, },
+};
+
+// splits the sample colours into one array per channel
+static void split_sample_colours(double* in_l, double* in_a, double* in_b) {
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        in_l[i] = SAMPLE_COLOURS[i].l;
+        in_a[i] = SAMPLE_COLOURS[i].a;
+        in_b[i] = SAMPLE_COLOURS[i].b;
+    }
+}
+
+/*
+ * Test the function colrcv_lab_to_rgb_soa
+ * Function should return the same colours as colrcv_lab_to_rgb does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_lab_to_rgb_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_l[SAMPLE_COUNT], in_a[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_r[SAMPLE_COUNT], out_g[SAMPLE_COUNT], out_b[SAMPLE_COUNT];
+    split_sample_colours(in_l, in_a, in_b);
+    colrcv_lab_to_rgb_soa(
+        in_l, in_a, in_b, out_r, out_g, out_b, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_rgb_t expected = colrcv_lab_to_rgb(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_r[i], expected.r) &&
+            almost_equal(out_g[i], expected.g) &&
+            almost_equal(out_b[i], expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_hsv_soa
+ * Function should return the same colours as colrcv_lab_to_hsv does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_lab_to_hsv_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_l[SAMPLE_COUNT], in_a[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_h[SAMPLE_COUNT], out_s[SAMPLE_COUNT], out_v[SAMPLE_COUNT];
+    split_sample_colours(in_l, in_a, in_b);
+    colrcv_lab_to_hsv_soa(
+        in_l, in_a, in_b, out_h, out_s, out_v, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsv_t expected = colrcv_lab_to_hsv(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_h[i], expected.h) &&
+            almost_equal(out_s[i], expected.s) &&
+            almost_equal(out_v[i], expected.v)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_hsl_soa
+ * Function should return the same colours as colrcv_lab_to_hsl does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_lab_to_hsl_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_l[SAMPLE_COUNT], in_a[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_h[SAMPLE_COUNT], out_s[SAMPLE_COUNT], out_l[SAMPLE_COUNT];
+    split_sample_colours(in_l, in_a, in_b);
+    colrcv_lab_to_hsl_soa(
+        in_l, in_a, in_b, out_h, out_s, out_l, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsl_t expected = colrcv_lab_to_hsl(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_h[i], expected.h) &&
+            almost_equal(out_s[i], expected.s) &&
+            almost_equal(out_l[i], expected.l)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_xyz_soa
+ * Function should return the same colours as colrcv_lab_to_xyz does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_lab_to_xyz_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_l[SAMPLE_COUNT], in_a[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_x[SAMPLE_COUNT], out_y[SAMPLE_COUNT], out_z[SAMPLE_COUNT];
+    split_sample_colours(in_l, in_a, in_b);
+    colrcv_lab_to_xyz_soa(
+        in_l, in_a, in_b, out_x, out_y, out_z, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_lab_to_xyz(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_x[i], expected.x) &&
+            almost_equal(out_y[i], expected.y) &&
+            almost_equal(out_z[i], expected.z)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * A record type with extra fields either side of a colour, used by the strided
+ * batch conversion tests
+ */
+struct sample_record_t {
+    double alpha;
+    colrcv_lab_t colour;
+    uint32_t id;
+};
+
+// fills the given records with the sample colours
+static void fill_sample_records(struct sample_record_t* records) {
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        records[i].alpha = 1.0;
+        records[i].colour = SAMPLE_COLOURS[i];
+        records[i].id = i;
+    }
+}
+
+/*
+ * Test the function colrcv_lab_to_rgb_strided
+ * Function should return the same colours as colrcv_lab_to_rgb does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_lab_to_rgb_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_rgb_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_lab_to_rgb_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_rgb_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_rgb_t expected = colrcv_lab_to_rgb(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].r, expected.r) &&
+            almost_equal(output[i].g, expected.g) &&
+            almost_equal(output[i].b, expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_hsv_strided
+ * Function should return the same colours as colrcv_lab_to_hsv does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_lab_to_hsv_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_hsv_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_lab_to_hsv_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_hsv_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsv_t expected = colrcv_lab_to_hsv(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].h, expected.h) &&
+            almost_equal(output[i].s, expected.s) &&
+            almost_equal(output[i].v, expected.v)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_hsl_strided
+ * Function should return the same colours as colrcv_lab_to_hsl does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_lab_to_hsl_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_hsl_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_lab_to_hsl_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_hsl_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsl_t expected = colrcv_lab_to_hsl(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].h, expected.h) &&
+            almost_equal(output[i].s, expected.s) &&
+            almost_equal(output[i].l, expected.l)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_xyz_strided
+ * Function should return the same colours as colrcv_lab_to_xyz does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_lab_to_xyz_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_xyz_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_lab_to_xyz_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_xyz_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_lab_to_xyz(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].x, expected.x) &&
+            almost_equal(output[i].y, expected.y) &&
+            almost_equal(output[i].z, expected.z)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_rgb8
+ * Function should give the exact RGB result scaled to 8 bits, to within
+ * half a code plus the documented interpolation error
+ */
+static colrcv_test_result_t test_colrcv_lab_to_rgb8(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(int i = 0; i < 1000; i++) {
+        const colrcv_lab_t lab = {
+            .l = (i % 101),
+            .a = (i % 53) * 4.0 - 100.0,
+            .b = (i % 41) * 5.0 - 100.0,
+        };
+        const colrcv_rgb8_t result = colrcv_lab_to_rgb8(lab);
+        const colrcv_rgb_t exact = colrcv_lab_to_rgb(lab);
+        const double scale = 255.0 / 255.0;
+        success = success && (
+            fabs(result.r - exact.r * scale) < 0.52 &&
+            fabs(result.g - exact.g * scale) < 0.52 &&
+            fabs(result.b - exact.b * scale) < 0.52
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_rgb8_strided
+ * Function should give the same results as colrcv_lab_to_rgb8, to
+ * within rounding error
+ */
+static colrcv_test_result_t test_colrcv_lab_to_rgb8_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_lab_t input[1000];
+    colrcv_rgb8_t output[1000];
+    for(int i = 0; i < 1000; i++) {
+        input[i] = (colrcv_lab_t){
+            .l = (i % 101),
+            .a = (i % 53) * 4.0 - 100.0,
+            .b = (i % 41) * 5.0 - 100.0,
+        };
+    }
+    colrcv_lab_to_rgb8_strided(
+        input, sizeof(colrcv_lab_t),
+        output, sizeof(colrcv_rgb8_t), 1000
+    );
+    // flag to keep track of result
+    bool success = true;
+    for(int i = 0; i < 1000; i++) {
+        const colrcv_rgb8_t expected = colrcv_lab_to_rgb8(input[i]);
+        // codes may differ by one where the exact value is almost halfway
+        success = success && (
+            abs(output[i].r - expected.r) <= 1 &&
+            abs(output[i].g - expected.g) <= 1 &&
+            abs(output[i].b - expected.b) <= 1
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_rgb16
+ * Function should give the exact RGB result scaled to 16 bits, to within
+ * half a code plus the documented interpolation error
+ */
+static colrcv_test_result_t test_colrcv_lab_to_rgb16(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(int i = 0; i < 1000; i++) {
+        const colrcv_lab_t lab = {
+            .l = (i % 101),
+            .a = (i % 53) * 4.0 - 100.0,
+            .b = (i % 41) * 5.0 - 100.0,
+        };
+        const colrcv_rgb16_t result = colrcv_lab_to_rgb16(lab);
+        const colrcv_rgb_t exact = colrcv_lab_to_rgb(lab);
+        const double scale = 65535.0 / 255.0;
+        success = success && (
+            fabs(result.r - exact.r * scale) < 0.52 &&
+            fabs(result.g - exact.g * scale) < 0.52 &&
+            fabs(result.b - exact.b * scale) < 0.52
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lab_to_rgb16_strided
+ * Function should give the same results as colrcv_lab_to_rgb16, to
+ * within rounding error
+ */
+static colrcv_test_result_t test_colrcv_lab_to_rgb16_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_lab_t input[1000];
+    colrcv_rgb16_t output[1000];
+    for(int i = 0; i < 1000; i++) {
+        input[i] = (colrcv_lab_t){
+            .l = (i % 101),
+            .a = (i % 53) * 4.0 - 100.0,
+            .b = (i % 41) * 5.0 - 100.0,
+        };
+    }
+    colrcv_lab_to_rgb16_strided(
+        input, sizeof(colrcv_lab_t),
+        output, sizeof(colrcv_rgb16_t), 1000
+    );
+    // flag to keep track of result
+    bool success = true;
+    for(int i = 0; i < 1000; i++) {
+        const colrcv_rgb16_t expected = colrcv_lab_to_rgb16(input[i]);
+        // codes may differ by one where the exact value is almost halfway
+        success = success && (
+            abs(output[i].r - expected.r) <= 1 &&
+            abs(output[i].g - expected.g) <= 1 &&
+            abs(output[i].b - expected.b) <= 1
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the single-precision conversion functions from LAB
+ * Each should return the double-precision result rounded to float
+ */
+static colrcv_test_result_t test_colrcv_labf_conversions(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    /*
+     * rounded to single precision in a loop of their own, as GCC 12 drops
+     * the rounding when it is done in the same loop as widening them again
+     */
+    colrcv_labf_t colours[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colours[i] = (colrcv_labf_t){
+            .l = (float)SAMPLE_COLOURS[i].l,
+            .a = (float)SAMPLE_COLOURS[i].a,
+            .b = (float)SAMPLE_COLOURS[i].b,
+        };
+    }
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_labf_t colour = colours[i];
+        colrcv_lab_t widened = { .l = colour.l, .a = colour.a, .b = colour.b, };
+        colrcv_rgb_t rgb = colrcv_lab_to_rgb(widened);
+        colrcv_rgbf_t rgbf = colrcv_labf_to_rgbf(colour);
+        success = success && (
+            rgbf.r == (float)rgb.r &&
+            rgbf.g == (float)rgb.g &&
+            rgbf.b == (float)rgb.b
+        );
+        colrcv_hsv_t hsv = colrcv_lab_to_hsv(widened);
+        colrcv_hsvf_t hsvf = colrcv_labf_to_hsvf(colour);
+        success = success && (
+            hsvf.h == (float)hsv.h &&
+            hsvf.s == (float)hsv.s &&
+            hsvf.v == (float)hsv.v
+        );
+        colrcv_hsl_t hsl = colrcv_lab_to_hsl(widened);
+        colrcv_hslf_t hslf = colrcv_labf_to_hslf(colour);
+        success = success && (
+            hslf.h == (float)hsl.h &&
+            hslf.s == (float)hsl.s &&
+            hslf.l == (float)hsl.l
+        );
+        colrcv_xyz_t xyz = colrcv_lab_to_xyz(widened);
+        colrcv_xyzf_t xyzf = colrcv_labf_to_xyzf(colour);
+        success = success && (
+            xyzf.x == (float)xyz.x &&
+            xyzf.y == (float)xyz.y &&
+            xyzf.z == (float)xyz.z
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_labf_to_rgbf_soa and colrcv_labf_to_rgbf_strided
+ * Functions should return the same colours as colrcv_labf_to_rgbf does
+ */
+static colrcv_test_result_t test_colrcv_labf_to_rgbf_batch(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_labf_t samples[SAMPLE_COUNT];
+    colrcv_rgbf_t output[SAMPLE_COUNT];
+    float in_l[SAMPLE_COUNT], in_a[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    float out_r[SAMPLE_COUNT], out_g[SAMPLE_COUNT], out_b[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        samples[i] = (colrcv_labf_t){
+            .l = (float)SAMPLE_COLOURS[i].l,
+            .a = (float)SAMPLE_COLOURS[i].a,
+            .b = (float)SAMPLE_COLOURS[i].b,
+        };
+        in_l[i] = samples[i].l;
+        in_a[i] = samples[i].a;
+        in_b[i] = samples[i].b;
+    }
+    colrcv_labf_to_rgbf_soa(
+        in_l, in_a, in_b, out_r, out_g, out_b, SAMPLE_COUNT
+    );
+    colrcv_labf_to_rgbf_strided(
+        samples, sizeof(colrcv_labf_t), output, sizeof(colrcv_rgbf_t),
+        SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_rgbf_t expected = colrcv_labf_to_rgbf(samples[i]);
+        success = success && (
+            almost_equal(out_r[i], expected.r) &&
+            almost_equal(output[i].r, expected.r) &&
+            almost_equal(out_g[i], expected.g) &&
+            almost_equal(output[i].g, expected.g) &&
+            almost_equal(out_b[i], expected.b) &&
+            almost_equal(output[i].b, expected.b)
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
 int main(void) {
     // initialise test suite
     colrcv_test_suite_t suite = colrcv_init_test_suite();
@@ -706,6 +1267,20 @@ int main(void) {
     colrcv_add_test_case(test_colrcv_lab_to_hsv, &suite);
     colrcv_add_test_case(test_colrcv_lab_to_hsl, &suite);
     colrcv_add_test_case(test_colrcv_lab_to_xyz, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_rgb_soa, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_hsv_soa, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_hsl_soa, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_xyz_soa, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_rgb_strided, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_hsv_strided, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_hsl_strided, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_xyz_strided, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_rgb8, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_rgb8_strided, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_rgb16, &suite);
+    colrcv_add_test_case(test_colrcv_lab_to_rgb16_strided, &suite);
+    colrcv_add_test_case(test_colrcv_labf_conversions, &suite);
+    colrcv_add_test_case(test_colrcv_labf_to_rgbf_batch, &suite);
     // run test suite
     colrcv_run_test_suite(&suite);
     // free test suite
@@ -0,0 +1,307 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the 3D lookup table unit (lut.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+#include "support.h"
+
+#include "../colrcv/lut.h"
+#include "../colrcv/pool.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/hsl.h"
+#include "../colrcv/models/lab.h"
+#include "../colrcv/models/xyz.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// number of colours used by the accuracy tests
+#define SAMPLE_COUNT 64
+
+// fills arrays with RGB colours spread over the whole range
+static void fill_rgb_samples(double* r, double* g, double* b) {
+    for(size_t i = 0; i < SAMPLE_COUNT; i++) {
+        r[i] = (double)((i * 37) % 256);
+        g[i] = (double)((i * 101) % 256);
+        b[i] = (double)(255 - (i * 59) % 256);
+    }
+}
+
+/*
+ * Test the function colrcv_lut_build
+ * Function should reject conversions to the same model and sizes out of range
+ */
+static colrcv_test_result_t test_colrcv_lut_build_invalid(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    test.result = (
+        colrcv_lut_build(
+            COLRCV_MODEL_RGB, COLRCV_MODEL_RGB, 17, NULL
+        ) == NULL &&
+        colrcv_lut_build(
+            COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, COLRCV_LUT_MIN_SIZE - 1, NULL
+        ) == NULL &&
+        colrcv_lut_build(
+            COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, COLRCV_LUT_MAX_SIZE + 1, NULL
+        ) == NULL
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+/*
+ * Test the function colrcv_lut_apply_soa
+ * RGB->LAB through a LUT should be close to the direct conversion, with both
+ * ways of interpolating
+ */
+static colrcv_test_result_t test_colrcv_lut_apply_soa_rgb_to_lab(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double r[SAMPLE_COUNT], g[SAMPLE_COUNT], b[SAMPLE_COUNT];
+    double l[SAMPLE_COUNT], a[SAMPLE_COUNT], lab_b[SAMPLE_COUNT];
+    fill_rgb_samples(r, g, b);
+    colrcv_lut_t* lut = colrcv_lut_build(
+        COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, 65, NULL
+    );
+    bool success = lut != NULL;
+    const colrcv_lut_interpolation_t methods[2] = {
+        COLRCV_LUT_TRILINEAR, COLRCV_LUT_TETRAHEDRAL,
+    };
+    for(size_t m = 0; success && m < 2; m++) {
+        colrcv_lut_apply_soa(
+            lut, methods[m], r, g, b, l, a, lab_b, SAMPLE_COUNT
+        );
+        for(size_t i = 0; i < SAMPLE_COUNT; i++) {
+            colrcv_lab_t expected = colrcv_rgb_to_lab(
+                (colrcv_rgb_t){ .r = r[i], .g = g[i], .b = b[i], }
+            );
+            success = success && (
+                within(l[i], expected.l, 0.5) &&
+                within(a[i], expected.a, 0.5) &&
+                within(lab_b[i], expected.b, 0.5)
+            );
+        }
+    }
+    colrcv_lut_free(lut);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lut_apply_strided
+ * Colours on the grid should convert exactly as the direct conversion does,
+ * including hues, which must not be averaged the long way around
+ */
+static colrcv_test_result_t test_colrcv_lut_apply_strided_grid_points(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // a size of 18 puts grid points every 15 units of RGB
+    colrcv_lut_t* lut = colrcv_lut_build(
+        COLRCV_MODEL_RGB, COLRCV_MODEL_HSL, 18, NULL
+    );
+    colrcv_rgb_t input[3] = {
+        { .r = 255.0, .g = 0.0, .b = 15.0, },
+        { .r = 30.0, .g = 120.0, .b = 210.0, },
+        { .r = 255.0, .g = 255.0, .b = 255.0, },
+    };
+    colrcv_hsl_t output[3];
+    bool success = lut != NULL;
+    if(success) {
+        colrcv_lut_apply_strided(
+            lut, COLRCV_LUT_TETRAHEDRAL,
+            input, sizeof(colrcv_rgb_t), output, sizeof(colrcv_hsl_t), 3
+        );
+    }
+    for(size_t i = 0; success && i < 3; i++) {
+        colrcv_hsl_t expected = colrcv_rgb_to_hsl(input[i]);
+        success = (
+            within(output[i].h, expected.h, 1e-9) &&
+            within(output[i].s, expected.s, 1e-9) &&
+            within(output[i].l, expected.l, 1e-9)
+        );
+    }
+    colrcv_lut_free(lut);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lut_apply_soa
+ * Inputs outside of the range of the input model should be clamped to it
+ */
+static colrcv_test_result_t test_colrcv_lut_apply_soa_clamps(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_lut_t* lut = colrcv_lut_build(
+        COLRCV_MODEL_RGB, COLRCV_MODEL_XYZ, 5, NULL
+    );
+    double r[2] = { -50.0, 300.0, }, g[2] = { -1.0, 256.0, };
+    double b[2] = { -1000.0, 1000.0, };
+    double x[2], y[2], z[2];
+    bool success = lut != NULL;
+    if(success) {
+        colrcv_lut_apply_soa(
+            lut, COLRCV_LUT_TRILINEAR, r, g, b, x, y, z, 2
+        );
+        colrcv_xyz_t white = colrcv_rgb_to_xyz(
+            (colrcv_rgb_t){ .r = 255.0, .g = 255.0, .b = 255.0, }
+        );
+        success = (
+            within(x[0], 0.0, 1e-9) && within(y[0], 0.0, 1e-9) &&
+            within(z[0], 0.0, 1e-9) && within(x[1], white.x, 1e-9) &&
+            within(y[1], white.y, 1e-9) && within(z[1], white.z, 1e-9)
+        );
+    }
+    colrcv_lut_free(lut);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_lut_serialise and colrcv_lut_deserialise
+ * A LUT should give the same results after being serialised and loaded again,
+ * and damaged buffers should be rejected
+ */
+static colrcv_test_result_t test_colrcv_lut_serialise_round_trip(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_lut_t* lut = colrcv_lut_build(
+        COLRCV_MODEL_HSL, COLRCV_MODEL_LAB, 9, NULL
+    );
+    bool success = lut != NULL;
+    uint8_t* buffer = NULL;
+    colrcv_lut_t* loaded = NULL;
+    size_t length = 0;
+    if(success) {
+        length = colrcv_lut_serialised_size(lut);
+        buffer = malloc(length);
+        success = buffer != NULL;
+    }
+    if(success) {
+        colrcv_lut_serialise(lut, buffer);
+        loaded = colrcv_lut_deserialise(buffer, length);
+        success = (
+            loaded != NULL &&
+            colrcv_lut_get_size(loaded) == 9 &&
+            colrcv_lut_get_from(loaded) == COLRCV_MODEL_HSL &&
+            colrcv_lut_get_to(loaded) == COLRCV_MODEL_LAB
+        );
+    }
+    if(success) {
+        double h[2] = { 10.0, 200.0, }, s[2] = { 0.3, 0.9, };
+        double l[2] = { 0.2, 0.6, };
+        double expected[3][2], actual[3][2];
+        colrcv_lut_apply_soa(
+            lut, COLRCV_LUT_TRILINEAR, h, s, l,
+            expected[0], expected[1], expected[2], 2
+        );
+        colrcv_lut_apply_soa(
+            loaded, COLRCV_LUT_TRILINEAR, h, s, l,
+            actual[0], actual[1], actual[2], 2
+        );
+        for(size_t ch = 0; ch < 3; ch++) {
+            for(size_t i = 0; i < 2; i++) {
+                success = success && (actual[ch][i] == expected[ch][i]);
+            }
+        }
+        // a truncated buffer or the wrong magic number should be rejected
+        success = success && (
+            colrcv_lut_deserialise(buffer, length - 1) == NULL
+        );
+        buffer[0] = 'X';
+        success = success && colrcv_lut_deserialise(buffer, length) == NULL;
+    }
+    colrcv_lut_free(loaded);
+    colrcv_lut_free(lut);
+    free(buffer);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_lut_build
+ * A LUT built with the threads of a pool should be exactly the same as one
+ * built on the calling thread
+ */
+static colrcv_test_result_t test_colrcv_lut_build_pool(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_pool_t* pool = colrcv_pool_create(4);
+    colrcv_lut_t* serial = colrcv_lut_build(
+        COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, 33, NULL
+    );
+    colrcv_lut_t* parallel = colrcv_lut_build(
+        COLRCV_MODEL_RGB, COLRCV_MODEL_LAB, 33, pool
+    );
+    bool success = pool != NULL && serial != NULL && parallel != NULL;
+    uint8_t* expected = NULL;
+    uint8_t* actual = NULL;
+    size_t length = 0;
+    if(success) {
+        length = colrcv_lut_serialised_size(serial);
+        expected = malloc(length);
+        actual = malloc(length);
+        success = (
+            expected != NULL && actual != NULL &&
+            colrcv_lut_serialised_size(parallel) == length
+        );
+    }
+    if(success) {
+        colrcv_lut_serialise(serial, expected);
+        colrcv_lut_serialise(parallel, actual);
+        success = memcmp(expected, actual, length) == 0;
+    }
+    free(actual);
+    free(expected);
+    colrcv_lut_free(parallel);
+    colrcv_lut_free(serial);
+    if(pool != NULL) {
+        colrcv_pool_free(pool);
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_lut_build_invalid, &suite);
+    colrcv_add_test_case(test_colrcv_lut_build_pool, &suite);
+    colrcv_add_test_case(test_colrcv_lut_apply_soa_rgb_to_lab, &suite);
+    colrcv_add_test_case(test_colrcv_lut_apply_strided_grid_points, &suite);
+    colrcv_add_test_case(test_colrcv_lut_apply_soa_clamps, &suite);
+    colrcv_add_test_case(test_colrcv_lut_serialise_round_trip, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
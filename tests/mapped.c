@@ -0,0 +1,236 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the memory-mapped raw file unit (mapped.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for mkstemp() when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../unit_test_harness/harness.h"
+#include "support.h"
+
+#include "../colrcv/mapped.h"
+#include "../colrcv/pool.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/lab.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// more pixels than are mapped at a time with 4KiB pages, and not a multiple
+#define PIXEL_COUNT 1100003
+
+// relative tolerance of a float result, as close to a double as a float can be
+#define FLOAT_TOLERANCE 1e-5
+
+// paths of the temporary files made for each test
+static char input_path[] = "colrcv_mapped_input_XXXXXX";
+static char output_path[] = "colrcv_mapped_output_XXXXXX";
+
+/*
+ * makes a temporary file from one of the template paths, holding `size` bytes
+ * of `data`
+ */
+static bool make_file(char* path, const void* data, size_t size) {
+    // the template is filled in by each call, so reset it first
+    memcpy(path + strlen(path) - 6, "XXXXXX", 6);
+    const int descriptor = mkstemp(path);
+    if(descriptor == -1) {
+        return false;
+    }
+    close(descriptor);
+    FILE* file = fopen(path, "wb");
+    if(file == NULL) {
+        return false;
+    }
+    const bool written = fwrite(data, 1, size, file) == size;
+    return (fclose(file) == 0) && written;
+}
+
+// reads a whole file of `count` floats, returning NULL if it's not that size
+static float* read_floats(const char* path, size_t count) {
+    FILE* file = fopen(path, "rb");
+    float* floats = malloc(count * sizeof(float) + 1);
+    if(file == NULL || floats == NULL) {
+        free(floats);
+        floats = NULL;
+    } else if(
+        fread(floats, sizeof(float), count, file) != count ||
+        fgetc(file) != EOF
+    ) {
+        free(floats);
+        floats = NULL;
+    }
+    if(file != NULL) {
+        fclose(file);
+    }
+    return floats;
+}
+
+/*
+ * Test the function colrcv_raw_convert_file
+ * A file of 8-bit RGB pixels too big to map at once should convert to the
+ * same LAB colours as converting each pixel directly
+ */
+static colrcv_test_result_t test_colrcv_raw_convert_file_rgb8_to_lab(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint8_t* pixels = malloc(PIXEL_COUNT * 3);
+    float* output = NULL;
+    colrcv_pool_t* pool = colrcv_pool_create(3);
+    bool success = pixels != NULL && pool != NULL;
+    for(size_t i = 0; success && i < PIXEL_COUNT * 3; i++) {
+        pixels[i] = (uint8_t)(i * 37 + i / 7);
+    }
+    success = success && make_file(input_path, pixels, PIXEL_COUNT * 3);
+    success = success && make_file(output_path, "", 0);
+    success = success && colrcv_raw_convert_file(
+        input_path, COLRCV_RAW_RGB8, COLRCV_MODEL_RGB,
+        output_path, COLRCV_MODEL_LAB, pool
+    );
+    if(success) {
+        output = read_floats(output_path, PIXEL_COUNT * 3);
+        success = output != NULL;
+    }
+    // checking every 7th pixel is plenty, and much quicker
+    for(size_t i = 0; success && i < PIXEL_COUNT; i += 7) {
+        colrcv_lab_t expected = colrcv_rgb_to_lab(
+            (colrcv_rgb_t){
+                .r = pixels[i * 3], .g = pixels[i * 3 + 1],
+                .b = pixels[i * 3 + 2],
+            }
+        );
+        success = (
+            relatively_close(output[i * 3], expected.l, FLOAT_TOLERANCE) &&
+            relatively_close(output[i * 3 + 1], expected.a, FLOAT_TOLERANCE) &&
+            relatively_close(output[i * 3 + 2], expected.b, FLOAT_TOLERANCE)
+        );
+    }
+    remove(input_path);
+    remove(output_path);
+    colrcv_pool_free(pool);
+    free(output);
+    free(pixels);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_raw_convert_file
+ * A file of LAB floats should convert to RGB floats, and converting to the
+ * same model should copy the file
+ */
+static colrcv_test_result_t test_colrcv_raw_convert_file_float(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_labf_t input[3] = {
+        { .l = 50.0f, .a = 20.0f, .b = -30.0f, },
+        { .l = 0.0f, .a = 0.0f, .b = 0.0f, },
+        { .l = 90.0f, .a = -10.0f, .b = 5.0f, },
+    };
+    float* output = NULL;
+    bool success = make_file(input_path, input, sizeof(input));
+    success = success && make_file(output_path, "", 0);
+    success = success && colrcv_raw_convert_file(
+        input_path, COLRCV_RAW_FLOAT, COLRCV_MODEL_LAB,
+        output_path, COLRCV_MODEL_RGB, NULL
+    );
+    if(success) {
+        output = read_floats(output_path, 9);
+        success = output != NULL;
+    }
+    for(size_t i = 0; success && i < 3; i++) {
+        colrcv_rgb_t expected = colrcv_lab_to_rgb(
+            (colrcv_lab_t){
+                .l = input[i].l, .a = input[i].a, .b = input[i].b,
+            }
+        );
+        success = (
+            relatively_close(output[i * 3], expected.r, FLOAT_TOLERANCE) &&
+            relatively_close(output[i * 3 + 1], expected.g, FLOAT_TOLERANCE) &&
+            relatively_close(output[i * 3 + 2], expected.b, FLOAT_TOLERANCE)
+        );
+    }
+    free(output);
+    output = NULL;
+    success = success && colrcv_raw_convert_file(
+        input_path, COLRCV_RAW_FLOAT, COLRCV_MODEL_LAB,
+        output_path, COLRCV_MODEL_LAB, NULL
+    );
+    if(success) {
+        output = read_floats(output_path, 9);
+        success = output != NULL && output[0] == 50.0f && output[8] == 5.0f;
+    }
+    remove(input_path);
+    remove(output_path);
+    free(output);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_raw_convert_file
+ * Files which aren't a whole number of pixels, 8-bit files of models other
+ * than RGB and missing files should be rejected
+ */
+static colrcv_test_result_t test_colrcv_raw_convert_file_invalid(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const uint8_t pixels[4] = { 1, 2, 3, 4, };
+    bool success = make_file(input_path, pixels, sizeof(pixels));
+    success = success && make_file(output_path, "", 0);
+    success = success && !colrcv_raw_convert_file(
+        input_path, COLRCV_RAW_RGB8, COLRCV_MODEL_RGB,
+        output_path, COLRCV_MODEL_LAB, NULL
+    ) && !colrcv_raw_convert_file(
+        input_path, COLRCV_RAW_RGB8, COLRCV_MODEL_HSV,
+        output_path, COLRCV_MODEL_LAB, NULL
+    );
+    remove(input_path);
+    success = success && !colrcv_raw_convert_file(
+        input_path, COLRCV_RAW_FLOAT, COLRCV_MODEL_LAB,
+        output_path, COLRCV_MODEL_RGB, NULL
+    );
+    remove(output_path);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_raw_convert_file_rgb8_to_lab, &suite);
+    colrcv_add_test_case(test_colrcv_raw_convert_file_float, &suite);
+    colrcv_add_test_case(test_colrcv_raw_convert_file_invalid, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,284 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the PPM and PAM image unit (netpbm.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+#include "support.h"
+
+#include "../colrcv/netpbm.h"
+#include "../colrcv/pool.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/lab.h"
+#include "../colrcv/models/xyz.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the size of the images used by the tests
+#define WIDTH 5
+#define HEIGHT 7
+#define PIXEL_COUNT (WIDTH * HEIGHT)
+
+// relative tolerance of a float result, as close to a double as a float can be
+#define FLOAT_TOLERANCE 1e-5
+
+// gets channel `ch` of pixel `i` of the test images, from 0 to 255
+static unsigned int get_test_channel(size_t i, size_t ch) {
+    const size_t multipliers[3] = { 37, 101, 59, };
+    return (unsigned int)((i * multipliers[ch] + ch * 80) % 256);
+}
+
+// makes a temporary file holding a header followed by pixels
+static FILE* make_image(
+    const char* header, const uint8_t* pixels, size_t size
+) {
+    FILE* file = tmpfile();
+    if(file != NULL) {
+        fputs(header, file);
+        fwrite(pixels, 1, size, file);
+        rewind(file);
+    }
+    return file;
+}
+
+/*
+ * reads the planes written by colrcv_netpbm_convert() back, returning false
+ * if they are not all there
+ */
+static bool read_planes(FILE* file, float planes[3][PIXEL_COUNT]) {
+    rewind(file);
+    bool success = fread(planes, sizeof(float), 3 * PIXEL_COUNT, file) == (
+        3 * PIXEL_COUNT
+    );
+    // there should be nothing more
+    return success && fgetc(file) == EOF;
+}
+
+/*
+ * Test the function colrcv_netpbm_convert
+ * An 8-bit PPM image with comments in its header should convert to the same
+ * LAB colours as converting each pixel directly, with blocks that don't divide
+ * the height exactly
+ */
+static colrcv_test_result_t test_colrcv_netpbm_convert_ppm_to_lab(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint8_t pixels[PIXEL_COUNT * 3];
+    for(size_t i = 0; i < PIXEL_COUNT; i++) {
+        for(size_t ch = 0; ch < 3; ch++) {
+            pixels[i * 3 + ch] = (uint8_t)get_test_channel(i, ch);
+        }
+    }
+    FILE* input = make_image(
+        "P6\n# a comment\n5 7\n# another\n255\n", pixels, sizeof(pixels)
+    );
+    FILE* output = tmpfile();
+    float planes[3][PIXEL_COUNT];
+    colrcv_netpbm_info_t info;
+    bool success = input != NULL && output != NULL && colrcv_netpbm_convert(
+        input, output, COLRCV_MODEL_LAB, 3, NULL, &info
+    ) == COLRCV_NETPBM_OK && read_planes(output, planes) && (
+        info.width == WIDTH && info.height == HEIGHT &&
+        info.depth == 3 && info.maxval == 255
+    );
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_rgb_to_lab(
+            (colrcv_rgb_t){
+                .r = pixels[i * 3], .g = pixels[i * 3 + 1],
+                .b = pixels[i * 3 + 2],
+            }
+        );
+        success = (
+            relatively_close(planes[0][i], expected.l, FLOAT_TOLERANCE) &&
+            relatively_close(planes[1][i], expected.a, FLOAT_TOLERANCE) &&
+            relatively_close(planes[2][i], expected.b, FLOAT_TOLERANCE)
+        );
+    }
+    if(input != NULL) {
+        fclose(input);
+    }
+    if(output != NULL) {
+        fclose(output);
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_netpbm_convert
+ * A 16-bit PAM image with alpha should convert to the same XYZ colours as
+ * converting each pixel directly, ignoring alpha, when converting on a pool
+ */
+static colrcv_test_result_t test_colrcv_netpbm_convert_pam16_to_xyz(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint8_t pixels[PIXEL_COUNT * 4 * 2];
+    for(size_t i = 0; i < PIXEL_COUNT; i++) {
+        for(size_t ch = 0; ch < 4; ch++) {
+            // big-endian samples, from 0 to 1000
+            const unsigned int sample = (ch == 3)
+                ? 500
+                : get_test_channel(i, ch) * 1000 / 255;
+            pixels[(i * 4 + ch) * 2] = (uint8_t)(sample >> 8);
+            pixels[(i * 4 + ch) * 2 + 1] = (uint8_t)(sample & 0xFF);
+        }
+    }
+    FILE* input = make_image(
+        "P7\nWIDTH 5\nHEIGHT 7\nDEPTH 4\nMAXVAL 1000\n"
+        "TUPLTYPE RGB_ALPHA\nENDHDR\n",
+        pixels, sizeof(pixels)
+    );
+    FILE* output = tmpfile();
+    colrcv_pool_t* pool = colrcv_pool_create(2);
+    float planes[3][PIXEL_COUNT];
+    bool success = input != NULL && output != NULL && colrcv_netpbm_convert(
+        input, output, COLRCV_MODEL_XYZ, 0, pool, NULL
+    ) == COLRCV_NETPBM_OK && read_planes(output, planes);
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        double rgb[3];
+        for(size_t ch = 0; ch < 3; ch++) {
+            rgb[ch] = (get_test_channel(i, ch) * 1000 / 255) * 255.0 / 1000.0;
+        }
+        colrcv_xyz_t expected = colrcv_rgb_to_xyz(
+            (colrcv_rgb_t){ .r = rgb[0], .g = rgb[1], .b = rgb[2], }
+        );
+        success = (
+            relatively_close(planes[0][i], expected.x, FLOAT_TOLERANCE) &&
+            relatively_close(planes[1][i], expected.y, FLOAT_TOLERANCE) &&
+            relatively_close(planes[2][i], expected.z, FLOAT_TOLERANCE)
+        );
+    }
+    colrcv_pool_free(pool);
+    if(input != NULL) {
+        fclose(input);
+    }
+    if(output != NULL) {
+        fclose(output);
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_netpbm_convert
+ * A greyscale PAM image should have its one channel used for red, green and
+ * blue when converting to RGB
+ */
+static colrcv_test_result_t test_colrcv_netpbm_convert_greyscale(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint8_t pixels[PIXEL_COUNT];
+    for(size_t i = 0; i < PIXEL_COUNT; i++) {
+        pixels[i] = (uint8_t)(i * 3);
+    }
+    FILE* input = make_image(
+        "P7\nWIDTH 5\nHEIGHT 7\nDEPTH 1\nMAXVAL 255\n"
+        "TUPLTYPE GRAYSCALE\nENDHDR\n",
+        pixels, sizeof(pixels)
+    );
+    FILE* output = tmpfile();
+    float planes[3][PIXEL_COUNT];
+    bool success = input != NULL && output != NULL && colrcv_netpbm_convert(
+        input, output, COLRCV_MODEL_RGB, 1, NULL, NULL
+    ) == COLRCV_NETPBM_OK && read_planes(output, planes);
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        success = (
+            planes[0][i] == pixels[i] && planes[1][i] == pixels[i] &&
+            planes[2][i] == pixels[i]
+        );
+    }
+    if(input != NULL) {
+        fclose(input);
+    }
+    if(output != NULL) {
+        fclose(output);
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+// converts an image to LAB, giving the result of doing so
+static colrcv_netpbm_status_t try_convert(
+    const char* header, const uint8_t* pixels, size_t size
+) {
+    FILE* input = make_image(header, pixels, size);
+    FILE* output = tmpfile();
+    colrcv_netpbm_status_t status = COLRCV_NETPBM_READ_ERROR;
+    if(input != NULL && output != NULL) {
+        status = colrcv_netpbm_convert(
+            input, output, COLRCV_MODEL_LAB, 0, NULL, NULL
+        );
+    }
+    if(input != NULL) {
+        fclose(input);
+    }
+    if(output != NULL) {
+        fclose(output);
+    }
+    return status;
+}
+
+/*
+ * Test the function colrcv_netpbm_convert
+ * Bad headers, unsupported images and images that end early should be
+ * reported
+ */
+static colrcv_test_result_t test_colrcv_netpbm_convert_errors(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const uint8_t pixels[12] = { 0, };
+
+    test.result = (
+        try_convert("P3\n2 2\n255\n", pixels, 12) == COLRCV_NETPBM_BAD_HEADER &&
+        try_convert("P6\n2 0\n255\n", pixels, 12) == COLRCV_NETPBM_BAD_HEADER &&
+        try_convert(
+            "P6\n2 2\n70000\n", pixels, 12
+        ) == COLRCV_NETPBM_BAD_HEADER &&
+        try_convert(
+            "P7\nWIDTH 1\nHEIGHT 1\nDEPTH 5\nMAXVAL 255\nENDHDR\n", pixels, 5
+        ) == COLRCV_NETPBM_UNSUPPORTED &&
+        try_convert("P6\n2 2\n255\n", pixels, 11) == COLRCV_NETPBM_READ_ERROR &&
+        try_convert("P6\n2 2\n255\n", pixels, 12) == COLRCV_NETPBM_OK
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_netpbm_convert_ppm_to_lab, &suite);
+    colrcv_add_test_case(test_colrcv_netpbm_convert_pam16_to_xyz, &suite);
+    colrcv_add_test_case(test_colrcv_netpbm_convert_greyscale, &suite);
+    colrcv_add_test_case(test_colrcv_netpbm_convert_errors, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
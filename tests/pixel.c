@@ -0,0 +1,326 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the packed pixel format unit (pixel.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+#include "support.h"
+
+#include "../colrcv/pixel.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/lab.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// number of pixels used by the round trip tests, more than one tile
+#define PIXEL_COUNT 300
+
+/*
+ * Test the function colrcv_pixel_format_size
+ * Function should give the size of each format, and 0 for invalid formats
+ */
+static colrcv_test_result_t test_colrcv_pixel_format_size(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    test.result = (
+        colrcv_pixel_format_size(COLRCV_PIXEL_RGBA8888) == 4 &&
+        colrcv_pixel_format_size(COLRCV_PIXEL_BGRA8888) == 4 &&
+        colrcv_pixel_format_size(COLRCV_PIXEL_RGB565) == 2 &&
+        colrcv_pixel_format_size(COLRCV_PIXEL_RGB10A2) == 4 &&
+        colrcv_pixel_format_size(
+            (colrcv_pixel_format_t)COLRCV_PIXEL_FORMAT_COUNT
+        ) == 0
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+/*
+ * Test the function colrcv_pixels_to_soa
+ * Each format should be unpacked to RGB scaled to 0 -> 255 and alpha scaled to
+ * 0 -> 1
+ */
+static colrcv_test_result_t test_colrcv_pixels_to_soa_rgb(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const uint8_t rgba[4] = { 10, 20, 30, 51, };
+    const uint8_t bgra[4] = { 30, 20, 10, 51, };
+    // pure red and pure blue
+    const uint16_t rgb565[2] = { 0xF800, 0x001F, };
+    // red of 1023, green of 0, blue of 341 and alpha of 2
+    const uint32_t rgb10a2[1] = { 1023u | (341u << 20) | (2u << 30), };
+    double r[2], g[2], b[2], alpha[2];
+    bool success = colrcv_pixels_to_soa(
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_STRAIGHT, rgba,
+        COLRCV_MODEL_RGB, r, g, b, alpha, 1
+    ) && (
+        r[0] == 10.0 && g[0] == 20.0 && b[0] == 30.0 &&
+        within(alpha[0], 0.2, 1e-12)
+    );
+    success = success && colrcv_pixels_to_soa(
+        COLRCV_PIXEL_BGRA8888, COLRCV_ALPHA_STRAIGHT, bgra,
+        COLRCV_MODEL_RGB, r, g, b, alpha, 1
+    ) && (
+        r[0] == 10.0 && g[0] == 20.0 && b[0] == 30.0 &&
+        within(alpha[0], 0.2, 1e-12)
+    );
+    success = success && colrcv_pixels_to_soa(
+        COLRCV_PIXEL_RGB565, COLRCV_ALPHA_STRAIGHT, rgb565,
+        COLRCV_MODEL_RGB, r, g, b, alpha, 2
+    ) && (
+        r[0] == 255.0 && g[0] == 0.0 && b[0] == 0.0 && alpha[0] == 1.0 &&
+        r[1] == 0.0 && g[1] == 0.0 && b[1] == 255.0 && alpha[1] == 1.0
+    );
+    success = success && colrcv_pixels_to_soa(
+        COLRCV_PIXEL_RGB10A2, COLRCV_ALPHA_STRAIGHT, rgb10a2,
+        COLRCV_MODEL_RGB, r, g, b, alpha, 1
+    ) && (
+        r[0] == 255.0 && g[0] == 0.0 && within(b[0], 85.0, 1e-9) &&
+        within(alpha[0], 2.0 / 3.0, 1e-12)
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_pixels_to_soa and colrcv_pixels_to_strided
+ * Pixels converted to LAB should match converting their RGB values directly
+ */
+static colrcv_test_result_t test_colrcv_pixels_to_lab(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint8_t pixels[PIXEL_COUNT][4];
+    for(size_t i = 0; i < PIXEL_COUNT; i++) {
+        pixels[i][0] = (uint8_t)(i * 37);
+        pixels[i][1] = (uint8_t)(i * 101);
+        pixels[i][2] = (uint8_t)(255 - i * 59);
+        pixels[i][3] = (uint8_t)i;
+    }
+    double l[PIXEL_COUNT], a[PIXEL_COUNT], lab_b[PIXEL_COUNT];
+    colrcv_lab_t lab[PIXEL_COUNT];
+    bool success = colrcv_pixels_to_soa(
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_STRAIGHT, pixels,
+        COLRCV_MODEL_LAB, l, a, lab_b, NULL, PIXEL_COUNT
+    ) && colrcv_pixels_to_strided(
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_STRAIGHT, pixels,
+        COLRCV_MODEL_LAB, lab, sizeof(colrcv_lab_t), NULL, PIXEL_COUNT
+    );
+    for(size_t i = 0; success && i < PIXEL_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_rgb_to_lab(
+            (colrcv_rgb_t){
+                .r = pixels[i][0], .g = pixels[i][1], .b = pixels[i][2],
+            }
+        );
+        success = (
+            within(l[i], expected.l, 1e-9) &&
+            within(a[i], expected.a, 1e-9) &&
+            within(lab_b[i], expected.b, 1e-9) &&
+            within(lab[i].l, expected.l, 1e-9) &&
+            within(lab[i].a, expected.a, 1e-9) &&
+            within(lab[i].b, expected.b, 1e-9)
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_pixels_to_soa and colrcv_soa_to_pixels
+ * Pixels of every format should survive a round trip through LAB unchanged,
+ * with alpha passed through
+ */
+static colrcv_test_result_t test_colrcv_pixels_round_trip(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_pixel_format_t formats[COLRCV_PIXEL_FORMAT_COUNT] = {
+        COLRCV_PIXEL_RGBA8888, COLRCV_PIXEL_BGRA8888,
+        COLRCV_PIXEL_RGB565, COLRCV_PIXEL_RGB10A2,
+    };
+    // uint32_t keeps the pixels aligned for every format
+    uint32_t input[PIXEL_COUNT], output[PIXEL_COUNT];
+    double l[PIXEL_COUNT], a[PIXEL_COUNT], b[PIXEL_COUNT];
+    double alpha[PIXEL_COUNT];
+    bool success = true;
+    for(size_t f = 0; success && f < COLRCV_PIXEL_FORMAT_COUNT; f++) {
+        const size_t size = colrcv_pixel_format_size(formats[f]);
+        // fill the pixels with an arbitrary pattern of bytes
+        uint8_t* bytes = (uint8_t*)input;
+        for(size_t i = 0; i < PIXEL_COUNT * size; i++) {
+            bytes[i] = (uint8_t)(i * 97 + 13);
+        }
+        success = colrcv_pixels_to_soa(
+            formats[f], COLRCV_ALPHA_STRAIGHT, input,
+            COLRCV_MODEL_LAB, l, a, b, alpha, PIXEL_COUNT
+        ) && colrcv_soa_to_pixels(
+            COLRCV_MODEL_LAB, l, a, b, alpha,
+            formats[f], COLRCV_ALPHA_STRAIGHT, output, PIXEL_COUNT
+        ) && memcmp(input, output, PIXEL_COUNT * size) == 0;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_pixels_to_soa and colrcv_soa_to_pixels
+ * Premultiplied colour should be divided by alpha when read and multiplied by
+ * it again when written, giving back the same pixels
+ */
+static colrcv_test_result_t test_colrcv_pixels_premultiplied(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // half-transparent red of 50, fully transparent and opaque pixels
+    const uint8_t input[3][4] = {
+        { 50, 0, 25, 128, }, { 0, 0, 0, 0, }, { 200, 100, 0, 255, },
+    };
+    uint8_t output[3][4];
+    double r[3], g[3], b[3], alpha[3];
+    bool success = colrcv_pixels_to_soa(
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_PREMULTIPLIED, input,
+        COLRCV_MODEL_RGB, r, g, b, alpha, 3
+    ) && (
+        within(r[0], 50.0 * 255.0 / 128.0, 1e-9) &&
+        within(b[0], 25.0 * 255.0 / 128.0, 1e-9) &&
+        r[1] == 0.0 && g[1] == 0.0 && b[1] == 0.0 && alpha[1] == 0.0 &&
+        r[2] == 200.0 && g[2] == 100.0 && alpha[2] == 1.0
+    ) && colrcv_soa_to_pixels(
+        COLRCV_MODEL_RGB, r, g, b, alpha,
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_PREMULTIPLIED, output, 3
+    ) && memcmp(input, output, sizeof(input)) == 0;
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_strided_to_pixels
+ * Colours out of the range of RGB should be clamped, and pixels should be
+ * opaque when no alpha is given
+ */
+static colrcv_test_result_t test_colrcv_strided_to_pixels_clamps(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_rgb_t input[2] = {
+        { .r = -20.0, .g = 300.0, .b = 127.6, },
+        { .r = 255.0, .g = 0.0, .b = 0.0, },
+    };
+    uint32_t rgb10a2[2];
+    uint8_t bgra[2][4];
+    bool success = colrcv_strided_to_pixels(
+        COLRCV_MODEL_RGB, input, sizeof(colrcv_rgb_t), NULL,
+        COLRCV_PIXEL_BGRA8888, COLRCV_ALPHA_STRAIGHT, bgra, 2
+    ) && colrcv_strided_to_pixels(
+        COLRCV_MODEL_RGB, input, sizeof(colrcv_rgb_t), NULL,
+        COLRCV_PIXEL_RGB10A2, COLRCV_ALPHA_STRAIGHT, rgb10a2, 2
+    );
+    success = success && (
+        bgra[0][0] == 128 && bgra[0][1] == 255 && bgra[0][2] == 0 &&
+        bgra[0][3] == 255 && bgra[1][2] == 255 && bgra[1][3] == 255 &&
+        rgb10a2[1] == (1023u | (3u << 30))
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_soa_to_pixels
+ * NaN channels and alphas should be written as 0, in every channel width
+ */
+static colrcv_test_result_t test_colrcv_soa_to_pixels_nan(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const double r[2] = { NAN, 255.0, };
+    const double g[2] = { 0.0, NAN, };
+    const double b[2] = { 255.0, 0.0, };
+    const double alpha[2] = { 1.0, NAN, };
+    uint8_t rgba[2][4];
+    uint32_t rgb10a2[2];
+    bool success = colrcv_soa_to_pixels(
+        COLRCV_MODEL_RGB, r, g, b, alpha,
+        COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_STRAIGHT, rgba, 2
+    ) && colrcv_soa_to_pixels(
+        COLRCV_MODEL_RGB, r, g, b, NULL,
+        COLRCV_PIXEL_RGB10A2, COLRCV_ALPHA_STRAIGHT, rgb10a2, 2
+    );
+    success = success && (
+        rgba[0][0] == 0 && rgba[0][2] == 255 && rgba[0][3] == 255 &&
+        rgba[1][0] == 255 && rgba[1][1] == 0 && rgba[1][3] == 0 &&
+        rgb10a2[0] == (1023u << 20 | 3u << 30) &&
+        rgb10a2[1] == (1023u | 3u << 30)
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_pixels_to_soa and colrcv_soa_to_pixels
+ * Invalid formats, alpha modes and models should be rejected
+ */
+static colrcv_test_result_t test_colrcv_pixels_invalid(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    uint8_t pixel[4] = { 0, 0, 0, 0, };
+    double a[1], b[1], c[1];
+
+    test.result = (
+        !colrcv_pixels_to_soa(
+            (colrcv_pixel_format_t)COLRCV_PIXEL_FORMAT_COUNT,
+            COLRCV_ALPHA_STRAIGHT, pixel, COLRCV_MODEL_LAB, a, b, c, NULL, 1
+        ) &&
+        !colrcv_pixels_to_soa(
+            COLRCV_PIXEL_RGBA8888, (colrcv_alpha_mode_t)2,
+            pixel, COLRCV_MODEL_LAB, a, b, c, NULL, 1
+        ) &&
+        !colrcv_soa_to_pixels(
+            (colrcv_model_t)COLRCV_MODEL_COUNT, a, b, c, NULL,
+            COLRCV_PIXEL_RGBA8888, COLRCV_ALPHA_STRAIGHT, pixel, 1
+        )
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_pixel_format_size, &suite);
+    colrcv_add_test_case(test_colrcv_pixels_to_soa_rgb, &suite);
+    colrcv_add_test_case(test_colrcv_pixels_to_lab, &suite);
+    colrcv_add_test_case(test_colrcv_pixels_round_trip, &suite);
+    colrcv_add_test_case(test_colrcv_pixels_premultiplied, &suite);
+    colrcv_add_test_case(test_colrcv_strided_to_pixels_clamps, &suite);
+    colrcv_add_test_case(test_colrcv_soa_to_pixels_nan, &suite);
+    colrcv_add_test_case(test_colrcv_pixels_invalid, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,302 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the thread pool unit (pool.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+
+#include "../colrcv/colrcv.h"
+#include "../colrcv/pool.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/lab.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// number of colours converted, many tiles and not a whole number of them
+#define COLOUR_COUNT 10007
+
+// the thread counts that each conversion is tried with
+static const size_t THREAD_COUNTS[] = { 1, 2, 3, 8, };
+#define THREAD_COUNTS_SIZE (sizeof(THREAD_COUNTS) / sizeof(THREAD_COUNTS[0]))
+
+static double r[COLOUR_COUNT], g[COLOUR_COUNT], b[COLOUR_COUNT];
+static double expected[3][COLOUR_COUNT], actual[3][COLOUR_COUNT];
+static colrcv_rgb_t rgb[COLOUR_COUNT];
+static colrcv_lab_t lab[COLOUR_COUNT];
+
+// fills the input arrays with RGB colours spread over the whole range
+static void fill_rgb_samples(void) {
+    for(size_t i = 0; i < COLOUR_COUNT; i++) {
+        r[i] = (double)((i * 37) % 256);
+        g[i] = (double)((i * 101) % 256);
+        b[i] = (double)(255 - (i * 59) % 256);
+        rgb[i] = (colrcv_rgb_t){ .r = r[i], .g = g[i], .b = b[i], };
+    }
+}
+
+// checks that the actual results are bit-for-bit the same as those expected
+static bool results_match(void) {
+    return memcmp(actual, expected, sizeof(expected)) == 0;
+}
+
+/*
+ * Test the function colrcv_pool_create
+ * Pools should have the number of threads asked for, or at least one if 0 is
+ * asked for
+ */
+static colrcv_test_result_t test_colrcv_pool_create(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_pool_t* three = colrcv_pool_create(3);
+    colrcv_pool_t* cores = colrcv_pool_create(0);
+
+    test.result = (
+        three != NULL && cores != NULL &&
+        colrcv_pool_get_thread_count(three) == 3 &&
+        colrcv_pool_get_thread_count(cores) >= 1
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    colrcv_pool_free(three);
+    colrcv_pool_free(cores);
+    // freeing NULL should do nothing
+    colrcv_pool_free(NULL);
+    return test;
+}
+
+/*
+ * Test the function colrcv_pool_convert_soa
+ * Results should be exactly the same as converting on one thread, with any
+ * number of threads and in both accuracy modes
+ */
+static colrcv_test_result_t test_colrcv_pool_convert_soa_deterministic(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_accuracy_t modes[2] = {
+        COLRCV_ACCURACY_EXACT, COLRCV_ACCURACY_FAST,
+    };
+    bool success = true;
+    fill_rgb_samples();
+    for(size_t m = 0; m < 2; m++) {
+        colrcv_set_accuracy(modes[m]);
+        colrcv_rgb_to_lab_soa(
+            r, g, b, expected[0], expected[1], expected[2], COLOUR_COUNT
+        );
+        for(size_t t = 0; t < THREAD_COUNTS_SIZE; t++) {
+            colrcv_pool_t* pool = colrcv_pool_create(THREAD_COUNTS[t]);
+            // convert twice, to check that the pool can be reused
+            for(size_t repeat = 0; repeat < 2; repeat++) {
+                memset(actual, 0, sizeof(actual));
+                colrcv_pool_convert_soa(
+                    pool, colrcv_rgb_to_lab_soa, r, g, b,
+                    actual[0], actual[1], actual[2], COLOUR_COUNT
+                );
+                success = success && pool != NULL && results_match();
+            }
+            colrcv_pool_free(pool);
+        }
+    }
+    colrcv_set_accuracy(COLRCV_ACCURACY_EXACT);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_pool_convert_strided
+ * Results should be the same as the strided conversion on one thread,
+ * including when converting in-place
+ */
+static colrcv_test_result_t test_colrcv_pool_convert_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    fill_rgb_samples();
+    colrcv_rgb_to_lab_strided(
+        rgb, sizeof(colrcv_rgb_t), lab, sizeof(colrcv_lab_t), COLOUR_COUNT
+    );
+    colrcv_pool_t* pool = colrcv_pool_create(4);
+    // convert the RGB colours to LAB in-place
+    colrcv_pool_convert_strided(
+        pool, colrcv_rgb_to_lab_soa,
+        rgb, sizeof(colrcv_rgb_t), rgb, sizeof(colrcv_rgb_t), COLOUR_COUNT
+    );
+    bool success = pool != NULL;
+    for(size_t i = 0; success && i < COLOUR_COUNT; i++) {
+        success = (
+            rgb[i].r == lab[i].l && rgb[i].g == lab[i].a && rgb[i].b == lab[i].b
+        );
+    }
+    colrcv_pool_free(pool);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_pool_convert
+ * Function should convert between models, without a pool and with one, and
+ * reject conversions between the same model
+ */
+static colrcv_test_result_t test_colrcv_pool_convert(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    fill_rgb_samples();
+    colrcv_rgb_to_hsv_soa(
+        r, g, b, expected[0], expected[1], expected[2], COLOUR_COUNT
+    );
+    colrcv_pool_t* pool = colrcv_pool_create(2);
+    bool success = pool != NULL && colrcv_pool_convert(
+        NULL, COLRCV_MODEL_RGB, COLRCV_MODEL_HSV, r, g, b,
+        actual[0], actual[1], actual[2], COLOUR_COUNT
+    ) && results_match();
+    memset(actual, 0, sizeof(actual));
+    success = success && colrcv_pool_convert(
+        pool, COLRCV_MODEL_RGB, COLRCV_MODEL_HSV, r, g, b,
+        actual[0], actual[1], actual[2], COLOUR_COUNT
+    ) && results_match();
+    success = success && !colrcv_pool_convert(
+        pool, COLRCV_MODEL_RGB, COLRCV_MODEL_RGB, r, g, b,
+        actual[0], actual[1], actual[2], COLOUR_COUNT
+    );
+    colrcv_pool_free(pool);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+// marks each index of the range it is called with in the array it's given
+static void mark_range(void* context, size_t start, size_t end) {
+    double* marks = context;
+    for(size_t i = start; i < end; i++) {
+        marks[i] += 1.0;
+    }
+}
+
+/*
+ * Test the function colrcv_pool_for
+ * Every index should be done exactly once, with and without a pool
+ */
+static colrcv_test_result_t test_colrcv_pool_for(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_pool_t* pool = colrcv_pool_create(4);
+    bool success = pool != NULL;
+    memset(actual, 0, sizeof(actual));
+    colrcv_pool_for(pool, mark_range, actual[0], COLOUR_COUNT);
+    colrcv_pool_for(NULL, mark_range, actual[0], COLOUR_COUNT);
+    for(size_t i = 0; success && i < COLOUR_COUNT; i++) {
+        success = actual[0][i] == 2.0;
+    }
+    colrcv_pool_free(pool);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+// one of several conversions submitted to the same pool at the same time
+typedef struct concurrent_job_t {
+    colrcv_pool_t* pool;
+    colrcv_soa_conversion_t conversion;
+    // the number of colours to convert, from the start of the input arrays
+    size_t count;
+    double output[3][COLOUR_COUNT];
+    double expected[3][COLOUR_COUNT];
+} concurrent_job_t;
+
+static void* run_concurrent_job(void* argument) {
+    concurrent_job_t* job = argument;
+    colrcv_pool_convert_soa(
+        job->pool, job->conversion, r, g, b,
+        job->output[0], job->output[1], job->output[2], job->count
+    );
+    return NULL;
+}
+
+/*
+ * Test the function colrcv_pool_convert_soa
+ * Cheap and expensive conversions of different sizes submitted from several
+ * threads at once should all give the same results as on one thread
+ */
+static colrcv_test_result_t test_colrcv_pool_convert_soa_concurrent(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    static concurrent_job_t jobs[4];
+    // LAB->HSL goes by XYZ and RGB, so costs far more per colour than LAB->XYZ
+    const colrcv_soa_conversion_t conversions[4] = {
+        colrcv_lab_to_xyz_soa, colrcv_lab_to_hsl_soa,
+        colrcv_lab_to_hsv_soa, colrcv_lab_to_rgb_soa,
+    };
+    const size_t counts[4] = { 300, COLOUR_COUNT, 1000, COLOUR_COUNT / 2, };
+    fill_rgb_samples();
+    // the jobs all convert from LAB
+    colrcv_rgb_to_lab_soa(r, g, b, r, g, b, COLOUR_COUNT);
+    colrcv_pool_t* pool = colrcv_pool_create(3);
+    bool success = pool != NULL;
+    pthread_t threads[4];
+    for(size_t j = 0; success && j < 4; j++) {
+        jobs[j].pool = pool;
+        jobs[j].conversion = conversions[j];
+        jobs[j].count = counts[j];
+        jobs[j].conversion(
+            r, g, b, jobs[j].expected[0], jobs[j].expected[1],
+            jobs[j].expected[2], jobs[j].count
+        );
+        success = pthread_create(
+            &threads[j], NULL, run_concurrent_job, &jobs[j]
+        ) == 0;
+    }
+    for(size_t j = 0; success && j < 4; j++) {
+        pthread_join(threads[j], NULL);
+    }
+    for(size_t j = 0; success && j < 4; j++) {
+        for(size_t ch = 0; ch < 3; ch++) {
+            success = success && memcmp(
+                jobs[j].output[ch], jobs[j].expected[ch],
+                jobs[j].count * sizeof(double)
+            ) == 0;
+        }
+    }
+    colrcv_pool_free(pool);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_pool_create, &suite);
+    colrcv_add_test_case(test_colrcv_pool_convert_soa_deterministic, &suite);
+    colrcv_add_test_case(test_colrcv_pool_convert_strided, &suite);
+    colrcv_add_test_case(test_colrcv_pool_convert, &suite);
+    colrcv_add_test_case(test_colrcv_pool_for, &suite);
+    colrcv_add_test_case(test_colrcv_pool_convert_soa_concurrent, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -686,6 +686,775 @@ static colrcv_test_result_t test_colrcv_rgb_to_xyz(void) {
     return test;
 }
 
+/*
+ * Sample RGB colours used by the batch conversion tests, which check that each
+ * batch conversion function gives the same results as its single-colour
+ * counterpart
+ */
+#define SAMPLE_COUNT 5
+static const colrcv_rgb_t SAMPLE_COLOURS[SAMPLE_COUNT] = {
+    { .r = 16, .g = 243, .b = 67, },
+    { .r = 217, .g = 45, .b = 19, },
+    { .r = 33, .g = 33, .b = 33, },
+    { .r = 0, .g = 0, .b = 255, },
+    { .r = 255, .g = 255, .b = 255, },
+};
+
+// splits the sample colours into one array per channel
+static void split_sample_colours(double* in_r, double* in_g, double* in_b) {
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        in_r[i] = SAMPLE_COLOURS[i].r;
+        in_g[i] = SAMPLE_COLOURS[i].g;
+        in_b[i] = SAMPLE_COLOURS[i].b;
+    }
+}
+
+/*
+ * Test the function colrcv_rgb_to_hsv_soa
+ * Function should return the same colours as colrcv_rgb_to_hsv does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_hsv_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_r[SAMPLE_COUNT], in_g[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_h[SAMPLE_COUNT], out_s[SAMPLE_COUNT], out_v[SAMPLE_COUNT];
+    split_sample_colours(in_r, in_g, in_b);
+    colrcv_rgb_to_hsv_soa(
+        in_r, in_g, in_b, out_h, out_s, out_v, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsv_t expected = colrcv_rgb_to_hsv(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_h[i], expected.h) &&
+            almost_equal(out_s[i], expected.s) &&
+            almost_equal(out_v[i], expected.v)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_hsl_soa
+ * Function should return the same colours as colrcv_rgb_to_hsl does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_hsl_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_r[SAMPLE_COUNT], in_g[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_h[SAMPLE_COUNT], out_s[SAMPLE_COUNT], out_l[SAMPLE_COUNT];
+    split_sample_colours(in_r, in_g, in_b);
+    colrcv_rgb_to_hsl_soa(
+        in_r, in_g, in_b, out_h, out_s, out_l, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsl_t expected = colrcv_rgb_to_hsl(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_h[i], expected.h) &&
+            almost_equal(out_s[i], expected.s) &&
+            almost_equal(out_l[i], expected.l)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_lab_soa
+ * Function should return the same colours as colrcv_rgb_to_lab does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_lab_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_r[SAMPLE_COUNT], in_g[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_l[SAMPLE_COUNT], out_a[SAMPLE_COUNT], out_b[SAMPLE_COUNT];
+    split_sample_colours(in_r, in_g, in_b);
+    colrcv_rgb_to_lab_soa(
+        in_r, in_g, in_b, out_l, out_a, out_b, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_rgb_to_lab(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_l[i], expected.l) &&
+            almost_equal(out_a[i], expected.a) &&
+            almost_equal(out_b[i], expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_xyz_soa
+ * Function should return the same colours as colrcv_rgb_to_xyz does for each
+ * of the given colours
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_xyz_soa(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input and output channel arrays
+    double in_r[SAMPLE_COUNT], in_g[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    double out_x[SAMPLE_COUNT], out_y[SAMPLE_COUNT], out_z[SAMPLE_COUNT];
+    split_sample_colours(in_r, in_g, in_b);
+    colrcv_rgb_to_xyz_soa(
+        in_r, in_g, in_b, out_x, out_y, out_z, SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_rgb_to_xyz(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(out_x[i], expected.x) &&
+            almost_equal(out_y[i], expected.y) &&
+            almost_equal(out_z[i], expected.z)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_xyz_soa
+ * Function should give the same results when converting in-place, that is when
+ * the output arrays are the same as the input arrays
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_xyz_soa_in_place(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // channel arrays, which are converted in-place
+    double r[SAMPLE_COUNT], g[SAMPLE_COUNT], b[SAMPLE_COUNT];
+    split_sample_colours(r, g, b);
+    colrcv_rgb_to_xyz_soa(r, g, b, r, g, b, SAMPLE_COUNT);
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_rgb_to_xyz(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(r[i], expected.x) &&
+            almost_equal(g[i], expected.y) &&
+            almost_equal(b[i], expected.z)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * A record type with extra fields either side of a colour, used by the strided
+ * batch conversion tests
+ */
+struct sample_record_t {
+    double alpha;
+    colrcv_rgb_t colour;
+    uint32_t id;
+};
+
+// fills the given records with the sample colours
+static void fill_sample_records(struct sample_record_t* records) {
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        records[i].alpha = 1.0;
+        records[i].colour = SAMPLE_COLOURS[i];
+        records[i].id = i;
+    }
+}
+
+/*
+ * Test the function colrcv_rgb_to_hsv_strided
+ * Function should return the same colours as colrcv_rgb_to_hsv does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_hsv_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_hsv_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_rgb_to_hsv_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_hsv_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsv_t expected = colrcv_rgb_to_hsv(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].h, expected.h) &&
+            almost_equal(output[i].s, expected.s) &&
+            almost_equal(output[i].v, expected.v)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_hsl_strided
+ * Function should return the same colours as colrcv_rgb_to_hsl does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_hsl_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_hsl_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_rgb_to_hsl_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_hsl_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_hsl_t expected = colrcv_rgb_to_hsl(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].h, expected.h) &&
+            almost_equal(output[i].s, expected.s) &&
+            almost_equal(output[i].l, expected.l)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_lab_strided
+ * Function should return the same colours as colrcv_rgb_to_lab does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_lab_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_lab_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_rgb_to_lab_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_lab_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_rgb_to_lab(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].l, expected.l) &&
+            almost_equal(output[i].a, expected.a) &&
+            almost_equal(output[i].b, expected.b)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_xyz_strided
+ * Function should return the same colours as colrcv_rgb_to_xyz does for each
+ * of the given colours, when they are stored inside larger records
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_xyz_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // input records and plain output array
+    struct sample_record_t records[SAMPLE_COUNT];
+    colrcv_xyz_t output[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_rgb_to_xyz_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        output, sizeof(colrcv_xyz_t), SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_rgb_to_xyz(SAMPLE_COLOURS[i]);
+        bool conversion_ok = (
+            almost_equal(output[i].x, expected.x) &&
+            almost_equal(output[i].y, expected.y) &&
+            almost_equal(output[i].z, expected.z)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_lab_strided
+ * Function should give the same results when converting in-place, that is when
+ * the output colours are stored in the same place as the input colours
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_lab_strided_in_place(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // records which are converted in-place
+    struct sample_record_t records[SAMPLE_COUNT];
+    fill_sample_records(records);
+    colrcv_rgb_to_lab_strided(
+        &records[0].colour, sizeof(struct sample_record_t),
+        (colrcv_lab_t*)&records[0].colour, sizeof(struct sample_record_t),
+        SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_rgb_to_lab(SAMPLE_COLOURS[i]);
+        const colrcv_lab_t* result = (colrcv_lab_t*)&records[i].colour;
+        bool conversion_ok = (
+            almost_equal(result->l, expected.l) &&
+            almost_equal(result->a, expected.a) &&
+            almost_equal(result->b, expected.b) &&
+            // the other fields of each record should be left alone
+            (records[i].alpha == 1.0) && (records[i].id == i)
+        );
+        // OR to success flag
+        success = success && conversion_ok;
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_hsv_strided
+ * Function should convert every colour correctly when given more colours than
+ * are converted at a time internally
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_hsv_strided_many(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // enough colours to need several internal batches
+    colrcv_rgb_t input[1000];
+    colrcv_hsv_t output[1000];
+    for(uint16_t i = 0; i < 1000; i++) {
+        input[i] = (colrcv_rgb_t){
+            .r = i % 256, .g = (i * 7) % 256, .b = (i * 13) % 256,
+        };
+    }
+    colrcv_rgb_to_hsv_strided(
+        input, sizeof(colrcv_rgb_t), output, sizeof(colrcv_hsv_t), 1000
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    // compare each colour with the single-colour conversion
+    for(uint16_t i = 0; i < 1000; i++) {
+        colrcv_hsv_t expected = colrcv_rgb_to_hsv(input[i]);
+        success = success && (
+            almost_equal(output[i].h, expected.h) &&
+            almost_equal(output[i].s, expected.s) &&
+            almost_equal(output[i].v, expected.v)
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb_to_xyz with whole-number channels
+ * Function should give almost the same results as for channels just off the
+ * whole numbers, which are not looked up in a table
+ */
+static colrcv_test_result_t test_colrcv_rgb_to_xyz_whole_numbers(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(int i = 0; i < 256; i++) {
+        colrcv_xyz_t looked_up = colrcv_rgb_to_xyz(
+            (colrcv_rgb_t){ .r = i, .g = 255 - i, .b = i / 2, }
+        );
+        colrcv_xyz_t worked_out = colrcv_rgb_to_xyz(
+            (colrcv_rgb_t){
+                .r = i + 1e-9, .g = 255 - i - 1e-9, .b = i / 2 + 1e-9,
+            }
+        );
+        success = success && (
+            almost_equal(looked_up.x, worked_out.x) &&
+            almost_equal(looked_up.y, worked_out.y) &&
+            almost_equal(looked_up.z, worked_out.z)
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb8_to_xyz
+ * Function should give exactly the same results as colrcv_rgb_to_xyz
+ */
+static colrcv_test_result_t test_colrcv_rgb8_to_xyz(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(int i = 0; i < 256; i++) {
+        colrcv_rgb8_t rgb8 = {
+            .r = (uint8_t)i, .g = (uint8_t)(255 - i), .b = (uint8_t)(i * 7),
+        };
+        colrcv_xyz_t result = colrcv_rgb8_to_xyz(rgb8);
+        colrcv_xyz_t expected = colrcv_rgb_to_xyz(
+            (colrcv_rgb_t){ .r = rgb8.r, .g = rgb8.g, .b = rgb8.b, }
+        );
+        success = success && (
+            result.x == expected.x &&
+            result.y == expected.y &&
+            result.z == expected.z
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb8_to_xyz_strided
+ * Function should give the same results as colrcv_rgb8_to_xyz, for more
+ * colours than fit in one tile
+ */
+static colrcv_test_result_t test_colrcv_rgb8_to_xyz_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_rgb8_t input[1000];
+    colrcv_xyz_t output[1000];
+    for(size_t i = 0; i < 1000; i++) {
+        input[i] = (colrcv_rgb8_t){
+            .r = (uint8_t)i, .g = (uint8_t)(i * 3), .b = (uint8_t)(i / 4),
+        };
+    }
+    colrcv_rgb8_to_xyz_strided(
+        input, sizeof(colrcv_rgb8_t), output, sizeof(colrcv_xyz_t), 1000
+    );
+    // flag to keep track of result
+    bool success = true;
+    for(size_t i = 0; i < 1000; i++) {
+        colrcv_xyz_t expected = colrcv_rgb8_to_xyz(input[i]);
+        success = success && (
+            almost_equal(output[i].x, expected.x) &&
+            almost_equal(output[i].y, expected.y) &&
+            almost_equal(output[i].z, expected.z)
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * checks that a 16-bit hue is within 1 of a hue in degrees rounded to the
+ * nearest code, wrapping around at 65536
+ */
+static bool within_one_hue16(uint16_t value, double degrees) {
+    const uint16_t check = (uint16_t)lround(degrees * 65536 / 360);
+    return (uint16_t)(value - check) <= 1 || (uint16_t)(check - value) <= 1;
+}
+
+/*
+ * Test the function colrcv_rgb8_to_hsv8
+ * Function should give results within 1 of colrcv_rgb_to_hsv, scaled and
+ * rounded, ignoring the hue of greys
+ */
+static colrcv_test_result_t test_colrcv_rgb8_to_hsv8(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(int r = 0; r < 256; r += 5) {
+        for(int g = 0; g < 256; g += 3) {
+            for(int b = 0; b < 256; b += 7) {
+                colrcv_rgb8_t rgb8 = {
+                    .r = (uint8_t)r, .g = (uint8_t)g, .b = (uint8_t)b,
+                };
+                colrcv_hsv8_t result = colrcv_rgb8_to_hsv8(rgb8);
+                colrcv_hsv_t expected = colrcv_rgb_to_hsv(
+                    (colrcv_rgb_t){ .r = r, .g = g, .b = b, }
+                );
+                success = success && (
+                    (
+                        expected.s == 0 ||
+                        within_one_hue16(result.h, expected.h)
+                    ) &&
+                    within(result.s, round(expected.s * 2.55), 1) &&
+                    within(result.v, round(expected.v * 2.55), 1)
+                );
+            }
+        }
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb8_to_hsv8_strided
+ * Function should give the same results as colrcv_rgb8_to_hsv8
+ */
+static colrcv_test_result_t test_colrcv_rgb8_to_hsv8_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_rgb8_t input[1000];
+    colrcv_hsv8_t output[1000];
+    for(size_t i = 0; i < 1000; i++) {
+        input[i] = (colrcv_rgb8_t){
+            .r = (uint8_t)i, .g = (uint8_t)(i * 3), .b = (uint8_t)(i / 4),
+        };
+    }
+    colrcv_rgb8_to_hsv8_strided(
+        input, sizeof(colrcv_rgb8_t), output, sizeof(colrcv_hsv8_t), 1000
+    );
+    // flag to keep track of result
+    bool success = true;
+    for(size_t i = 0; i < 1000; i++) {
+        colrcv_hsv8_t expected = colrcv_rgb8_to_hsv8(input[i]);
+        success = success && (
+            output[i].h == expected.h &&
+            output[i].s == expected.s &&
+            output[i].v == expected.v
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb8_to_hsl8
+ * Function should give results within 1 of colrcv_rgb_to_hsl, scaled and
+ * rounded, ignoring the hue of greys
+ */
+static colrcv_test_result_t test_colrcv_rgb8_to_hsl8(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    for(int r = 0; r < 256; r += 5) {
+        for(int g = 0; g < 256; g += 3) {
+            for(int b = 0; b < 256; b += 7) {
+                colrcv_rgb8_t rgb8 = {
+                    .r = (uint8_t)r, .g = (uint8_t)g, .b = (uint8_t)b,
+                };
+                colrcv_hsl8_t result = colrcv_rgb8_to_hsl8(rgb8);
+                colrcv_hsl_t expected = colrcv_rgb_to_hsl(
+                    (colrcv_rgb_t){ .r = r, .g = g, .b = b, }
+                );
+                success = success && (
+                    (
+                        expected.s == 0 ||
+                        within_one_hue16(result.h, expected.h)
+                    ) &&
+                    within(result.s, round(expected.s * 2.55), 1) &&
+                    within(result.l, round(expected.l * 2.55), 1)
+                );
+            }
+        }
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_rgb8_to_hsl8_strided
+ * Function should give the same results as colrcv_rgb8_to_hsl8
+ */
+static colrcv_test_result_t test_colrcv_rgb8_to_hsl8_strided(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_rgb8_t input[1000];
+    colrcv_hsl8_t output[1000];
+    for(size_t i = 0; i < 1000; i++) {
+        input[i] = (colrcv_rgb8_t){
+            .r = (uint8_t)i, .g = (uint8_t)(i * 3), .b = (uint8_t)(i / 4),
+        };
+    }
+    colrcv_rgb8_to_hsl8_strided(
+        input, sizeof(colrcv_rgb8_t), output, sizeof(colrcv_hsl8_t), 1000
+    );
+    // flag to keep track of result
+    bool success = true;
+    for(size_t i = 0; i < 1000; i++) {
+        colrcv_hsl8_t expected = colrcv_rgb8_to_hsl8(input[i]);
+        success = success && (
+            output[i].h == expected.h &&
+            output[i].s == expected.s &&
+            output[i].l == expected.l
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the single-precision conversion functions from RGB
+ * Each should return the double-precision result rounded to float
+ */
+static colrcv_test_result_t test_colrcv_rgbf_conversions(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // flag to keep track of result
+    bool success = true;
+
+    /*
+     * rounded to single precision in a loop of their own, as GCC 12 drops
+     * the rounding when it is done in the same loop as widening them again
+     */
+    colrcv_rgbf_t colours[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colours[i] = (colrcv_rgbf_t){
+            .r = (float)SAMPLE_COLOURS[i].r,
+            .g = (float)SAMPLE_COLOURS[i].g,
+            .b = (float)SAMPLE_COLOURS[i].b,
+        };
+    }
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_rgbf_t colour = colours[i];
+        colrcv_rgb_t widened = { .r = colour.r, .g = colour.g, .b = colour.b, };
+        colrcv_hsv_t hsv = colrcv_rgb_to_hsv(widened);
+        colrcv_hsvf_t hsvf = colrcv_rgbf_to_hsvf(colour);
+        success = success && (
+            hsvf.h == (float)hsv.h &&
+            hsvf.s == (float)hsv.s &&
+            hsvf.v == (float)hsv.v
+        );
+        colrcv_hsl_t hsl = colrcv_rgb_to_hsl(widened);
+        colrcv_hslf_t hslf = colrcv_rgbf_to_hslf(colour);
+        success = success && (
+            hslf.h == (float)hsl.h &&
+            hslf.s == (float)hsl.s &&
+            hslf.l == (float)hsl.l
+        );
+        colrcv_lab_t lab = colrcv_rgb_to_lab(widened);
+        colrcv_labf_t labf = colrcv_rgbf_to_labf(colour);
+        success = success && (
+            labf.l == (float)lab.l &&
+            labf.a == (float)lab.a &&
+            labf.b == (float)lab.b
+        );
+        colrcv_xyz_t xyz = colrcv_rgb_to_xyz(widened);
+        colrcv_xyzf_t xyzf = colrcv_rgbf_to_xyzf(colour);
+        success = success && (
+            xyzf.x == (float)xyz.x &&
+            xyzf.y == (float)xyz.y &&
+            xyzf.z == (float)xyz.z
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the functions colrcv_rgbf_to_labf_soa and colrcv_rgbf_to_labf_strided
+ * Functions should return the same colours as colrcv_rgbf_to_labf does
+ */
+static colrcv_test_result_t test_colrcv_rgbf_to_labf_batch(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_rgbf_t samples[SAMPLE_COUNT];
+    colrcv_labf_t output[SAMPLE_COUNT];
+    float in_r[SAMPLE_COUNT], in_g[SAMPLE_COUNT], in_b[SAMPLE_COUNT];
+    float out_l[SAMPLE_COUNT], out_a[SAMPLE_COUNT], out_b[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        samples[i] = (colrcv_rgbf_t){
+            .r = (float)SAMPLE_COLOURS[i].r,
+            .g = (float)SAMPLE_COLOURS[i].g,
+            .b = (float)SAMPLE_COLOURS[i].b,
+        };
+        in_r[i] = samples[i].r;
+        in_g[i] = samples[i].g;
+        in_b[i] = samples[i].b;
+    }
+    colrcv_rgbf_to_labf_soa(
+        in_r, in_g, in_b, out_l, out_a, out_b, SAMPLE_COUNT
+    );
+    colrcv_rgbf_to_labf_strided(
+        samples, sizeof(colrcv_rgbf_t), output, sizeof(colrcv_labf_t),
+        SAMPLE_COUNT
+    );
+    // flag to keep track of result
+    bool success = true;
+
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_labf_t expected = colrcv_rgbf_to_labf(samples[i]);
+        success = success && (
+            almost_equal(out_l[i], expected.l) &&
+            almost_equal(output[i].l, expected.l) &&
+            almost_equal(out_a[i], expected.a) &&
+            almost_equal(output[i].a, expected.a) &&
+            almost_equal(out_b[i], expected.b) &&
+            almost_equal(output[i].b, expected.b)
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
 int main(void) {
     // initialise test suite
     colrcv_test_suite_t suite = colrcv_init_test_suite();
@@ -710,6 +1479,26 @@ int main(void) {
     colrcv_add_test_case(test_colrcv_rgb_to_hsl, &suite);
     colrcv_add_test_case(test_colrcv_rgb_to_lab, &suite);
     colrcv_add_test_case(test_colrcv_rgb_to_xyz, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_hsv_soa, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_hsl_soa, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_lab_soa, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_xyz_soa, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_xyz_soa_in_place, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_hsv_strided, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_hsl_strided, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_lab_strided, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_xyz_strided, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_lab_strided_in_place, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_hsv_strided_many, &suite);
+    colrcv_add_test_case(test_colrcv_rgb_to_xyz_whole_numbers, &suite);
+    colrcv_add_test_case(test_colrcv_rgb8_to_xyz, &suite);
+    colrcv_add_test_case(test_colrcv_rgb8_to_xyz_strided, &suite);
+    colrcv_add_test_case(test_colrcv_rgb8_to_hsv8, &suite);
+    colrcv_add_test_case(test_colrcv_rgb8_to_hsv8_strided, &suite);
+    colrcv_add_test_case(test_colrcv_rgb8_to_hsl8, &suite);
+    colrcv_add_test_case(test_colrcv_rgb8_to_hsl8_strided, &suite);
+    colrcv_add_test_case(test_colrcv_rgbf_conversions, &suite);
+    colrcv_add_test_case(test_colrcv_rgbf_to_labf_batch, &suite);
     // run test suite
     colrcv_run_test_suite(&suite);
     // free test suite
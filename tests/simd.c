@@ -0,0 +1,409 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the SIMD dispatch unit (simd.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../unit_test_harness/harness.h"
+#include "support.h"
+
+#include "../colrcv/colrcv.h"
+#include "../colrcv/simd.h"
+#include "../colrcv/models/hsl.h"
+#include "../colrcv/models/hsv.h"
+#include "../colrcv/models/lab.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/xyz.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * number of colours used by the batch tests - not a multiple of any vector
+ * width, so that the scalar remainder of each kernel is also tested
+ */
+#define SAMPLE_COUNT 37
+
+/*
+ * checks that colrcv_rgb_to_xyz_soa, colrcv_xyz_to_lab_soa and
+ * colrcv_xyz_to_rgb_soa give the same results as the single-colour functions
+ * with the current SIMD level
+ */
+static bool check_batch_matches_scalar(void) {
+    double r[SAMPLE_COUNT], g[SAMPLE_COUNT], b[SAMPLE_COUNT];
+    double x[SAMPLE_COUNT], y[SAMPLE_COUNT], z[SAMPLE_COUNT];
+    double l[SAMPLE_COUNT], a[SAMPLE_COUNT], lab_b[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        r[i] = (i * 7) % 256;
+        g[i] = (i * 53) % 256;
+        b[i] = 255 - (i * 31) % 256;
+    }
+    colrcv_rgb_to_xyz_soa(r, g, b, x, y, z, SAMPLE_COUNT);
+    bool success = true;
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_xyz_t expected = colrcv_rgb_to_xyz(
+            (colrcv_rgb_t){ .r = r[i], .g = g[i], .b = b[i], }
+        );
+        success = success && (
+            almost_equal(x[i], expected.x) &&
+            almost_equal(y[i], expected.y) &&
+            almost_equal(z[i], expected.z)
+        );
+    }
+    colrcv_xyz_to_lab_soa(x, y, z, l, a, lab_b, SAMPLE_COUNT);
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_lab_t expected = colrcv_xyz_to_lab(
+            (colrcv_xyz_t){ .x = x[i], .y = y[i], .z = z[i], }
+        );
+        success = success && (
+            almost_equal(l[i], expected.l) &&
+            almost_equal(a[i], expected.a) &&
+            almost_equal(lab_b[i], expected.b)
+        );
+    }
+    // convert back again
+    colrcv_xyz_to_rgb_soa(x, y, z, r, g, b, SAMPLE_COUNT);
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        colrcv_rgb_t expected = colrcv_xyz_to_rgb(
+            (colrcv_xyz_t){ .x = x[i], .y = y[i], .z = z[i], }
+        );
+        success = success && (
+            almost_equal(r[i], expected.r) &&
+            almost_equal(g[i], expected.g) &&
+            almost_equal(b[i], expected.b)
+        );
+    }
+    return success;
+}
+
+/*
+ * Test the function colrcv_simd_set_level
+ * Function should always accept COLRCV_SIMD_NONE, and subsequently
+ * colrcv_simd_get_level should return it
+ */
+static colrcv_test_result_t test_colrcv_simd_set_level_none(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    bool success = colrcv_simd_set_level(COLRCV_SIMD_NONE);
+    success = success && (colrcv_simd_get_level() == COLRCV_SIMD_NONE);
+    // restore the default
+    colrcv_simd_set_level(colrcv_simd_detect_level());
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_simd_get_level
+ * Function should return the detected level when none has been set
+ */
+static colrcv_test_result_t test_colrcv_simd_get_level_default(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    test.result = (
+        colrcv_simd_get_level() == colrcv_simd_detect_level()
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+/*
+ * checks the RGB<->XYZ batch conversion functions with every SIMD level that
+ * the current CPU supports, in the given accuracy mode
+ */
+static bool check_all_levels(colrcv_accuracy_t accuracy) {
+    const colrcv_simd_level_t detected = colrcv_simd_detect_level();
+    // flag to keep track of result
+    bool success = true;
+
+    colrcv_set_accuracy(accuracy);
+    for(int level = COLRCV_SIMD_NONE; level <= (int)detected; level++) {
+        bool level_ok = (
+            colrcv_simd_set_level((colrcv_simd_level_t)level) &&
+            check_batch_matches_scalar()
+        );
+        if(!level_ok) {
+            printf(
+                "SIMD level %d gave wrong results in accuracy mode %d\n",
+                level, (int)accuracy
+            );
+        }
+        success = success && level_ok;
+    }
+    // restore the defaults
+    colrcv_simd_set_level(detected);
+    colrcv_set_accuracy(COLRCV_ACCURACY_EXACT);
+    return success;
+}
+
+/*
+ * Test the RGB<->XYZ batch conversion functions with every SIMD level that the
+ * current CPU supports
+ * Each level should give the same results as the single-colour functions
+ */
+static colrcv_test_result_t test_colrcv_simd_all_levels(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    test.result = check_all_levels(
+        COLRCV_ACCURACY_EXACT
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+/*
+ * Test the RGB<->XYZ batch conversion functions with every SIMD level that the
+ * current CPU supports, using the fast sRGB transfer function
+ * Each level should give almost the same results as the single-colour functions
+ */
+static colrcv_test_result_t test_colrcv_simd_all_levels_fast(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+
+    test.result = check_all_levels(
+        COLRCV_ACCURACY_FAST
+    ) ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+
+    return test;
+}
+
+// true if the two doubles have exactly the same bits
+static bool identical(double value, double check) {
+    return memcmp(&value, &check, sizeof(double)) == 0;
+}
+
+/*
+ * Test the HSV/HSL->XYZ/LAB and LAB->RGB batch conversion functions with the
+ * scalar SIMD level
+ * These are documented as bit-identical to the single-colour functions, so
+ * must give exactly the same results as them, not just almost the same
+ */
+static colrcv_test_result_t test_colrcv_simd_none_bit_identical(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double h[SAMPLE_COUNT], s[SAMPLE_COUNT], v[SAMPLE_COUNT];
+    double x[SAMPLE_COUNT], y[SAMPLE_COUNT], z[SAMPLE_COUNT];
+    double l[SAMPLE_COUNT], a[SAMPLE_COUNT], b[SAMPLE_COUNT];
+    double r[SAMPLE_COUNT], g[SAMPLE_COUNT], rgb_b[SAMPLE_COUNT];
+    for(uint8_t i = 0; i < SAMPLE_COUNT; i++) {
+        h[i] = (i * 37) % 360 + 0.25 * (i % 4);
+        s[i] = (i * 53) % 101;
+        v[i] = 100 - (i * 31) % 101;
+    }
+    const colrcv_accuracy_t accuracy = colrcv_get_accuracy();
+    colrcv_set_accuracy(COLRCV_ACCURACY_EXACT);
+    bool success = colrcv_simd_set_level(COLRCV_SIMD_NONE);
+    colrcv_hsv_to_xyz_soa(h, s, v, x, y, z, SAMPLE_COUNT);
+    colrcv_hsl_to_lab_soa(h, s, v, l, a, b, SAMPLE_COUNT);
+    colrcv_lab_to_rgb_soa(l, a, b, r, g, rgb_b, SAMPLE_COUNT);
+    for(uint8_t i = 0; success && i < SAMPLE_COUNT; i++) {
+        const colrcv_xyz_t xyz = colrcv_hsv_to_xyz(
+            (colrcv_hsv_t){ .h = h[i], .s = s[i], .v = v[i], }
+        );
+        const colrcv_lab_t lab = colrcv_hsl_to_lab(
+            (colrcv_hsl_t){ .h = h[i], .s = s[i], .l = v[i], }
+        );
+        const colrcv_rgb_t rgb = colrcv_lab_to_rgb(lab);
+        success = (
+            identical(x[i], xyz.x) &&
+            identical(y[i], xyz.y) &&
+            identical(z[i], xyz.z) &&
+            identical(l[i], lab.l) &&
+            identical(a[i], lab.a) &&
+            identical(b[i], lab.b) &&
+            identical(r[i], rgb.r) &&
+            identical(g[i], rgb.g) &&
+            identical(rgb_b[i], rgb.b)
+        );
+    }
+    colrcv_simd_set_level(colrcv_simd_detect_level());
+    colrcv_set_accuracy(accuracy);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * checks that colrcv_lab_validate_soa and colrcv_lab_clamp_soa agree with
+ * colrcv_lab_is_valid and colrcv_lab_clamp with the current SIMD level, for
+ * values in and out of range, on the bounds, infinite and NaN
+ */
+static bool check_ranges_match_scalar(void) {
+    static const double values[] = {
+        -1000.0, -128.0, -127.5, -0.0, 0.0, 50.0, 100.0, 100.5, 127.0, 128.0,
+        INFINITY, -INFINITY, NAN,
+    };
+    const size_t value_count = sizeof(values) / sizeof(values[0]);
+    double l[SAMPLE_COUNT], a[SAMPLE_COUNT], b[SAMPLE_COUNT];
+    colrcv_lab_t colours[SAMPLE_COUNT];
+    uint8_t invalid[(SAMPLE_COUNT + 7) / 8];
+    size_t expected = 0;
+    for(size_t i = 0; i < SAMPLE_COUNT; i++) {
+        l[i] = values[(i * 3) % value_count];
+        a[i] = values[(i * 5 + 1) % value_count];
+        b[i] = values[(i * 7 + 2) % value_count];
+        colours[i] = (colrcv_lab_t){ .l = l[i], .a = a[i], .b = b[i], };
+        expected += !colrcv_lab_is_valid(colours[i]);
+    }
+    bool success = colrcv_lab_validate_soa(
+        l, a, b, invalid, SAMPLE_COUNT
+    ) == expected;
+    for(size_t i = 0; i < SAMPLE_COUNT; i++) {
+        const bool bit = (invalid[i / 8] >> (i % 8)) & 1;
+        success = success && bit == !colrcv_lab_is_valid(colours[i]);
+    }
+    // the bits past the last colour should be left clear
+    success = success && (invalid[SAMPLE_COUNT / 8] >> (SAMPLE_COUNT % 8)) == 0;
+    colrcv_lab_clamp_soa(l, a, b, SAMPLE_COUNT);
+    for(size_t i = 0; i < SAMPLE_COUNT; i++) {
+        const colrcv_lab_t clamped = colrcv_lab_clamp(colours[i]);
+        success = success && (
+            memcmp(&l[i], &clamped.l, sizeof(double)) == 0 &&
+            memcmp(&a[i], &clamped.a, sizeof(double)) == 0 &&
+            memcmp(&b[i], &clamped.b, sizeof(double)) == 0
+        );
+    }
+    return success;
+}
+
+/*
+ * Test the batch validation and clamping functions with every SIMD level that
+ * the current CPU supports
+ * Each level should give exactly the same results as the single-colour
+ * functions
+ */
+static colrcv_test_result_t test_colrcv_simd_all_levels_ranges(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_simd_level_t detected = colrcv_simd_detect_level();
+    // flag to keep track of result
+    bool success = true;
+    for(int level = COLRCV_SIMD_NONE; level <= (int)detected; level++) {
+        bool level_ok = (
+            colrcv_simd_set_level((colrcv_simd_level_t)level) &&
+            check_ranges_match_scalar()
+        );
+        if(!level_ok) {
+            printf("SIMD level %d validated or clamped wrongly\n", level);
+        }
+        success = success && level_ok;
+    }
+    // restore the default
+    colrcv_simd_set_level(detected);
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the fast sRGB transfer function with every 8-bit RGB channel value
+ * Function should stay within the error documented for COLRCV_ACCURACY_FAST
+ */
+static colrcv_test_result_t test_colrcv_accuracy_fast_error(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double r[256], g[256], b[256];
+    double x[256], y[256], z[256];
+    for(int i = 0; i < 256; i++) {
+        r[i] = g[i] = b[i] = i;
+    }
+    colrcv_set_accuracy(COLRCV_ACCURACY_FAST);
+    colrcv_rgb_to_xyz_soa(r, g, b, x, y, z, 256);
+    colrcv_xyz_to_rgb_soa(x, y, z, r, g, b, 256);
+    colrcv_set_accuracy(COLRCV_ACCURACY_EXACT);
+    // flag to keep track of result
+    bool success = true;
+    for(int i = 0; i < 256; i++) {
+        colrcv_xyz_t xyz = colrcv_rgb_to_xyz(
+            (colrcv_rgb_t){ .r = i, .g = i, .b = i, }
+        );
+        colrcv_rgb_t rgb = colrcv_xyz_to_rgb(xyz);
+        success = success && (
+            fabs(x[i] - xyz.x) < 1e-6 &&
+            fabs(y[i] - xyz.y) < 1e-6 &&
+            fabs(z[i] - xyz.z) < 1e-6 &&
+            fabs(r[i] - rgb.r) < 1e-5 &&
+            fabs(g[i] - rgb.g) < 1e-5 &&
+            fabs(b[i] - rgb.b) < 1e-5
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the fast LAB cube root with XYZ colours spread over a wide range
+ * Function should stay within the error documented for COLRCV_ACCURACY_FAST
+ */
+static colrcv_test_result_t test_colrcv_accuracy_fast_lab_error(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double x[256], y[256], z[256];
+    double l[256], a[256], b[256];
+    for(int i = 0; i < 256; i++) {
+        // from just under the linear segment of the curve up to about 115
+        x[i] = 0.001 * pow(1.05, i);
+        y[i] = x[i] * 0.9;
+        z[i] = x[i] * 1.1;
+    }
+    colrcv_set_accuracy(COLRCV_ACCURACY_FAST);
+    colrcv_xyz_to_lab_soa(x, y, z, l, a, b, 256);
+    colrcv_set_accuracy(COLRCV_ACCURACY_EXACT);
+    // flag to keep track of result
+    bool success = true;
+    for(int i = 0; i < 256; i++) {
+        colrcv_lab_t lab = colrcv_xyz_to_lab(
+            (colrcv_xyz_t){ .x = x[i], .y = y[i], .z = z[i], }
+        );
+        success = success && (
+            fabs(l[i] - lab.l) < 1e-9 &&
+            fabs(a[i] - lab.a) < 1e-9 &&
+            fabs(b[i] - lab.b) < 1e-9
+        );
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_simd_get_level_default, &suite);
+    colrcv_add_test_case(test_colrcv_simd_set_level_none, &suite);
+    colrcv_add_test_case(test_colrcv_simd_all_levels, &suite);
+    colrcv_add_test_case(test_colrcv_simd_all_levels_fast, &suite);
+    colrcv_add_test_case(test_colrcv_simd_none_bit_identical, &suite);
+    colrcv_add_test_case(test_colrcv_simd_all_levels_ranges, &suite);
+    colrcv_add_test_case(test_colrcv_accuracy_fast_error, &suite);
+    colrcv_add_test_case(test_colrcv_accuracy_fast_lab_error, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
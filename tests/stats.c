@@ -0,0 +1,336 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This unit tests the statistics unit (stats.h)
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for POSIX threads when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../unit_test_harness/harness.h"
+
+#include "../colrcv/pool.h"
+#include "../colrcv/stats.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/hsv.h"
+#include "../colrcv/models/lab.h"
+#include "../colrcv/models/xyz.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the number of conversions done by each thread of the threads test
+#define THREAD_CONVERSIONS 100
+// the number of colours of the pool test, split into many tiles
+#define POOL_COLOURS 100000
+
+// adds up all of the counters of a snapshot
+static uint64_t get_total(colrcv_stats_t stats) {
+    const uint64_t* counters = (const uint64_t*)&stats;
+    uint64_t total = 0;
+    for(size_t i = 0; i < sizeof(stats) / sizeof(uint64_t); i++) {
+        total += counters[i];
+    }
+    return total;
+}
+
+// adds up the calls counted for every conversion
+static uint64_t get_total_calls(colrcv_stats_t stats) {
+    uint64_t total = 0;
+    for(size_t from = 0; from < COLRCV_MODEL_COUNT; from++) {
+        for(size_t to = 0; to < COLRCV_MODEL_COUNT; to++) {
+            total += stats.calls[from][to];
+        }
+    }
+    return total;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * Statistics should be off by default, with nothing counted while they are
+ */
+static colrcv_test_result_t test_colrcv_stats_disabled(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_stats_reset();
+    bool success = !colrcv_stats_is_enabled();
+    const colrcv_lab_t lab = { .l = 150.0, .a = 0.0, .b = 0.0, };
+    colrcv_rgb_to_lab((colrcv_rgb_t){ .r = 1.0, .g = 2.0, .b = 3.0, });
+    colrcv_lab_to_rgb(lab);
+    colrcv_lab_clamp(lab);
+    colrcv_lab_is_valid(lab);
+    success = success && get_total(colrcv_stats_get_snapshot()) == 0;
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * Each call to a single-colour conversion should be counted, including those
+ * of the single-precision versions, and reset back to zero
+ */
+static colrcv_test_result_t test_colrcv_stats_single(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_stats_reset();
+    colrcv_stats_set_enabled(true);
+    bool success = colrcv_stats_is_enabled();
+    const colrcv_rgb_t rgb = { .r = 10.0, .g = 20.0, .b = 30.0, };
+    for(size_t i = 0; i < 3; i++) {
+        colrcv_rgb_to_lab(rgb);
+    }
+    colrcv_rgbf_to_labf((colrcv_rgbf_t){ .r = 10.0f, .g = 20.0f, .b = 30.0f, });
+    colrcv_hsv_to_rgb((colrcv_hsv_t){ .h = 90.0, .s = 50.0, .v = 50.0, });
+    colrcv_stats_set_enabled(false);
+    // not counted, as statistics are off again
+    colrcv_rgb_to_lab(rgb);
+    colrcv_stats_t stats = colrcv_stats_get_snapshot();
+    success = success && (
+        stats.calls[COLRCV_MODEL_RGB][COLRCV_MODEL_LAB] == 4 &&
+        stats.colours[COLRCV_MODEL_RGB][COLRCV_MODEL_LAB] == 4 &&
+        stats.calls[COLRCV_MODEL_HSV][COLRCV_MODEL_RGB] == 1 &&
+        get_total_calls(stats) == 5
+    );
+    colrcv_stats_reset();
+    success = success && get_total(colrcv_stats_get_snapshot()) == 0;
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * Each call to a batch conversion should be counted once with all of its
+ * colours, even when it is done through other batch conversions
+ */
+static colrcv_test_result_t test_colrcv_stats_batch(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    double a[10] = { 0.0, }, b[10] = { 0.0, }, c[10] = { 0.0, };
+    float fa[3] = { 0.0f, }, fb[3] = { 0.0f, }, fc[3] = { 0.0f, };
+    colrcv_hsv_t hsv[5] = { { .h = 0.0, .s = 0.0, .v = 0.0, }, };
+    colrcv_lab_t lab[5];
+    colrcv_stats_reset();
+    colrcv_stats_set_enabled(true);
+    // converted through XYZ with colrcv_xyz_to_lab_soa()
+    colrcv_rgb_to_lab_soa(a, b, c, a, b, c, 10);
+    colrcv_hsv_to_lab_strided(
+        hsv, sizeof(colrcv_hsv_t), lab, sizeof(colrcv_lab_t), 5
+    );
+    colrcv_labf_to_rgbf_soa(fa, fb, fc, fa, fb, fc, 3);
+    colrcv_stats_set_enabled(false);
+    const colrcv_stats_t stats = colrcv_stats_get_snapshot();
+    const bool success = (
+        stats.calls[COLRCV_MODEL_RGB][COLRCV_MODEL_LAB] == 1 &&
+        stats.colours[COLRCV_MODEL_RGB][COLRCV_MODEL_LAB] == 10 &&
+        stats.calls[COLRCV_MODEL_HSV][COLRCV_MODEL_LAB] == 1 &&
+        stats.colours[COLRCV_MODEL_HSV][COLRCV_MODEL_LAB] == 5 &&
+        stats.calls[COLRCV_MODEL_LAB][COLRCV_MODEL_RGB] == 1 &&
+        stats.colours[COLRCV_MODEL_LAB][COLRCV_MODEL_RGB] == 3 &&
+        get_total_calls(stats) == 3
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * The RGB channels of colours outside of the RGB gamut should be counted when
+ * clipped, by the single-colour, batch and 8-bit conversions alike
+ */
+static colrcv_test_result_t test_colrcv_stats_gamut(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    // red and green are out of gamut, blue and the whole of black are in it
+    const colrcv_xyz_t outside = { .x = 100.0, .y = 0.0, .z = 0.0, };
+    const colrcv_xyz_t black = { .x = 0.0, .y = 0.0, .z = 0.0, };
+    double x[2] = { outside.x, black.x, };
+    double y[2] = { outside.y, black.y, };
+    double z[2] = { outside.z, black.z, };
+    colrcv_stats_reset();
+    colrcv_stats_set_enabled(true);
+    colrcv_xyz_to_rgb(outside);
+    colrcv_xyz_to_rgb(black);
+    colrcv_xyz_to_hsv_soa(x, y, z, x, y, z, 2);
+    colrcv_xyz_to_rgb8(outside);
+    colrcv_stats_set_enabled(false);
+    const colrcv_stats_t stats = colrcv_stats_get_snapshot();
+    const bool success = (
+        stats.gamut_clipped[0] == 3 &&
+        stats.gamut_clipped[1] == 3 &&
+        stats.gamut_clipped[2] == 0
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * Channels out of range should be counted by the clamping functions and
+ * invalid colours by the validation functions, but not those in range
+ */
+static colrcv_test_result_t test_colrcv_stats_clamp_and_invalid(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    const colrcv_lab_t outside = { .l = 150.0, .a = 0.0, .b = -200.0, };
+    const colrcv_lab_t inside = { .l = 50.0, .a = 0.0, .b = 0.0, };
+    colrcv_stats_reset();
+    colrcv_stats_set_enabled(true);
+    double l[2] = { outside.l, inside.l, };
+    double a[2] = { outside.a, inside.a, };
+    double b[2] = { outside.b, inside.b, };
+    colrcv_lab_clamp(outside);
+    colrcv_lab_clamp(inside);
+    bool success = !colrcv_lab_is_valid(outside) && colrcv_lab_is_valid(inside);
+    // and the same again by the batch functions
+    success = success && colrcv_lab_validate_soa(l, a, b, NULL, 2) == 1;
+    colrcv_lab_clamp_soa(l, a, b, 2);
+    colrcv_stats_set_enabled(false);
+    const colrcv_stats_t stats = colrcv_stats_get_snapshot();
+    success = success && (
+        stats.clamped[COLRCV_MODEL_LAB][0] == 2 &&
+        stats.clamped[COLRCV_MODEL_LAB][1] == 0 &&
+        stats.clamped[COLRCV_MODEL_LAB][2] == 2 &&
+        stats.invalid[COLRCV_MODEL_LAB] == 2 &&
+        get_total(stats) == 6
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * A conversion split between the threads of a pool should be counted once
+ * with all of its colours, not once for each part it was split into
+ */
+static colrcv_test_result_t test_colrcv_stats_pool(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_pool_t* pool = colrcv_pool_create(4);
+    double* channels = calloc(3 * POOL_COLOURS, sizeof(double));
+    colrcv_rgb_t* rgb = calloc(POOL_COLOURS, sizeof(colrcv_rgb_t));
+    colrcv_hsv_t* hsv = calloc(POOL_COLOURS, sizeof(colrcv_hsv_t));
+    bool success = pool != NULL && channels != NULL && rgb != NULL && hsv;
+    if(success) {
+        double* r = channels;
+        double* g = channels + POOL_COLOURS;
+        double* b = channels + 2 * POOL_COLOURS;
+        colrcv_stats_reset();
+        colrcv_stats_set_enabled(true);
+        colrcv_pool_convert(
+            pool, COLRCV_MODEL_RGB, COLRCV_MODEL_HSV,
+            r, g, b, r, g, b, POOL_COLOURS
+        );
+        colrcv_pool_convert_strided(
+            pool, colrcv_rgb_to_hsv_soa, rgb, sizeof(colrcv_rgb_t),
+            hsv, sizeof(colrcv_hsv_t), POOL_COLOURS
+        );
+        colrcv_stats_set_enabled(false);
+        const colrcv_stats_t stats = colrcv_stats_get_snapshot();
+        success = (
+            stats.calls[COLRCV_MODEL_RGB][COLRCV_MODEL_HSV] == 2 &&
+            stats.colours[COLRCV_MODEL_RGB][COLRCV_MODEL_HSV] ==
+                2 * POOL_COLOURS &&
+            get_total_calls(stats) == 2
+        );
+    }
+    free(hsv);
+    free(rgb);
+    free(channels);
+    if(pool != NULL) {
+        colrcv_pool_free(pool);
+    }
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+// converts a colour a number of times, to be counted
+static void* convert_colours(void* argument) {
+    (void)argument;
+    for(size_t i = 0; i < THREAD_CONVERSIONS; i++) {
+        colrcv_rgb_to_hsv(
+            (colrcv_rgb_t){ .r = (double)i, .g = 0.0, .b = 0.0, }
+        );
+    }
+    return NULL;
+}
+
+/*
+ * Test the function colrcv_stats_get_snapshot
+ * The counts of every thread should be added together, including those of
+ * threads which have finished
+ */
+static colrcv_test_result_t test_colrcv_stats_threads(void) {
+    // initialise test result
+    colrcv_test_result_t test = COLRCV_TEST;
+    colrcv_stats_reset();
+    colrcv_stats_set_enabled(true);
+    bool success = true;
+    pthread_t threads[4];
+    size_t started = 0;
+    // only threads which were started are joined
+    while(success && started < 4) {
+        success = pthread_create(
+            &threads[started], NULL, convert_colours, NULL
+        ) == 0;
+        if(success) {
+            started++;
+        }
+    }
+    for(size_t j = 0; j < started; j++) {
+        pthread_join(threads[j], NULL);
+    }
+    // and some by this thread, which is still running
+    convert_colours(NULL);
+    colrcv_stats_set_enabled(false);
+    const colrcv_stats_t stats = colrcv_stats_get_snapshot();
+    success = success && (
+        stats.calls[COLRCV_MODEL_RGB][COLRCV_MODEL_HSV] ==
+            5 * THREAD_CONVERSIONS
+    );
+
+    test.result = success ? COLRCV_TEST_SUCCESS : COLRCV_TEST_FAIL;
+    return test;
+}
+
+int main(void) {
+    // initialise test suite
+    colrcv_test_suite_t suite = colrcv_init_test_suite();
+    // add test cases
+    colrcv_add_test_case(test_colrcv_stats_disabled, &suite);
+    colrcv_add_test_case(test_colrcv_stats_single, &suite);
+    colrcv_add_test_case(test_colrcv_stats_batch, &suite);
+    colrcv_add_test_case(test_colrcv_stats_gamut, &suite);
+    colrcv_add_test_case(test_colrcv_stats_clamp_and_invalid, &suite);
+    colrcv_add_test_case(test_colrcv_stats_pool, &suite);
+    colrcv_add_test_case(test_colrcv_stats_threads, &suite);
+    // run test suite
+    colrcv_run_test_suite(&suite);
+    // free test suite
+    colrcv_free_test_suite(suite);
+    // return test suite status
+    return suite.result ? 0 : 1;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
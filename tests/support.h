@@ -13,6 +13,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
+#include <math.h>
 #include <stdbool.h>
 
 
@@ -33,6 +34,23 @@ bool almost_equal(double value, double check) {
     return (((check - ALMOST) <= value) && (value <= (check + ALMOST)));
 }
 
+// checks that `value` is within +/-`tolerance` either side of `check`
+bool within(double value, double check, double tolerance);
+
+bool within(double value, double check, double tolerance) {
+    return fabs(value - check) <= tolerance;
+}
+
+/*
+ * checks that `value` is within `tolerance` of `check` relative to the size of
+ * `check` - or absolutely, when `check` is smaller than 1
+ */
+bool relatively_close(double value, double check, double tolerance);
+
+bool relatively_close(double value, double check, double tolerance) {
+    return within(value, check, tolerance * fmax(1.0, fabs(check)));
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
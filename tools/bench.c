@@ -0,0 +1,972 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This is a benchmark of every conversion between colour models, and of
+ * checking and clamping colours of each model, over arrays of colours from 1
+ * colour up to a given size. It writes its results as JSON, so that runs on
+ * different releases can be compared.
+ *
+ * On Linux, it can also count cycles, instructions, branch and cache misses
+ * with the hardware performance counters while running each benchmark.
+ *
+ * It can also write a baseline of each benchmark to a file and compare later
+ * runs against it, failing when any of them has got slower, which is run as a
+ * test for release builds.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for clock_gettime() when compiling as strict ISO C
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../colrcv/colrcv.h"
+#include "../colrcv/convert.h"
+#include "../colrcv/simd.h"
+#include "../colrcv/models/rgb.h"
+#include "../colrcv/models/hsv.h"
+#include "../colrcv/models/hsl.h"
+#include "../colrcv/models/lab.h"
+#include "../colrcv/models/xyz.h"
+
+#include "counters.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the number of timed samples taken of each benchmark at each size
+#define DEFAULT_SAMPLES 5
+// the largest array of colours benchmarked by default
+#define DEFAULT_MAX_SIZE 1000000
+// the total time in seconds to spend sampling each benchmark at each size
+#define DEFAULT_MIN_TIME 0.2
+// the number of timed samples taken of each benchmark against a baseline
+#define GATE_SAMPLES 15
+// the size of array of colours that baselines are taken at, which fits in cache
+#define DEFAULT_GATE_SIZE 10000
+// the fraction slower than its baseline that a benchmark may get
+#define DEFAULT_THRESHOLD 0.15
+// the number of times a benchmark slower than its baseline is measured again
+#define GATE_RETRIES 2
+// the number of steps of the reference loop, timed after each sample
+#define REFERENCE_STEPS 1000000
+
+// the names of the colour models, as used in the names of benchmarks
+static const char* MODEL_NAMES[COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = "rgb",
+    [COLRCV_MODEL_HSV] = "hsv",
+    [COLRCV_MODEL_HSL] = "hsl",
+    [COLRCV_MODEL_LAB] = "lab",
+    [COLRCV_MODEL_XYZ] = "xyz",
+};
+
+static const char* SIMD_LEVEL_NAMES[] = {
+    [COLRCV_SIMD_NONE] = "none",
+    [COLRCV_SIMD_SSE4_1] = "sse4.1",
+    [COLRCV_SIMD_AVX2] = "avx2",
+    [COLRCV_SIMD_AVX512] = "avx512",
+};
+
+/*
+ * a function which does something to `count` colours, stored as colour
+ * structs or as three channel arrays one after the other
+ */
+typedef void (* bench_function_t)(const double*, double*, size_t);
+
+/* BEGIN single-colour loops */
+
+// defines a loop calling a single-colour conversion function on each colour
+#define SCALAR_CONVERSION(from, to) \
+    static void scalar_##from##_to_##to( \
+        const double* input, double* output, size_t count \
+    ) { \
+        const colrcv_##from##_t* colours = (const colrcv_##from##_t*)input; \
+        colrcv_##to##_t* results = (colrcv_##to##_t*)output; \
+        for(size_t i = 0; i < count; i++) { \
+            results[i] = colrcv_##from##_to_##to(colours[i]); \
+        } \
+    }
+
+// defines loops calling the validation and clamping functions of a model
+#define SCALAR_VALIDATION(model) \
+    static void scalar_##model##_is_valid( \
+        const double* input, double* output, size_t count \
+    ) { \
+        const colrcv_##model##_t* colours = (const colrcv_##model##_t*)input; \
+        size_t valid = 0; \
+        for(size_t i = 0; i < count; i++) { \
+            valid += colrcv_##model##_is_valid(colours[i]); \
+        } \
+        output[0] = (double)valid; \
+    } \
+    static void scalar_##model##_clamp( \
+        const double* input, double* output, size_t count \
+    ) { \
+        const colrcv_##model##_t* colours = (const colrcv_##model##_t*)input; \
+        colrcv_##model##_t* results = (colrcv_##model##_t*)output; \
+        for(size_t i = 0; i < count; i++) { \
+            results[i] = colrcv_##model##_clamp(colours[i]); \
+        } \
+    }
+
+/*
+ * defines the batch versions of the validation and clamping loops. validation
+ * writes its bitmask over the output and clamping clamps a copy of the input,
+ * as the scalar loops write their results to the output
+ */
+#define BATCH_VALIDATION(model) \
+    static void batch_##model##_is_valid( \
+        const double* input, double* output, size_t count \
+    ) { \
+        output[count] = (double)colrcv_##model##_validate_soa( \
+            input, input + count, input + count * 2, \
+            (uint8_t*)output, count \
+        ); \
+    } \
+    static void batch_##model##_clamp( \
+        const double* input, double* output, size_t count \
+    ) { \
+        memcpy(output, input, count * 3 * sizeof(double)); \
+        colrcv_##model##_clamp_soa( \
+            output, output + count, output + count * 2, count \
+        ); \
+    }
+
+SCALAR_CONVERSION(rgb, hsv)
+SCALAR_CONVERSION(rgb, hsl)
+SCALAR_CONVERSION(rgb, lab)
+SCALAR_CONVERSION(rgb, xyz)
+SCALAR_CONVERSION(hsv, rgb)
+SCALAR_CONVERSION(hsv, hsl)
+SCALAR_CONVERSION(hsv, lab)
+SCALAR_CONVERSION(hsv, xyz)
+SCALAR_CONVERSION(hsl, rgb)
+SCALAR_CONVERSION(hsl, hsv)
+SCALAR_CONVERSION(hsl, lab)
+SCALAR_CONVERSION(hsl, xyz)
+SCALAR_CONVERSION(lab, rgb)
+SCALAR_CONVERSION(lab, hsv)
+SCALAR_CONVERSION(lab, hsl)
+SCALAR_CONVERSION(lab, xyz)
+SCALAR_CONVERSION(xyz, rgb)
+SCALAR_CONVERSION(xyz, hsv)
+SCALAR_CONVERSION(xyz, hsl)
+SCALAR_CONVERSION(xyz, lab)
+
+SCALAR_VALIDATION(rgb)
+SCALAR_VALIDATION(hsv)
+SCALAR_VALIDATION(hsl)
+SCALAR_VALIDATION(lab)
+SCALAR_VALIDATION(xyz)
+
+BATCH_VALIDATION(rgb)
+BATCH_VALIDATION(hsv)
+BATCH_VALIDATION(hsl)
+BATCH_VALIDATION(lab)
+BATCH_VALIDATION(xyz)
+
+// single-colour conversion loops, indexed by the model converted from and to
+static const bench_function_t SCALAR_CONVERSIONS[
+    COLRCV_MODEL_COUNT
+][COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = {
+        [COLRCV_MODEL_HSV] = scalar_rgb_to_hsv,
+        [COLRCV_MODEL_HSL] = scalar_rgb_to_hsl,
+        [COLRCV_MODEL_LAB] = scalar_rgb_to_lab,
+        [COLRCV_MODEL_XYZ] = scalar_rgb_to_xyz,
+    },
+    [COLRCV_MODEL_HSV] = {
+        [COLRCV_MODEL_RGB] = scalar_hsv_to_rgb,
+        [COLRCV_MODEL_HSL] = scalar_hsv_to_hsl,
+        [COLRCV_MODEL_LAB] = scalar_hsv_to_lab,
+        [COLRCV_MODEL_XYZ] = scalar_hsv_to_xyz,
+    },
+    [COLRCV_MODEL_HSL] = {
+        [COLRCV_MODEL_RGB] = scalar_hsl_to_rgb,
+        [COLRCV_MODEL_HSV] = scalar_hsl_to_hsv,
+        [COLRCV_MODEL_LAB] = scalar_hsl_to_lab,
+        [COLRCV_MODEL_XYZ] = scalar_hsl_to_xyz,
+    },
+    [COLRCV_MODEL_LAB] = {
+        [COLRCV_MODEL_RGB] = scalar_lab_to_rgb,
+        [COLRCV_MODEL_HSV] = scalar_lab_to_hsv,
+        [COLRCV_MODEL_HSL] = scalar_lab_to_hsl,
+        [COLRCV_MODEL_XYZ] = scalar_lab_to_xyz,
+    },
+    [COLRCV_MODEL_XYZ] = {
+        [COLRCV_MODEL_RGB] = scalar_xyz_to_rgb,
+        [COLRCV_MODEL_HSV] = scalar_xyz_to_hsv,
+        [COLRCV_MODEL_HSL] = scalar_xyz_to_hsl,
+        [COLRCV_MODEL_LAB] = scalar_xyz_to_lab,
+    },
+};
+
+static const bench_function_t SCALAR_IS_VALID[COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = scalar_rgb_is_valid,
+    [COLRCV_MODEL_HSV] = scalar_hsv_is_valid,
+    [COLRCV_MODEL_HSL] = scalar_hsl_is_valid,
+    [COLRCV_MODEL_LAB] = scalar_lab_is_valid,
+    [COLRCV_MODEL_XYZ] = scalar_xyz_is_valid,
+};
+
+static const bench_function_t SCALAR_CLAMP[COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = scalar_rgb_clamp,
+    [COLRCV_MODEL_HSV] = scalar_hsv_clamp,
+    [COLRCV_MODEL_HSL] = scalar_hsl_clamp,
+    [COLRCV_MODEL_LAB] = scalar_lab_clamp,
+    [COLRCV_MODEL_XYZ] = scalar_xyz_clamp,
+};
+
+static const bench_function_t BATCH_IS_VALID[COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = batch_rgb_is_valid,
+    [COLRCV_MODEL_HSV] = batch_hsv_is_valid,
+    [COLRCV_MODEL_HSL] = batch_hsl_is_valid,
+    [COLRCV_MODEL_LAB] = batch_lab_is_valid,
+    [COLRCV_MODEL_XYZ] = batch_xyz_is_valid,
+};
+
+static const bench_function_t BATCH_CLAMP[COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = batch_rgb_clamp,
+    [COLRCV_MODEL_HSV] = batch_hsv_clamp,
+    [COLRCV_MODEL_HSL] = batch_hsl_clamp,
+    [COLRCV_MODEL_LAB] = batch_lab_clamp,
+    [COLRCV_MODEL_XYZ] = batch_xyz_clamp,
+};
+
+/* END single-colour loops */
+
+// one thing to be timed, at each size
+typedef struct benchmark_t {
+    // such as "rgb_to_lab" or "lab_clamp"
+    char name[32];
+    // "scalar" for the single-colour functions, "batch" for the others
+    const char* path;
+    // the model of the colours given to the benchmark
+    colrcv_model_t model;
+    // whether the colours are three channel arrays rather than structs
+    bool planar;
+    // the number of bytes read and written for each colour
+    size_t bytes;
+    // one of the validation or single-colour loops, or NULL for batch
+    // conversions
+    bench_function_t function;
+    colrcv_soa_conversion_t conversion;
+} benchmark_t;
+
+// the settings given on the command-line
+typedef struct bench_options_t {
+    size_t max_size;
+    double min_time;
+    size_t samples;
+    // whether the number of samples was given, rather than the default
+    bool samples_given;
+    // only benchmarks whose names contain this are run, if not NULL
+    const char* filter;
+    colrcv_accuracy_t accuracy;
+    // whether to read the hardware performance counters
+    bool counters;
+    // a processor-specific event to count as well, if not 0
+    uint64_t raw_counter;
+    // the baseline to compare against, or to write, if not NULL
+    const char* baseline;
+    const char* write_baseline;
+    // the size of array of colours that a baseline is written at
+    size_t gate_size;
+    double threshold;
+} bench_options_t;
+
+// the timings of one benchmark at one size
+typedef struct bench_result_t {
+    // the number of times the benchmark was run for each sample
+    size_t iterations;
+    // the quickest and median time per colour of the samples
+    double best;
+    double median;
+    // the bounds of the 95% confidence interval of the median
+    double low;
+    double high;
+} bench_result_t;
+
+static double get_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+// where the reference loop leaves its result, so it can't be optimised away
+static volatile double reference_sink = 1.0;
+
+/*
+ * times a chain of dependent multiply-adds, giving the time of one step in
+ * seconds. each step takes the same number of cycles on most CPUs, so
+ * dividing timings by this makes them comparable between machines and clock
+ * speeds
+ */
+static double time_reference_step(void) {
+    double x = reference_sink;
+    const double start = get_seconds();
+    for(size_t i = 0; i < REFERENCE_STEPS; i++) {
+        x = x * 0.999999 + 1e-6;
+    }
+    const double taken = get_seconds() - start;
+    reference_sink = x;
+    return taken / REFERENCE_STEPS;
+}
+
+static void run_benchmark(
+    const benchmark_t* benchmark, const double* input, double* output,
+    size_t count
+) {
+    if(benchmark->function != NULL) {
+        benchmark->function(input, output, count);
+    } else {
+        benchmark->conversion(
+            input, input + count, input + count * 2,
+            output, output + count, output + count * 2,
+            count
+        );
+    }
+}
+
+// runs a benchmark a number of times, giving the time taken in seconds
+static double time_benchmark(
+    const benchmark_t* benchmark, const double* input, double* output,
+    size_t count, size_t iterations
+) {
+    const double start = get_seconds();
+    for(size_t i = 0; i < iterations; i++) {
+        run_benchmark(benchmark, input, output, count);
+    }
+    return get_seconds() - start;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    const double x = *(const double*)a;
+    const double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * runs a benchmark the given number of times with the hardware performance
+ * counters running, giving each count per colour
+ */
+static bench_counts_t count_benchmark(
+    const benchmark_t* benchmark, const double* input, double* output,
+    size_t count, size_t iterations, bench_counters_t* counters
+) {
+    bench_counters_start(counters);
+    time_benchmark(benchmark, input, output, count, iterations);
+    bench_counts_t counts = bench_counters_stop(counters);
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        counts.values[i] /= (double)iterations * count;
+    }
+    return counts;
+}
+
+/*
+ * finds how many times a benchmark must run to take the time of one sample,
+ * then takes the samples. if `relative`, each sample is in steps of the
+ * reference loop per colour rather than seconds per colour
+ */
+static bench_result_t measure(
+    const benchmark_t* benchmark, const double* input, double* output,
+    size_t count, const bench_options_t* options, bool relative,
+    double* samples
+) {
+    const double sample_time = options->min_time / options->samples;
+    size_t iterations = 1;
+    for(;;) {
+        const double taken = time_benchmark(
+            benchmark, input, output, count, iterations
+        );
+        if(taken >= sample_time) {
+            break;
+        }
+        // aim a little over the sample time, growing at most 100 times
+        const double wanted = (taken > 0.0)
+            ? iterations * sample_time * 1.2 / taken
+            : iterations * 100.0;
+        iterations = (wanted > iterations * 100.0)
+            ? iterations * 100
+            : (size_t)wanted + 1;
+    }
+    // once more untimed, so that caches and branch predictors are warm
+    time_benchmark(benchmark, input, output, count, iterations);
+    const size_t n = options->samples;
+    for(size_t s = 0; s < n; s++) {
+        samples[s] = time_benchmark(
+            benchmark, input, output, count, iterations
+        ) / ((double)iterations * count);
+        if(relative) {
+            samples[s] /= time_reference_step();
+        }
+    }
+    qsort(samples, n, sizeof(double), compare_doubles);
+    /*
+     * the median lies between the samples of these ranks 95% of the time,
+     * whatever the distribution of the samples
+     */
+    const double spread = 1.96 * sqrt((double)n);
+    const size_t low = (n > spread) ? (size_t)((n - spread) / 2.0) : 0;
+    return (bench_result_t){
+        .iterations = iterations,
+        .best = samples[0],
+        .median = samples[n / 2],
+        .low = samples[low],
+        .high = samples[n - 1 - low],
+    };
+}
+
+/*
+ * fills an array with colours of a model spread across the range of each
+ * channel, the same every run
+ */
+static void fill_colours(
+    colrcv_model_t model, bool planar, double* colours, size_t count
+) {
+    double min[3], max[3];
+    colrcv_get_model_range(model, min, max);
+    uint32_t state = 12345;
+    for(size_t i = 0; i < count; i++) {
+        for(size_t ch = 0; ch < 3; ch++) {
+            state = state * 1664525u + 1013904223u;
+            const double value = min[ch] + (
+                (state >> 8) / 16777216.0
+            ) * (max[ch] - min[ch]);
+            colours[planar ? ch * count + i : i * 3 + ch] = value;
+        }
+    }
+}
+
+// makes the list of benchmarks, giving the number made
+static size_t make_benchmarks(benchmark_t* benchmarks) {
+    size_t made = 0;
+    for(size_t from = 0; from < COLRCV_MODEL_COUNT; from++) {
+        for(size_t to = 0; to < COLRCV_MODEL_COUNT; to++) {
+            if(from == to) {
+                continue;
+            }
+            for(size_t batch = 0; batch < 2; batch++) {
+                benchmark_t* benchmark = &benchmarks[made++];
+                snprintf(
+                    benchmark->name, sizeof(benchmark->name), "%s_to_%s",
+                    MODEL_NAMES[from], MODEL_NAMES[to]
+                );
+                benchmark->path = batch ? "batch" : "scalar";
+                benchmark->model = (colrcv_model_t)from;
+                benchmark->planar = batch;
+                benchmark->bytes = 6 * sizeof(double);
+                benchmark->function = batch
+                    ? NULL
+                    : SCALAR_CONVERSIONS[from][to];
+                benchmark->conversion = colrcv_get_soa_conversion(
+                    (colrcv_model_t)from, (colrcv_model_t)to
+                );
+            }
+        }
+    }
+    for(size_t model = 0; model < COLRCV_MODEL_COUNT; model++) {
+        for(size_t clamp = 0; clamp < 2; clamp++) {
+            for(size_t batch = 0; batch < 2; batch++) {
+                benchmark_t* benchmark = &benchmarks[made++];
+                snprintf(
+                    benchmark->name, sizeof(benchmark->name), "%s_%s",
+                    MODEL_NAMES[model], clamp ? "clamp" : "is_valid"
+                );
+                benchmark->path = batch ? "batch" : "scalar";
+                benchmark->model = (colrcv_model_t)model;
+                benchmark->planar = batch;
+                // validation only reads each colour
+                benchmark->bytes = (clamp ? 6 : 3) * sizeof(double);
+                if(batch) {
+                    benchmark->function = clamp
+                        ? BATCH_CLAMP[model]
+                        : BATCH_IS_VALID[model];
+                } else {
+                    benchmark->function = clamp
+                        ? SCALAR_CLAMP[model]
+                        : SCALAR_IS_VALID[model];
+                }
+                benchmark->conversion = NULL;
+            }
+        }
+    }
+    return made;
+}
+
+static void print_usage(const char* program) {
+    fprintf(
+        stderr,
+        "usage: %s [OPTION]...\n"
+        "Times every conversion and the validation and clamping of each\n"
+        "colour model over arrays of 1, 10, 100... colours, writing JSON.\n"
+        "  --max-size N     the largest array of colours, default %d. Up to\n"
+        "                   100000000, which needs 4.8GB of memory\n"
+        "  --min-time S     seconds to spend on each size, default %g\n"
+        "  --samples N      timed samples at each size, default %d\n"
+        "  --filter TEXT    only run benchmarks with TEXT in their name\n"
+        "  --fast           use COLRCV_ACCURACY_FAST for batch conversions\n"
+        "  --counters       also count cycles, instructions, branch and\n"
+        "                   cache misses per colour (Linux only)\n"
+        "  --raw-counter X  also count the processor-specific event with\n"
+        "                   hex number X, such as vector instructions\n"
+        "Instead of writing JSON, a baseline can be written or compared with:\n"
+        "  --write-baseline FILE  write the median time of each benchmark\n"
+        "  --size N               the array size to write them at, default\n"
+        "                         %d\n"
+        "  --baseline FILE        compare each benchmark in FILE, exiting\n"
+        "                         with 1 if any has got slower\n"
+        "  --threshold F          the fraction slower a benchmark may get,\n"
+        "                         default %g\n"
+        "Baselines take %d samples unless --samples is given.\n",
+        program, DEFAULT_MAX_SIZE, DEFAULT_MIN_TIME, DEFAULT_SAMPLES,
+        DEFAULT_GATE_SIZE, DEFAULT_THRESHOLD, GATE_SAMPLES
+    );
+}
+
+// returns false if the options aren't valid
+static bool parse_options(int argc, char* argv[], bench_options_t* options) {
+    options->max_size = DEFAULT_MAX_SIZE;
+    options->min_time = DEFAULT_MIN_TIME;
+    options->samples = DEFAULT_SAMPLES;
+    options->samples_given = false;
+    options->filter = NULL;
+    options->accuracy = COLRCV_ACCURACY_EXACT;
+    options->counters = false;
+    options->raw_counter = 0;
+    options->baseline = NULL;
+    options->write_baseline = NULL;
+    options->gate_size = DEFAULT_GATE_SIZE;
+    options->threshold = DEFAULT_THRESHOLD;
+    for(int i = 1; i < argc; i++) {
+        const bool has_value = i + 1 < argc;
+        if(strcmp(argv[i], "--fast") == 0) {
+            options->accuracy = COLRCV_ACCURACY_FAST;
+        } else if(strcmp(argv[i], "--counters") == 0) {
+            options->counters = true;
+        } else if(has_value && strcmp(argv[i], "--raw-counter") == 0) {
+            options->counters = true;
+            options->raw_counter = strtoull(argv[++i], NULL, 16);
+        } else if(has_value && strcmp(argv[i], "--max-size") == 0) {
+            options->max_size = strtoul(argv[++i], NULL, 10);
+        } else if(has_value && strcmp(argv[i], "--min-time") == 0) {
+            options->min_time = strtod(argv[++i], NULL);
+        } else if(has_value && strcmp(argv[i], "--samples") == 0) {
+            options->samples = strtoul(argv[++i], NULL, 10);
+            options->samples_given = true;
+        } else if(has_value && strcmp(argv[i], "--filter") == 0) {
+            options->filter = argv[++i];
+        } else if(has_value && strcmp(argv[i], "--baseline") == 0) {
+            options->baseline = argv[++i];
+        } else if(has_value && strcmp(argv[i], "--write-baseline") == 0) {
+            options->write_baseline = argv[++i];
+        } else if(has_value && strcmp(argv[i], "--size") == 0) {
+            options->gate_size = strtoul(argv[++i], NULL, 10);
+        } else if(has_value && strcmp(argv[i], "--threshold") == 0) {
+            options->threshold = strtod(argv[++i], NULL);
+        } else {
+            return false;
+        }
+    }
+    if(
+        !options->samples_given &&
+        (options->baseline != NULL || options->write_baseline != NULL)
+    ) {
+        options->samples = GATE_SAMPLES;
+    }
+    return (
+        options->max_size > 0 && options->min_time > 0.0 &&
+        options->samples > 0 && options->gate_size > 0 &&
+        options->threshold >= 0.0 &&
+        (options->baseline == NULL || options->write_baseline == NULL)
+    );
+}
+
+// instructions per cycle, or 0 if either wasn't counted
+static double get_ipc(const bench_counts_t* counts) {
+    return (
+        counts->available[BENCH_COUNTER_CYCLES] &&
+        counts->available[BENCH_COUNTER_INSTRUCTIONS] &&
+        counts->values[BENCH_COUNTER_CYCLES] > 0.0
+    ) ? (
+        counts->values[BENCH_COUNTER_INSTRUCTIONS] /
+        counts->values[BENCH_COUNTER_CYCLES]
+    ) : 0.0;
+}
+
+// prints each count per colour, null for those that couldn't be counted
+static void print_counts(const bench_counts_t* counts) {
+    printf(", \"counters\": {");
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        printf("\"%s_per_colour\": ", BENCH_COUNTER_NAMES[i]);
+        if(counts->available[i]) {
+            printf("%.4f, ", counts->values[i]);
+        } else {
+            printf("null, ");
+        }
+    }
+    const double ipc = get_ipc(counts);
+    if(ipc > 0.0) {
+        printf("\"ipc\": %.4f}", ipc);
+    } else {
+        printf("\"ipc\": null}");
+    }
+}
+
+static void print_result(
+    const benchmark_t* benchmark, size_t size, bench_result_t result,
+    const bench_counts_t* counts, bool first
+) {
+    printf(
+        "%s    {\"name\": \"%s\", \"path\": \"%s\", \"size\": %zu, "
+        "\"iterations\": %zu, \"ns_per_colour\": %.4f, "
+        "\"median_ns_per_colour\": %.4f, \"colours_per_second\": %.6g, "
+        "\"gb_per_second\": %.4f",
+        first ? "" : ",\n",
+        benchmark->name, benchmark->path, size, result.iterations,
+        result.best * 1e9, result.median * 1e9, 1.0 / result.best,
+        benchmark->bytes / result.best * 1e-9
+    );
+    // the counters are left out altogether when they weren't asked for
+    if(counts != NULL) {
+        print_counts(counts);
+    }
+    printf("}");
+}
+
+// whether a benchmark is to be run, going by the filter
+static bool is_wanted(
+    const benchmark_t* benchmark, const bench_options_t* options
+) {
+    return (
+        options->filter == NULL ||
+        strstr(benchmark->name, options->filter) != NULL
+    );
+}
+
+// runs every benchmark at each size, writing the results as JSON
+static int run_suite(
+    const benchmark_t* benchmarks, size_t benchmark_count,
+    const bench_options_t* options, double* samples, const char* program
+) {
+    printf(
+        "{\n  \"version\": \"%s\",\n  \"simd_level\": \"%s\",\n"
+        "  \"accuracy\": \"%s\",\n  \"samples\": %zu,\n  \"results\": [\n",
+        COLRCV_VERSION.string, SIMD_LEVEL_NAMES[colrcv_simd_get_level()],
+        (options->accuracy == COLRCV_ACCURACY_FAST) ? "fast" : "exact",
+        options->samples
+    );
+    bench_counters_t counters;
+    bool counting = false;
+    if(options->counters) {
+        counting = bench_counters_open(&counters, options->raw_counter);
+        if(!counting) {
+            fprintf(
+                stderr, "%s: hardware performance counters are not "
+                "available, timing only\n", program
+            );
+        }
+    }
+    bool first = true;
+    int status = 0;
+    for(size_t size = 1; size <= options->max_size; size *= 10) {
+        // three channels of each colour in and out
+        double* input = malloc(size * 3 * sizeof(double));
+        double* output = malloc(size * 3 * sizeof(double));
+        if(input == NULL || output == NULL) {
+            fprintf(stderr, "%s: out of memory at %zu\n", program, size);
+            free(input);
+            free(output);
+            status = 1;
+            break;
+        }
+        for(size_t b = 0; b < benchmark_count; b++) {
+            const benchmark_t* benchmark = &benchmarks[b];
+            if(!is_wanted(benchmark, options)) {
+                continue;
+            }
+            fill_colours(benchmark->model, benchmark->planar, input, size);
+            const bench_result_t result = measure(
+                benchmark, input, output, size, options, false, samples
+            );
+            bench_counts_t counts;
+            if(counting) {
+                counts = count_benchmark(
+                    benchmark, input, output, size, result.iterations,
+                    &counters
+                );
+            }
+            print_result(
+                benchmark, size, result, counting ? &counts : NULL, first
+            );
+            first = false;
+            fprintf(
+                stderr, "%-12s %-6s %10zu colours %10.3f ns/colour",
+                benchmark->name, benchmark->path, size, result.best * 1e9
+            );
+            if(counting && counts.available[BENCH_COUNTER_CYCLES]) {
+                fprintf(
+                    stderr, " %8.2f cycles/colour %5.2f IPC",
+                    counts.values[BENCH_COUNTER_CYCLES], get_ipc(&counts)
+                );
+            }
+            fprintf(stderr, "\n");
+        }
+        free(input);
+        free(output);
+    }
+    printf("\n  ]\n}\n");
+    if(counting) {
+        bench_counters_close(&counters);
+    }
+    return status;
+}
+
+/*
+ * runs a benchmark at one size, in steps of the reference loop per colour.
+ * returns false if memory could not be allocated
+ */
+static bool measure_relative(
+    const benchmark_t* benchmark, size_t size,
+    const bench_options_t* options, double* samples, bench_result_t* result
+) {
+    double* input = malloc(size * 3 * sizeof(double));
+    double* output = malloc(size * 3 * sizeof(double));
+    const bool allocated = input != NULL && output != NULL;
+    if(allocated) {
+        fill_colours(benchmark->model, benchmark->planar, input, size);
+        *result = measure(
+            benchmark, input, output, size, options, true, samples
+        );
+    }
+    free(input);
+    free(output);
+    return allocated;
+}
+
+// finds a benchmark by its name and path, giving NULL if there's no such one
+static const benchmark_t* find_benchmark(
+    const benchmark_t* benchmarks, size_t benchmark_count,
+    const char* name, const char* path
+) {
+    for(size_t b = 0; b < benchmark_count; b++) {
+        if(
+            strcmp(benchmarks[b].name, name) == 0 &&
+            strcmp(benchmarks[b].path, path) == 0
+        ) {
+            return &benchmarks[b];
+        }
+    }
+    return NULL;
+}
+
+// writes the median of every benchmark at the baseline size to a file
+static int write_baseline(
+    const benchmark_t* benchmarks, size_t benchmark_count,
+    const bench_options_t* options, double* samples, const char* program
+) {
+    FILE* file = fopen(options->write_baseline, "w");
+    if(file == NULL) {
+        fprintf(
+            stderr, "%s: could not open %s\n", program, options->write_baseline
+        );
+        return 1;
+    }
+    fprintf(
+        file,
+        "# baseline of colrcv_bench, written with --write-baseline and\n"
+        "# checked with --baseline. each line is a benchmark, its path, the\n"
+        "# number of colours and the median time per colour, in steps of a\n"
+        "# reference loop so that it compares between machines.\n"
+        "# batch results are only checked on machines of the same simd level\n"
+        "simd_level %s\n",
+        SIMD_LEVEL_NAMES[colrcv_simd_get_level()]
+    );
+    int status = 0;
+    for(size_t b = 0; status == 0 && b < benchmark_count; b++) {
+        const benchmark_t* benchmark = &benchmarks[b];
+        bench_result_t result;
+        if(!is_wanted(benchmark, options)) {
+            continue;
+        }
+        if(
+            !measure_relative(
+                benchmark, options->gate_size, options, samples, &result
+            )
+        ) {
+            fprintf(stderr, "%s: out of memory\n", program);
+            status = 1;
+            break;
+        }
+        fprintf(
+            file, "%s %s %zu %.6g\n", benchmark->name, benchmark->path,
+            options->gate_size, result.median
+        );
+        fprintf(
+            stderr, "%-12s %-6s %10zu colours %10.4f steps/colour\n",
+            benchmark->name, benchmark->path, options->gate_size,
+            result.median
+        );
+    }
+    if(fclose(file) != 0 && status == 0) {
+        fprintf(
+            stderr, "%s: could not write %s\n", program,
+            options->write_baseline
+        );
+        status = 1;
+    }
+    return status;
+}
+
+/*
+ * runs each benchmark in a baseline file, failing if the confidence interval
+ * of its median is entirely beyond the threshold above its baseline
+ */
+static int compare_baseline(
+    const benchmark_t* benchmarks, size_t benchmark_count,
+    const bench_options_t* options, double* samples, const char* program
+) {
+    FILE* file = fopen(options->baseline, "r");
+    if(file == NULL) {
+        fprintf(stderr, "%s: could not open %s\n", program, options->baseline);
+        return 1;
+    }
+    const char* simd_level = SIMD_LEVEL_NAMES[colrcv_simd_get_level()];
+    char baseline_simd_level[16] = "";
+    size_t checked = 0;
+    size_t regressed = 0;
+    int status = 0;
+    char line[256];
+    while(status == 0 && fgets(line, sizeof(line), file) != NULL) {
+        char name[32], path[16];
+        size_t size;
+        double baseline;
+        if(line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if(sscanf(line, "simd_level %15s", baseline_simd_level) == 1) {
+            continue;
+        }
+        const benchmark_t* benchmark = NULL;
+        if(
+            sscanf(
+                line, "%31s %15s %zu %lf", name, path, &size, &baseline
+            ) == 4
+        ) {
+            benchmark = find_benchmark(
+                benchmarks, benchmark_count, name, path
+            );
+        }
+        if(benchmark == NULL || size == 0 || baseline <= 0.0) {
+            fprintf(stderr, "%s: bad baseline line: %s", program, line);
+            status = 1;
+            break;
+        }
+        if(!is_wanted(benchmark, options)) {
+            continue;
+        }
+        if(
+            benchmark->function == NULL &&
+            strcmp(baseline_simd_level, simd_level) != 0
+        ) {
+            printf(
+                "%-12s %-6s %8zu  skipped, baseline is of simd level %s\n",
+                name, path, size, baseline_simd_level
+            );
+            continue;
+        }
+        /*
+         * a benchmark seen to be slower is measured again, in case something
+         * else was running at the time, and only fails if it stays slower
+         */
+        const double limit = baseline * (1.0 + options->threshold);
+        bench_result_t result;
+        bool slower = true;
+        for(size_t tries = 0; slower && tries <= GATE_RETRIES; tries++) {
+            if(
+                !measure_relative(
+                    benchmark, size, options, samples, &result
+                )
+            ) {
+                fprintf(stderr, "%s: out of memory\n", program);
+                status = 1;
+                break;
+            }
+            slower = result.low > limit;
+        }
+        if(status != 0) {
+            break;
+        }
+        printf(
+            "%-12s %-6s %8zu  baseline %9.4f  now %9.4f [%9.4f, %9.4f] "
+            "%+6.1f%%  %s\n",
+            name, path, size, baseline, result.median, result.low,
+            result.high, (result.median / baseline - 1.0) * 100.0,
+            slower ? "REGRESSED" : "ok"
+        );
+        checked++;
+        regressed += slower;
+    }
+    fclose(file);
+    if(status == 0) {
+        printf(
+            "%zu of %zu benchmarks regressed by more than %g%%\n",
+            regressed, checked, options->threshold * 100.0
+        );
+        status = (regressed > 0) ? 1 : 0;
+    }
+    return status;
+}
+
+int main(int argc, char* argv[]) {
+    bench_options_t options;
+    if(!parse_options(argc, argv, &options)) {
+        print_usage(argv[0]);
+        return 2;
+    }
+    colrcv_set_accuracy(options.accuracy);
+    benchmark_t benchmarks[
+        COLRCV_MODEL_COUNT * (COLRCV_MODEL_COUNT - 1) * 2 +
+        COLRCV_MODEL_COUNT * 2 * 2
+    ];
+    const size_t benchmark_count = make_benchmarks(benchmarks);
+    double* samples = malloc(options.samples * sizeof(double));
+    if(samples == NULL) {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    }
+    int status;
+    if(options.baseline != NULL) {
+        status = compare_baseline(
+            benchmarks, benchmark_count, &options, samples, argv[0]
+        );
+    } else if(options.write_baseline != NULL) {
+        status = write_baseline(
+            benchmarks, benchmark_count, &options, samples, argv[0]
+        );
+    } else {
+        status = run_suite(
+            benchmarks, benchmark_count, &options, samples, argv[0]
+        );
+    }
+    free(samples);
+    return status;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,178 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// needed for syscall() when compiling as strict ISO C
+#define _DEFAULT_SOURCE
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "counters.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+const char* BENCH_COUNTER_NAMES[BENCH_COUNTER_COUNT] = {
+    [BENCH_COUNTER_CYCLES] = "cycles",
+    [BENCH_COUNTER_INSTRUCTIONS] = "instructions",
+    [BENCH_COUNTER_BRANCH_MISSES] = "branch_misses",
+    [BENCH_COUNTER_L1D_MISSES] = "l1d_misses",
+    [BENCH_COUNTER_LLC_MISSES] = "llc_misses",
+    [BENCH_COUNTER_RAW] = "raw",
+};
+
+#ifdef __linux__
+
+// the type and config of each event, as perf_event_open() takes them
+static const struct {
+    uint32_t type;
+    uint64_t config;
+} EVENTS[BENCH_COUNTER_COUNT] = {
+    [BENCH_COUNTER_CYCLES] = {
+        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,
+    },
+    [BENCH_COUNTER_INSTRUCTIONS] = {
+        PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,
+    },
+    [BENCH_COUNTER_BRANCH_MISSES] = {
+        PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES,
+    },
+    [BENCH_COUNTER_L1D_MISSES] = {
+        PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D |
+        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    },
+    [BENCH_COUNTER_LLC_MISSES] = {
+        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,
+    },
+    // the config is given when opening
+    [BENCH_COUNTER_RAW] = { PERF_TYPE_RAW, 0, },
+};
+
+// opens one counter, stopped, giving -1 if it can't be
+static int open_counter(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    // the kernel is left out so that this works for users without privileges
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // so that counts can be scaled up if counters were shared between events
+    attr.read_format = (
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+    );
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+bool bench_counters_open(bench_counters_t* counters, uint64_t raw) {
+    bool opened = false;
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        counters->fds[i] = -1;
+        if(i == BENCH_COUNTER_RAW && raw == 0) {
+            continue;
+        }
+        counters->fds[i] = open_counter(
+            EVENTS[i].type, (i == BENCH_COUNTER_RAW) ? raw : EVENTS[i].config
+        );
+        opened = opened || counters->fds[i] != -1;
+    }
+    return opened;
+}
+
+void bench_counters_start(bench_counters_t* counters) {
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        if(counters->fds[i] != -1) {
+            ioctl(counters->fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(counters->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+bench_counts_t bench_counters_stop(bench_counters_t* counters) {
+    bench_counts_t counts;
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        if(counters->fds[i] != -1) {
+            ioctl(counters->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        // the count, then the time enabled and the time actually counting
+        uint64_t values[3];
+        counts.values[i] = 0.0;
+        counts.available[i] = (
+            counters->fds[i] != -1 &&
+            read(counters->fds[i], values, sizeof(values)) ==
+                (ssize_t)sizeof(values) &&
+            values[2] > 0
+        );
+        if(counts.available[i]) {
+            counts.values[i] = (double)values[0] * values[1] / values[2];
+        }
+    }
+    return counts;
+}
+
+void bench_counters_close(bench_counters_t* counters) {
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        if(counters->fds[i] != -1) {
+            close(counters->fds[i]);
+            counters->fds[i] = -1;
+        }
+    }
+}
+
+#else
+
+bool bench_counters_open(bench_counters_t* counters, uint64_t raw) {
+    (void)raw;
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        counters->fds[i] = -1;
+    }
+    return false;
+}
+
+void bench_counters_start(bench_counters_t* counters) {
+    (void)counters;
+}
+
+bench_counts_t bench_counters_stop(bench_counters_t* counters) {
+    (void)counters;
+    bench_counts_t counts;
+    for(size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        counts.values[i] = 0.0;
+        counts.available[i] = false;
+    }
+    return counts;
+}
+
+void bench_counters_close(bench_counters_t* counters) {
+    (void)counters;
+}
+
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
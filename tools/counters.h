@@ -0,0 +1,74 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This header declares the hardware performance counters read by
+ * colrcv_bench, which use perf_event_open() on Linux and are unavailable
+ * everywhere else.
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef SAXBOPHONE_COLRCV_TOOLS_COUNTERS_H
+#define SAXBOPHONE_COLRCV_TOOLS_COUNTERS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the events counted, each of which may or may not be available
+typedef enum bench_counter_t {
+    BENCH_COUNTER_CYCLES,
+    BENCH_COUNTER_INSTRUCTIONS,
+    BENCH_COUNTER_BRANCH_MISSES,
+    BENCH_COUNTER_L1D_MISSES,
+    BENCH_COUNTER_LLC_MISSES,
+    // a processor-specific event given by number, such as vector instructions
+    BENCH_COUNTER_RAW,
+    BENCH_COUNTER_COUNT,
+} bench_counter_t;
+
+// names of the events, as used in the benchmark results
+extern const char* BENCH_COUNTER_NAMES[BENCH_COUNTER_COUNT];
+
+typedef struct bench_counters_t {
+    // the file descriptor of each event, -1 for those not available
+    int fds[BENCH_COUNTER_COUNT];
+} bench_counters_t;
+
+typedef struct bench_counts_t {
+    // the count of each event, scaled up if only counted some of the time
+    double values[BENCH_COUNTER_COUNT];
+    bool available[BENCH_COUNTER_COUNT];
+} bench_counts_t;
+
+/*
+ * opens a counter for each event in user space of this thread. if `raw` is
+ * not 0, it is a processor-specific event number to count as well.
+ * returns false if no counters could be opened, such as when not running on
+ * Linux, inside a virtual machine without them, or when
+ * /proc/sys/kernel/perf_event_paranoid is higher than 2
+ */
+bool bench_counters_open(bench_counters_t* counters, uint64_t raw);
+
+// resets and starts every open counter
+void bench_counters_start(bench_counters_t* counters);
+
+// stops every open counter, giving the counts since they were started
+bench_counts_t bench_counters_stop(bench_counters_t* counters);
+
+void bench_counters_close(bench_counters_t* counters);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// end of header file
+#endif
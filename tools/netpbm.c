@@ -0,0 +1,120 @@
+/*
+ * This source file forms part of colrcv
+ * colrcv is a C Library for converting Colours between different Colour Models.
+ *
+ * This is a command-line tool for converting PPM and PAM images of any size to
+ * planes of colours, using colrcv_netpbm_convert().
+ *
+ * Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../colrcv/convert.h"
+#include "../colrcv/netpbm.h"
+#include "../colrcv/pool.h"
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// the names of the colour models, as given on the command-line
+static const char* MODEL_NAMES[COLRCV_MODEL_COUNT] = {
+    [COLRCV_MODEL_RGB] = "rgb",
+    [COLRCV_MODEL_HSV] = "hsv",
+    [COLRCV_MODEL_HSL] = "hsl",
+    [COLRCV_MODEL_LAB] = "lab",
+    [COLRCV_MODEL_XYZ] = "xyz",
+};
+
+// describes each of the results of colrcv_netpbm_convert()
+static const char* STATUS_MESSAGES[] = {
+    [COLRCV_NETPBM_OK] = "converted",
+    [COLRCV_NETPBM_BAD_HEADER] = "input is not a PPM or PAM image",
+    [COLRCV_NETPBM_UNSUPPORTED] = "PAM images deeper than 4 not supported",
+    [COLRCV_NETPBM_BAD_MODEL] = "unknown colour model",
+    [COLRCV_NETPBM_READ_ERROR] = "could not read input",
+    [COLRCV_NETPBM_WRITE_ERROR] = "could not write output",
+    [COLRCV_NETPBM_OUT_OF_MEMORY] = "out of memory",
+};
+
+static void print_usage(const char* program) {
+    fprintf(
+        stderr,
+        "usage: %s MODEL INPUT OUTPUT [THREADS]\n"
+        "Converts a PPM or PAM image to three planes of floats.\n"
+        "  MODEL    rgb, hsv, hsl, lab or xyz\n"
+        "  INPUT    the image to read, or - for standard input\n"
+        "  OUTPUT   the file to write the planes to\n"
+        "  THREADS  the number of threads to convert with, default 0 (one\n"
+        "           per core)\n",
+        program
+    );
+}
+
+int main(int argc, char* argv[]) {
+    if(argc < 4 || argc > 5) {
+        print_usage(argv[0]);
+        return 2;
+    }
+    colrcv_model_t model = COLRCV_MODEL_COUNT;
+    for(size_t m = 0; m < COLRCV_MODEL_COUNT; m++) {
+        if(strcmp(argv[1], MODEL_NAMES[m]) == 0) {
+            model = (colrcv_model_t)m;
+        }
+    }
+    const size_t threads = (argc == 5) ? strtoul(argv[4], NULL, 10) : 0;
+    if(model == COLRCV_MODEL_COUNT) {
+        print_usage(argv[0]);
+        return 2;
+    }
+    FILE* input = (strcmp(argv[2], "-") == 0)
+        ? stdin
+        : fopen(argv[2], "rb");
+    if(input == NULL) {
+        fprintf(stderr, "%s: could not open %s\n", argv[0], argv[2]);
+        return 1;
+    }
+    FILE* output = fopen(argv[3], "wb");
+    if(output == NULL) {
+        fprintf(stderr, "%s: could not open %s\n", argv[0], argv[3]);
+        if(input != stdin) {
+            fclose(input);
+        }
+        return 1;
+    }
+    colrcv_pool_t* pool = colrcv_pool_create(threads);
+    colrcv_netpbm_info_t info;
+    const colrcv_netpbm_status_t status = colrcv_netpbm_convert(
+        input, output, model, 0, pool, &info
+    );
+    colrcv_pool_free(pool);
+    if(input != stdin) {
+        fclose(input);
+    }
+    const bool closed = fclose(output) == 0;
+    if(status != COLRCV_NETPBM_OK || !closed) {
+        fprintf(
+            stderr, "%s: %s\n", argv[0],
+            STATUS_MESSAGES[closed ? status : COLRCV_NETPBM_WRITE_ERROR]
+        );
+        return 1;
+    }
+    printf(
+        "%zu x %zu pixels written as 3 planes of 32-bit floats (%s)\n",
+        info.width, info.height, MODEL_NAMES[model]
+    );
+    return 0;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
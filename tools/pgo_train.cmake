@@ -0,0 +1,47 @@
+# This source file forms part of colrcv
+#
+# colrcv is a C Library for converting Colours between different Colour Models.
+#
+# This CMake script is run by the colrcv_pgo_train target of a build made with
+# COLRCV_PGO_GENERATE. It trains colrcv for Profile-Guided Optimisation by
+# running the instrumented colrcv_bench, which writes profiles of every
+# conversion, validation and clamping function into PGO_DIR for COLRCV_PGO_USE
+# to optimise with.
+#
+# Copyright (C) 2017, 2018, Joshua Saxby joshua.a.saxby+TNOPLuc8vM==@gmail.com
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+# drop the profiles of earlier runs, so that only this one is used
+file(REMOVE_RECURSE "${PGO_DIR}")
+file(MAKE_DIRECTORY "${PGO_DIR}")
+
+# up to 100,000 colours covers the remainders of the vector loops as well as
+# the loops themselves, both with exact and with fast accuracy. the timings
+# themselves aren't wanted, only that the code is run
+foreach(accuracy "" "--fast")
+    execute_process(
+        COMMAND "${BENCH}" --max-size 100000 --min-time 0.01 --samples 3
+            ${accuracy}
+        RESULT_VARIABLE result
+        OUTPUT_QUIET
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "[colrcv] colrcv_bench failed: ${result}")
+    endif()
+endforeach()
+
+# Clang writes raw profiles, which must be merged into the one it reads
+if(LLVM_PROFDATA)
+    file(GLOB raw_profiles "${PGO_DIR}/*.profraw")
+    execute_process(
+        COMMAND "${LLVM_PROFDATA}" merge
+            -output=${PGO_DIR}/default.profdata ${raw_profiles}
+        RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "[colrcv] llvm-profdata failed: ${result}")
+    endif()
+endif()